@@ -0,0 +1,168 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file parser_move_benchmark.cpp
+ * @ingroup argparser_benchmark
+ * @defgroup Parser build and transfer benchmark
+ * @{
+ */
+
+// Includes
+#include <cstdlib>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <optional>
+#include <string>
+#include <vector>
+#include "varg.h"
+#include "listvarg.h"
+#include "cmd_line_parse.h"
+
+using namespace argparser;
+
+//======================================================================================
+// Heap allocation tracking
+//======================================================================================
+static size_t heapBytes = 0;        ///< Total number of bytes requested from operator new
+static size_t heapBlocks = 0;       ///< Total number of operator new calls
+
+void* operator new(size_t size)
+{
+    heapBytes += size;
+    heapBlocks++;
+    void* block = malloc((size != 0) ? size : 1);
+    if (block == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return block;
+}
+
+void operator delete(void* block) noexcept                          {free(block);}
+void operator delete(void* block, size_t /* size */) noexcept       {free(block);}
+
+//======================================================================================
+// Benchmark
+//======================================================================================
+constexpr size_t parserCount = 1000;        ///< Number of parsers built per method
+constexpr size_t schemaArgCount = 32;       ///< Number of arguments per parser
+
+/**
+ * @brief Add the benchmark schema to a parser, a mix of built in value storage and
+ *        parser owned argument objects with built key and help strings
+ *
+ * @param parser - Parser to fill
+ */
+void buildSchema(cmd_line_parse& parser)
+{
+    for (size_t index = 0; index < schemaArgCount; index++)
+    {
+        const std::string name = "argument" + std::to_string(index);
+        const std::string keys = "-a" + std::to_string(index) + ",--argument-" + std::to_string(index);
+        const std::string help = "Benchmark argument number " + std::to_string(index) + " with a help string long enough to be copied";
+        switch (index % 4)
+        {
+            case 0:     parser.addKeyValue<int>(name, keys, help, 0);                                           break;
+            case 1:     parser.addKeyValue<std::vector<int>>(name, keys, help, {}, -8);                         break;
+            case 2:     parser.addKeyArgument(std::make_unique<varg<std::string>>(""), name, keys, help);       break;
+            default:    parser.addFlagArgument(std::make_unique<varg<bool>>(false, true), name, keys, help);    break;
+        }
+    }
+}
+
+/**
+ * @brief Build parserCount parsers with the given method and report the per parser cost
+ *
+ * @param methodName - Method name to print
+ * @param build      - Callable that builds one parser into the output slot
+ */
+template <typename Build> void measureBuild(const char* methodName, Build build)
+{
+    std::vector<std::optional<cmd_line_parse>> parserList(parserCount);
+
+    size_t startBytes = heapBytes;
+    size_t startBlocks = heapBlocks;
+    auto startTime = std::chrono::steady_clock::now();
+    for (auto& parser : parserList)
+    {
+        build(parser);
+    }
+    auto buildTime = std::chrono::steady_clock::now() - startTime;
+    size_t buildBytes = heapBytes - startBytes;
+    size_t buildBlocks = heapBlocks - startBlocks;
+
+    const double buildNs = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(buildTime).count()) / parserCount;
+    std::cout << std::left << std::setw(24) << methodName
+              << std::right << std::setw(14) << std::fixed << std::setprecision(1) << (static_cast<double>(buildBytes) / parserCount)
+              << std::setw(14) << (static_cast<double>(buildBlocks) / parserCount)
+              << std::setw(14) << buildNs << std::endl;
+}
+
+int main()
+{
+    std::cout << "Parser build cost, " << parserCount << " parsers of " << schemaArgCount << " arguments per method" << std::endl << std::endl;
+    std::cout << std::left << std::setw(24) << "method"
+              << std::right << std::setw(14) << "heap bytes"
+              << std::setw(14) << "heap blocks"
+              << std::setw(14) << "build ns" << std::endl;
+
+    measureBuild("build in place", [](std::optional<cmd_line_parse>& parser)
+                 {
+                     parser.emplace("benchmark [options]", "Parser build benchmark");
+                     buildSchema(*parser);
+                 });
+    measureBuild("build then move", [](std::optional<cmd_line_parse>& parser)
+                 {
+                     cmd_line_parse factoryParser("benchmark [options]", "Parser build benchmark");
+                     buildSchema(factoryParser);
+                     parser.emplace(std::move(factoryParser));
+                 });
+    measureBuild("build then move assign", [](std::optional<cmd_line_parse>& parser)
+                 {
+                     cmd_line_parse factoryParser("benchmark [options]", "Parser build benchmark");
+                     buildSchema(factoryParser);
+                     parser.emplace();
+                     *parser = std::move(factoryParser);
+                 });
+    measureBuild("build then copy", [](std::optional<cmd_line_parse>& parser)
+                 {
+                     cmd_line_parse factoryParser("benchmark [options]", "Parser build benchmark");
+                     buildSchema(factoryParser);
+                     parser.emplace(factoryParser);
+                 });
+
+    // Tenant clones of one base parser share its schema and add two arguments each
+    cmd_line_parse baseParser("benchmark [options]", "Parser build benchmark");
+    buildSchema(baseParser);
+    measureBuild("clone base plus 2", [&baseParser](std::optional<cmd_line_parse>& parser)
+                 {
+                     parser.emplace(baseParser);
+                     parser->addKeyValue<int>("tenant", "--tenant", "Tenant argument", 0);
+                     parser->addFlagValue("trace", "--trace", "Tenant flag argument");
+                 });
+    return 0;
+}
+
+/** @} */
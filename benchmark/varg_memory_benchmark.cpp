@@ -0,0 +1,136 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file varg_memory_benchmark.cpp
+ * @ingroup argparser_benchmark
+ * @defgroup Argument storage memory benchmark
+ * @{
+ */
+
+// Includes
+#include <cstdlib>
+#include <chrono>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include "varg.h"
+#include "listvarg.h"
+
+using namespace argparser;
+
+//======================================================================================
+// Heap allocation tracking
+//======================================================================================
+static size_t heapBytes = 0;        ///< Total number of bytes requested from operator new
+static size_t heapBlocks = 0;       ///< Total number of operator new calls
+
+void* operator new(size_t size)
+{
+    heapBytes += size;
+    heapBlocks++;
+    void* block = malloc((size != 0) ? size : 1);
+    if (block == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return block;
+}
+
+void operator delete(void* block) noexcept                          {free(block);}
+void operator delete(void* block, size_t /* size */) noexcept       {free(block);}
+
+//======================================================================================
+// Benchmark
+//======================================================================================
+constexpr size_t argumentCount = 10000;     ///< Number of argument objects to create per type
+
+/**
+ * @brief Create argumentCount argument objects, then render each type string and
+ *        report the per argument object and heap cost of each phase
+ *
+ * @param typeName - Type name to print
+ * @param create   - Callable that appends one new argument to the container
+ */
+template <typename ArgType, typename Create> void measureArgument(const char* typeName, Create create)
+{
+    std::deque<ArgType> argumentList;
+
+    size_t startBytes = heapBytes;
+    size_t startBlocks = heapBlocks;
+    auto startTime = std::chrono::steady_clock::now();
+    for (size_t index = 0; index < argumentCount; index++)
+    {
+        create(argumentList);
+    }
+    auto createTime = std::chrono::steady_clock::now() - startTime;
+    size_t createBytes = heapBytes - startBytes;
+    size_t createBlocks = heapBlocks - startBlocks;
+
+    // Render the help type strings
+    startBytes = heapBytes;
+    size_t typeStringLength = 0;
+    for (auto& argument : argumentList)
+    {
+        typeStringLength += std::char_traits<char>::length(argument.getTypeString());
+    }
+    size_t helpBytes = heapBytes - startBytes;
+
+    const double createNs = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(createTime).count()) / argumentCount;
+    std::cout << std::left << std::setw(24) << typeName
+              << std::right << std::setw(8) << sizeof(ArgType)
+              << std::setw(14) << std::fixed << std::setprecision(1) << (static_cast<double>(createBytes) / argumentCount)
+              << std::setw(14) << (static_cast<double>(createBlocks) / argumentCount)
+              << std::setw(14) << (static_cast<double>(helpBytes) / argumentCount)
+              << std::setw(14) << createNs
+              << std::setw(10) << (typeStringLength / argumentCount) << std::endl;
+}
+
+int main()
+{
+    std::cout << "Bytes per argument object, " << argumentCount << " objects per type" << std::endl;
+    std::cout << "  create heap bytes/blocks include the std::deque container blocks" << std::endl << std::endl;
+    std::cout << std::left << std::setw(24) << "type"
+              << std::right << std::setw(8) << "sizeof"
+              << std::setw(14) << "heap bytes"
+              << std::setw(14) << "heap blocks"
+              << std::setw(14) << "help bytes"
+              << std::setw(14) << "create ns"
+              << std::setw(10) << "type len" << std::endl;
+
+    measureArgument<varg<bool>>("varg<bool>", [](auto& argList) {argList.emplace_back(false, true);});
+    measureArgument<varg<char>>("varg<char>", [](auto& argList) {argList.emplace_back('a');});
+    measureArgument<varg<int>>("varg<int>", [](auto& argList) {argList.emplace_back(0);});
+    measureArgument<varg<int>>("varg<int> min/max", [](auto& argList) {argList.emplace_back(0, -10, 10);});
+    measureArgument<varg<long long unsigned>>("varg<ull>", [](auto& argList) {argList.emplace_back(0ULL);});
+    measureArgument<varg<double>>("varg<double>", [](auto& argList) {argList.emplace_back(0.0);});
+    measureArgument<varg<std::string>>("varg<string>", [](auto& argList) {argList.emplace_back("");});
+    measureArgument<listvarg<int>>("listvarg<int>", [](auto& argList) {argList.emplace_back();});
+    measureArgument<listvarg<double>>("listvarg<double>", [](auto& argList) {argList.emplace_back();});
+    measureArgument<listvarg<std::string>>("listvarg<string>", [](auto& argList) {argList.emplace_back();});
+    measureArgument<inlinelistvarg<int>>("inlinelistvarg<int>", [](auto& argList) {argList.emplace_back();});
+    return 0;
+}
+
+/** @} */
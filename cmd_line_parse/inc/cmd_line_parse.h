@@ -31,12 +31,16 @@
 // Includes
 #include <cstdlib>
 #include <cstdio>
+#include <initializer_list>
 #include <string>
+#include <string_view>
 #include <list>
+#include <memory>
 #include <vector>
 #include <iostream>
 #include "varg_intf.h"
 #include "parser_base.h"
+#include "parse_cache.h"
 
 namespace argparser
 {
@@ -49,10 +53,6 @@ namespace argparser
 class cmd_line_parse : public parser_base
 {
     private:
-        // Argument lists
-        std::list<ArgEntry>     positionalArgList;              ///< List of positional arguments
-        varg_intf*              helpFlag;                       ///< Default help flag
-
         // Help page text enhancements
         parserstr               programName;                    ///< Program name to display in the usage %(prog) field of the help message, default = argv[0]
         parserstr               usageText;                      ///< Text to display in the usage field of the help message, default = "%(prog) [options]"
@@ -73,10 +73,18 @@ class cmd_line_parse : public parser_base
         int                     parseingPositionNumber;         ///< Parseing position argument number
         int                     currentArgumentIndex;           ///< current argv array index being processed
         int                     argcount;                       ///< argc value from the parse call
-        std::vector<parserstr>  argvArray;                      ///< argv value from the parse call
+        std::pmr::vector<std::string_view> argvArray;           ///< argv strings from the parse call, held in the parse session arena
         int                     debugMsgLevel;                  ///< debugging message level
         parserstr               positionalStop;                 ///< Name of the positional argument to stop parsing on
         bool                    positionalStopArgumentFound;    ///< Flag to abort processing
+        bool                    fileSourceRead;                 ///< A value source file was read during the current parse
+        bool                    parseUncacheable;               ///< The parse result depends on more than argv, a glob directory was read
+        std::vector<validationItem> pendingValidations;         ///< Values queued for the argument validators
+        unsigned                validatorThreads;               ///< Maximum number of validator threads, 0 = hardware concurrency
+        unsigned                globThreads;                    ///< Maximum number of glob directory reader threads, 0 = hardware concurrency
+
+        // Parse result cache
+        std::unique_ptr<parse_cache> parseCache;                ///< Optional parse result cache, nullptr = disabled
 
         /**
          * @brief Test if the current command line argument is a key switch
@@ -97,6 +105,115 @@ class cmd_line_parse : public parser_base
          */
         void addDefaultHelpArgument();
 
+        /**
+         * @brief Check the argument setup and add it to the key argument list
+         *
+         * @param newKeyArg - Argument entry with the name, help, nargs, required and storage fields set
+         * @param argKeys   - Delimieted list of argument key values
+         */
+        void addKeyArgEntry(ArgEntry& newKeyArg, std::string_view argKeys);
+
+        /**
+         * @brief Check the argument setup and add it to the positional argument list
+         *
+         * @param newArg - Argument entry with the name, help, nargs, required and storage fields set
+         */
+        void addPositionalArgEntry(ArgEntry& newArg);
+
+        /**
+         * @brief Get the name of a bound field argument, the last key without the key prefix
+         *
+         * @param argKeys - Delimieted list of argument key values
+         *
+         * @return std::string_view - Argument name, a view of argKeys
+         */
+        std::string_view getBoundArgName(std::string_view argKeys);
+
+        /**
+         * @brief Get the argv index of the parse session argv string that holds a value
+         *
+         * @param valuePtr - Pointer into the parse session argv storage
+         *
+         * @return int - argv index or -1 if the pointer is not in the argv storage
+         */
+        int getArgvIndex(const char* valuePtr) const;
+
+        /**
+         * @brief Queue each value of a delimited value list for the argument validator
+         *
+         * @param currentArg  - Argument the values were assigned to
+         * @param valueString - Delimited value list, a view into the parse session argv storage
+         */
+        void queueValidation(const ArgEntry& currentArg, std::string_view valueString);
+
+        /**
+         * @brief Queue each value of a delimited value list for the argument validator
+         *
+         * @param currentArg  - Argument the values were assigned to
+         * @param valueString - Delimited value list, a view into the parse session memory
+         * @param argvIndex   - argv index reported for a failed value
+         */
+        void queueValidation(const ArgEntry& currentArg, std::string_view valueString, int argvIndex);
+
+        /**
+         * @brief Run the queued argument validators and report each failed value
+         */
+        void runPendingValidations();
+
+        /**
+         * @brief Expand and assign the values of a glob enabled positional argument.
+         *        Values without glob characters, and patterns that match nothing,
+         *        are assigned as given.  All values are expanded and counted before
+         *        any is assigned.
+         *
+         * @param currentArg      - Argument to set
+         * @param initialValue    - Delimited value list of the current argv string
+         * @param followingValues - Delimited value lists of the following argv strings
+         * @param valueCount      - Returned number of values assigned
+         * @param failedValue     - Value string that failed assignment
+         *
+         * @return eAssignmentReturn - Assignment return status
+         */
+        eAssignmentReturn assignGlobValues(ArgEntry& currentArg, std::string_view initialValue, const std::pmr::vector<std::string_view>& followingValues,
+                                           size_t& valueCount, parserstr& failedValue);
+
+        /**
+         * @brief Check if every argument uses the built in value storage, varg_intf
+         *        arguments are owned by the caller and can not be restored from the cache
+         *
+         * @return true  - Parse results can be cached
+         * @return false - One or more arguments use varg_intf storage, a bound field or a validator
+         */
+        bool isParseCacheable() const;
+
+        /**
+         * @brief Copy the value and found state of every argument
+         *
+         * @param snapshot - Returned key argument states followed by positional argument states
+         */
+        void saveArgState(std::vector<parse_cache::argSnapshot>& snapshot) const;
+
+        /**
+         * @brief Restore the value and found state of every argument
+         *
+         * @param snapshot - Key argument states followed by positional argument states
+         */
+        void restoreArgState(const std::vector<parse_cache::argSnapshot>& snapshot);
+
+        /**
+         * @brief Remove the cached parse results and capture the current argument
+         *        state as the state every cached parse starts from
+         */
+        void resetParseCache();
+
+        /**
+         * @brief Check if the default help flag was set during parsing
+         *
+         * @return true  - Help flag was found
+         * @return false - Help flag was not found or the default help argument is not in use
+         */
+        bool isHelpFlagSet() const;
+
         /**
          * @brief Find the argument object that matches the input string
          *
@@ -105,41 +222,40 @@ class cmd_line_parse : public parser_base
          *
          * @return ArgEntry - Reference to the ArgEntry from the ArgEntry if match was found. Or nullptr if not.
          */
-        ArgEntry& findMatchingArg(const parserstr& keystring, bool& found);
+        ArgEntry& findMatchingArg(std::string_view keystring, bool& found);
 
         /**
-         * @brief Get the Initial Value List object
+         * @brief Get the initial delimited value list string, either the embedded value
+         *        string or the next argument if there is no embedded value
          *
-         * @param valueInput - delimited list of value data
-         * @param valueList  - Reference to the current value string list
+         * @param valueString - Embedded value string view if present, else empty view
          *
-         * @return size_t - number of elements in the list
+         * @return std::string_view - Initial delimited value list string, a view into the parse session argv storage
          */
-        size_t getInitialValueList(parserstr& valueString, std::list<parserstr>& valueList);
-        size_t getInitialValueList(const char* valueString, std::list<parserstr>& valueList);
+        std::string_view getInitialValue(std::string_view valueString);
 
         /**
          * @brief Assign the flag value to the key argument
          *
          * @param currentArg - Pointer to the argument to set
          * @param keyString  - Key value that was matched
-         * @param valueString - Reference to the embedded value string if present, else empty string
+         * @param valueString - Embedded value string view if present, else empty view
          *
          * @ * @ingroup argparser
 eturn bool - False = assignment worked, true = assignment failed
          */
-        bool assignKeyFlagValue(ArgEntry& currentArg, const char* keyString, parserstr& valueString);
+        bool assignKeyFlagValue(ArgEntry& currentArg, const char* keyString, std::string_view valueString);
 
         /**
          * @brief Assign multiple values to a list argument storeage.
          *
          * @param currentArg - Pointer to the argument to set
          * @param keyString  - Key value that was matched
-         * @param valueString - Reference to the embedded value string if present, else empty string
+         * @param valueString - Embedded value string view if present, else empty view
          *
          * @return bool - False = assignment worked, true = assignment failed
          */
-        bool assignKeyValue(ArgEntry& currentArg, const char* keyString, parserstr& valueString);
+        bool assignKeyValue(ArgEntry& currentArg, const char* keyString, std::string_view valueString);
 
         /**
          * @brief Parse a single key argument
@@ -147,7 +263,7 @@ eturn bool - False = assignment worked, true = assignment failed
          * @param searchString - Key argument value to find and set
          * @param valueString - Value string from the argument or empty string
          */
-        void parseSingleKeyArg(const char* searchString, parserstr valueString);
+        void parseSingleKeyArg(const char* searchString, std::string_view valueString);
 
     protected:
 
@@ -298,6 +414,79 @@ eturn bool - False = assignment worked, true = assignment failed
          */
         void enableUnknowArgumentIgnore()                               {ignoreUnknownKey = true;}
 
+        /**
+         * @brief Set the value validator of an argument.  After the command line is tokenized
+         *        parse() runs the validator for every value assigned to the argument on a pool
+         *        of worker threads.  Each failed value is reported with its argv index and sets
+         *        the parsing error.  Values read from a value source file are not validated.
+         *
+         * @param name      - Argument name
+         * @param validator - Value validator, must be safe to call from several threads
+         *
+         * @return true  - Validator was set
+         * @return false - No argument has the name
+         */
+        bool setArgValidator(const parserstr& name, argValidator validator);
+
+        /**
+         * @brief Use the built in readable path validator for an argument, see parser_base::isReadablePath()
+         *
+         * @param name - Argument name
+         *
+         * @return true  - Validator was set
+         * @return false - No argument has the name
+         */
+        bool setPathValidator(const parserstr& name)                    {return setArgValidator(name, parser_base::isReadablePath);}
+
+        /**
+         * @brief Set the maximum number of argument validator threads
+         *
+         * @param maxThreads - Maximum number of threads, 0 = hardware concurrency, 1 = validate on the calling thread
+         */
+        void setValidatorThreads(unsigned maxThreads)                   {validatorThreads = maxThreads;}
+
+        /**
+         * @brief Set the maximum number of positional argument glob directory reader threads
+         *
+         * @param maxThreads - Maximum number of threads, 0 = hardware concurrency, 1 = read on the calling thread
+         */
+        void setGlobThreads(unsigned maxThreads)                        {globThreads = maxThreads;}
+
+        /**
+         * @brief Enable the parse result cache.  A parse() call with the same argv tokens,
+         *        index range and schema version as a cached call restores the saved argument
+         *        values instead of parsing again.  While the cache is enabled every parse
+         *        starts from the argument values at the time the cache was enabled.
+         *
+         *        Only parsers that use the built in value storage are cached, parsers with
+         *        varg_intf arguments or validators and parses that read a value source file
+         *        are always parsed.  Failed parses are not cached.
+         *
+         * @param maxEntries    - Maximum number of cached parse results
+         * @param schemaVersion - Version included in every cache key
+         */
+        void enableParseCache(size_t maxEntries, uint64_t schemaVersion = 0);
+
+        /**
+         * @brief Disable the parse result cache and release the cached results
+         */
+        void disableParseCache()                                        {parseCache.reset();}
+
+        /**
+         * @brief Set the schema version included in every cache key, the cached results
+         *        are removed if the version changes
+         *
+         * @param schemaVersion - New schema version
+         */
+        void setParseCacheSchemaVersion(uint64_t schemaVersion);
+
+        /**
+         * @brief Get the parse cache hit and miss counters
+         *
+         * @return const parseCacheStats* - Cache counters or nullptr if the cache is disabled
+         */
+        const parseCacheStats* getParseCacheStats() const               {return ((parseCache != nullptr) ? &parseCache->getStats() : nullptr);}
+
         //=================================================================================================
         //======================= Argument add interface methods ==========================================
         //=================================================================================================
@@ -317,7 +506,7 @@ eturn bool - False = assignment worked, true = assignment failed
          *                       are found it is flagged as an error
          * @param required - True if argument is required, false if arguemnt is optional
          */
-        void addKeyArgument(varg_intf* arg, parserstr name, parserstr argKeys, parserstr helpText, int nargs = 1, bool required = false);
+        void addKeyArgument(varg_intf* arg, std::string_view name, std::string_view argKeys, std::string_view helpText, int nargs = 1, bool required = false);
 
         /**
          * @brief Add a new key based flag command line argument to the argument list
@@ -328,7 +517,7 @@ eturn bool - False = assignment worked, true = assignment failed
          * @param helpText - Help text to be printed in the help message
          * @param required - True if argument is required, false if arguemnt is optional
          */
-        void addFlagArgument(varg_intf* arg, parserstr name, parserstr argKeys, parserstr helpText, bool required = false);
+        void addFlagArgument(varg_intf* arg, std::string_view name, std::string_view argKeys, std::string_view helpText, bool required = false);
 
         /**
          * @brief Add a new positinal based command line argument to the argument list
@@ -344,8 +533,279 @@ eturn bool - False = assignment worked, true = assignment failed
          *                  -N : List argument with up to N arguments, if more than N arguments
          *                       are found it is flagged as an error
          * @param required - True if argument is required, false if arguemnt is optional
+         * @param globMode - Expand file path glob patterns in the values, for callers
+         *                   that are not started from a shell
          */
-        void addPositionalArgument(varg_intf* arg, parserstr name, parserstr helpText, int nargs = 1, bool required = false);
+        void addPositionalArgument(varg_intf* arg, std::string_view name, std::string_view helpText, int nargs = 1, bool required = false, globMode_e globMode = GLOB_DISABLED_e);
+
+        /**
+         * @brief Add a new key based command line argument owned by the parser.  Copies of the
+         *        parser share the argument object and moving the parser does not move it.
+         *
+         * @param arg      - Argument object to take ownership of
+         * @param name     - Human name used in the help messages
+         * @param argKeys  - Delimieted list of argument key values
+         * @param helpText - Help text to be printed in the help message
+         * @param nargs    - Number of argument values that follow, see addKeyArgument()
+         * @param required - True if argument is required, false if arguemnt is optional
+         *
+         * @return T* - Pointer to the owned argument object, valid while a parser using it exists
+         */
+        template <typename T> T* addKeyArgument(std::unique_ptr<T> arg, std::string_view name, std::string_view argKeys, std::string_view helpText, int nargs = 1, bool required = false)
+        {
+            T* ownedArg = arg.get();
+            addKeyArgument(adoptArgument(std::move(arg)), name, argKeys, helpText, nargs, required);
+            return ownedArg;
+        }
+
+        /**
+         * @brief Add a new key based flag command line argument owned by the parser
+         *
+         * @param arg      - Argument object to take ownership of
+         * @param name     - Human name used in the help messages
+         * @param argKeys  - Delimieted list of argument key values
+         * @param helpText - Help text to be printed in the help message
+         * @param required - True if argument is required, false if arguemnt is optional
+         *
+         * @return T* - Pointer to the owned argument object, valid while a parser using it exists
+         */
+        template <typename T> T* addFlagArgument(std::unique_ptr<T> arg, std::string_view name, std::string_view argKeys, std::string_view helpText, bool required = false)
+        {
+            T* ownedArg = arg.get();
+            addFlagArgument(adoptArgument(std::move(arg)), name, argKeys, helpText, required);
+            return ownedArg;
+        }
+
+        /**
+         * @brief Add a new positinal based command line argument owned by the parser
+         *
+         * @param arg      - Argument object to take ownership of
+         * @param name     - Name of the argument
+         * @param helpText - Help text to be printed in the help message
+         * @param nargs    - Number of argument values that follow, see addPositionalArgument()
+         * @param required - True if argument is required, false if arguemnt is optional
+         * @param globMode - Expand file path glob patterns in the values, see addPositionalArgument()
+         *
+         * @return T* - Pointer to the owned argument object, valid while a parser using it exists
+         */
+        template <typename T> T* addPositionalArgument(std::unique_ptr<T> arg, std::string_view name, std::string_view helpText, int nargs = 1, bool required = false,
+                                                       globMode_e globMode = GLOB_DISABLED_e)
+        {
+            T* ownedArg = arg.get();
+            addPositionalArgument(adoptArgument(std::move(arg)), name, helpText, nargs, required, globMode);
+            return ownedArg;
+        }
+
+        /**
+         * @brief Add a new key based command line argument that uses the built in value storage
+         *
+         * @tparam T           - Value type, one of the argValue_t alternatives.  Use std::vector<E> for a list.
+         * @param name         - Human name used in the help messages and the getValue() lookup
+         * @param argKeys      - Delimieted list of argument key values
+         * @param helpText     - Help text to be printed in the help message
+         * @param defaultValue - Initial value
+         * @param nargs        - Number of argument values that follow, see addKeyArgument()
+         * @param required     - True if argument is required, false if arguemnt is optional
+         */
+        template <typename T> void addKeyValue(std::string_view name, std::string_view argKeys, std::string_view helpText, T defaultValue, int nargs = 1, bool required = false)
+        {
+            ArgEntry newKeyArg = {};
+            newKeyArg.name = name;
+            newKeyArg.help = helpText;
+            newKeyArg.argData = nullptr;
+            newKeyArg.nargs = nargs;
+            newKeyArg.isRequired = required;
+            newKeyArg.valueStore = argValueStore::create<T>(std::move(defaultValue));
+            addKeyArgEntry(newKeyArg, argKeys);
+        }
+
+        /**
+         * @brief Add a new key based flag command line argument that uses the built in value storage
+         *
+         * @param name         - Human name used in the help messages and the getValue() lookup
+         * @param argKeys      - Delimieted list of argument key values
+         * @param helpText     - Help text to be printed in the help message
+         * @param defaultValue - Initial flag value, the flag key sets the inverse value
+         * @param required     - True if argument is required, false if arguemnt is optional
+         */
+        void addFlagValue(std::string_view name, std::string_view argKeys, std::string_view helpText, bool defaultValue = false, bool required = false);
+
+        /**
+         * @brief Add a new positinal based command line argument that uses the built in value storage
+         *
+         * @tparam T           - Value type, one of the argValue_t alternatives.  Use std::vector<E> for a list.
+         * @param name         - Name of the argument, used for the getValue() lookup
+         * @param helpText     - Help text to be printed in the help message
+         * @param defaultValue - Initial value
+         * @param nargs        - Number of argument values that follow, see addPositionalArgument()
+         * @param required     - True if argument is required, false if arguemnt is optional
+         * @param globMode     - Expand file path glob patterns in the values, see addPositionalArgument()
+         */
+        template <typename T> void addPositionalValue(std::string_view name, std::string_view helpText, T defaultValue, int nargs = 1, bool required = false,
+                                                      globMode_e globMode = GLOB_DISABLED_e)
+        {
+            ArgEntry newArg = {};
+            newArg.name = name;
+            newArg.help = helpText;
+            newArg.argData = nullptr;
+            newArg.nargs = nargs;
+            newArg.isRequired = required;
+            newArg.valueStore = argValueStore::create<T>(std::move(defaultValue));
+            newArg.globMode = globMode;
+            addPositionalArgEntry(newArg);
+        }
+
+        /**
+         * @brief Default nargs value of a bound field type: a bool field is a flag, a
+         *        std::vector field takes any number of values, else a single value
+         */
+        template <typename T> static constexpr int boundFieldNargs = (std::is_same_v<T, bool> ? 0 : (isFieldList<T>::value ? -1 : 1));
+
+        /**
+         * @brief Element type of a bound field, the value_type of a std::vector field
+         */
+        template <typename T> struct boundFieldElement                          {using type = T;};
+        template <typename E> struct boundFieldElement<std::vector<E>>          {using type = E;};
+
+        /**
+         * @brief Add a new key based command line argument that converts straight into a
+         *        field of a user structure.  Copies of the parser set the same field.
+         *
+         * @tparam S       - Structure type
+         * @tparam T       - Field type: numeric, char, bool, std::string or a std::vector of one of them
+         * @param target   - Structure to fill, must outlive the parser
+         * @param field    - Pointer to the structure member
+         * @param argKeys  - Delimieted list of argument key values, the last key without the prefix is the argument name
+         * @param helpText - Help text to be printed in the help message
+         * @param nargs    - Number of argument values that follow, see addKeyArgument().  Default: flag for bool,
+         *                   any number of values for a std::vector, else one value.
+         * @param required - True if argument is required, false if arguemnt is optional
+         */
+        template <typename S, typename T> void bindKeyArgument(S& target, T S::* field, std::string_view argKeys, std::string_view helpText,
+                                                               int nargs = boundFieldNargs<T>, bool required = false)
+        {
+            ArgEntry newKeyArg = {};
+            newKeyArg.name = getBoundArgName(argKeys);
+            newKeyArg.help = helpText;
+            newKeyArg.argData = nullptr;
+            newKeyArg.nargs = nargs;
+            newKeyArg.isRequired = required;
+            newKeyArg.binding = fieldBinding::create<T>(target.*field);
+            addKeyArgEntry(newKeyArg, argKeys);
+        }
+
+        /**
+         * @brief Add a new key based command line argument that converts value names straight
+         *        into an enum field, or a std::vector of enum field, of a user structure
+         *
+         * @tparam S       - Structure type
+         * @tparam T       - Field type, an enum or a std::vector of an enum
+         * @param target   - Structure to fill, must outlive the parser
+         * @param field    - Pointer to the structure member
+         * @param argKeys  - Delimieted list of argument key values, the last key without the prefix is the argument name
+         * @param helpText - Help text to be printed in the help message
+         * @param nameList - Value names and values, the first value of a repeated name is kept
+         * @param nargs    - Number of argument values that follow, see bindKeyArgument()
+         * @param required - True if argument is required, false if arguemnt is optional
+         */
+        template <typename S, typename T> void bindEnumKeyArgument(S& target, T S::* field, std::string_view argKeys, std::string_view helpText,
+                                                                   std::initializer_list<std::pair<std::string_view, typename boundFieldElement<T>::type>> nameList,
+                                                                   int nargs = boundFieldNargs<T>, bool required = false)
+        {
+            static_assert(std::is_enum_v<typename boundFieldElement<T>::type>, "bindEnumKeyArgument requires an enum field");
+            enumFieldNameList enumNames;
+            enumNames.reserve(nameList.size());
+            for (auto const& enumEntry : nameList)
+            {
+                enumNames.push_back({parser_base::storeSchemaString(enumEntry.first), static_cast<long long int>(enumEntry.second)});
+            }
+
+            ArgEntry newKeyArg = {};
+            newKeyArg.name = getBoundArgName(argKeys);
+            newKeyArg.help = helpText;
+            newKeyArg.argData = nullptr;
+            newKeyArg.nargs = nargs;
+            newKeyArg.isRequired = required;
+            newKeyArg.binding = fieldBinding::create<T>(target.*field);
+            newKeyArg.binding.setEnumNames(std::move(enumNames));
+            addKeyArgEntry(newKeyArg, argKeys);
+        }
+
+        /**
+         * @brief Field registration helper for one structure, see bindTo()
+         */
+        template <typename S> class fieldBinder
+        {
+            private:
+                cmd_line_parse&     parser;     ///< Parser to add the arguments to
+                S&                  target;     ///< Structure to fill
+
+            public:
+                fieldBinder(cmd_line_parse& parser, S& target) : parser(parser), target(target) {}
+
+                /**
+                 * @brief Bind a field to a key argument, see bindKeyArgument()
+                 *
+                 * @return fieldBinder& - This binder for chained calls
+                 */
+                template <typename T> fieldBinder& bind(T S::* field, std::string_view argKeys, std::string_view helpText,
+                                                        int nargs = boundFieldNargs<T>, bool required = false)
+                {
+                    parser.bindKeyArgument(target, field, argKeys, helpText, nargs, required);
+                    return *this;
+                }
+
+                /**
+                 * @brief Bind an enum field to a key argument, see bindEnumKeyArgument()
+                 *
+                 * @return fieldBinder& - This binder for chained calls
+                 */
+                template <typename T> fieldBinder& bindEnum(T S::* field, std::string_view argKeys, std::string_view helpText,
+                                                            std::initializer_list<std::pair<std::string_view, typename boundFieldElement<T>::type>> nameList,
+                                                            int nargs = boundFieldNargs<T>, bool required = false)
+                {
+                    parser.bindEnumKeyArgument(target, field, argKeys, helpText, nameList, nargs, required);
+                    return *this;
+                }
+        };
+
+        /**
+         * @brief Get a field registration helper for a structure, for example
+         *        parser.bindTo(config).bind(&config_t::threads, "-t,--threads", "Worker thread count");
+         *
+         * @param target - Structure to fill, must outlive the parser
+         *
+         * @return fieldBinder<S> - Registration helper
+         */
+        template <typename S> fieldBinder<S> bindTo(S& target)                  {return fieldBinder<S>(*this, target);}
+
+        /**
+         * @brief Get the value of an argument that uses the built in value storage
+         *
+         * @tparam T   - Value type the argument was added with
+         * @param name - Argument name
+         *
+         * @return const T* - Pointer to the value, nullptr if the name was not found or the type does not match
+         */
+        template <typename T> const T* getValue(const parserstr& name) const
+        {
+            for (auto const& keyArg : parser_base::getKeyArgList())
+            {
+                if (keyArg.name == name)
+                {
+                    return keyArg.valueStore.template getValue<T>();
+                }
+            }
+
+            for (auto const& positionalArg : parser_base::getPositionalArgList())
+            {
+                if (positionalArg.name == name)
+                {
+                    return positionalArg.valueStore.template getValue<T>();
+                }
+            }
+            return nullptr;
+        }
 
         //=================================================================================================
         //======================= Commandline parser interface methods ====================================
@@ -372,6 +832,16 @@ eturn bool - False = assignment worked, true = assignment failed
         int parse(int argc, char* argv[], int startingArgIndex = 1, int endingArgIndex = -1);
 //#pragma clang diagnostic pop
 
+        /**
+         * @brief Convert and check every deferred argument value now, reporting each
+         *        invalid value.  Lazily converted arguments (varglazy) otherwise only
+         *        convert on the first value access.
+         *
+         * @return true  - All argument values are valid
+         * @return false - One or more argument values are invalid, the parsing error is set
+         */
+        bool validateAll();
+
         /**
          * @brief Print the formatted option help message to the input stream
          *
@@ -392,6 +862,23 @@ eturn bool - False = assignment worked, true = assignment failed
          * @param outStream - Output streem to use for text output.  Default is the standard error stream
          */
         void displayHelp(std::ostream &outStream = std::cerr);
+
+        /**
+         * @brief Get the heap memory held by the parser by category, adds the positional
+         *        arguments, help text, validation queue and parse result cache to the
+         *        parser_base::memoryUsage() report
+         *
+         * @return memoryUsageReport - Heap bytes and blocks per category
+         */
+        memoryUsageReport memoryUsage() const;
+
+        /**
+         * @brief Print the memory usage report
+         *
+         * @param outStream   - Output stream for the report.  Default is the standard error stream
+         * @param perArgument - True to add a line for each key and positional argument
+         */
+        void displayMemoryUsage(std::ostream &outStream = std::cerr, bool perArgument = false) const;
 };
 
 }; // end of namespace argparser
@@ -0,0 +1,181 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file parse_cache.h
+ * @ingroup libcmd_line_parser
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "arg_value_store.h"
+
+namespace argparser
+{
+
+/**
+ * @brief Parse cache hit and miss counters
+ */
+struct parseCacheStats
+{
+    size_t      hits;           ///< Number of parse calls restored from the cache
+    size_t      misses;         ///< Number of cacheable parse calls that were not in the cache
+    size_t      evictions;      ///< Number of entries removed to stay within the entry limit
+};
+
+/**
+ * @brief Bounded least recently used cache of whole command line parse results.
+ *
+ * Entries are keyed by the argv tokens and a schema version.  Each entry keeps
+ * the converted value and found flag of every argument so a hit restores the
+ * parse result without converting the values again.
+ */
+class parse_cache
+{
+    public:
+        /**
+         * @brief Saved state of one argument
+         */
+        struct argSnapshot
+        {
+            argValueStore   value;          ///< Converted argument value
+            bool            isFound;        ///< Argument found flag
+        };
+
+        /**
+         * @brief Saved parse result
+         */
+        struct cacheEntry
+        {
+            std::string                 key;                ///< Parse key, see buildKey()
+            int                         returnValue;        ///< parse() return value
+            int                         parsePosition;      ///< Next positional argument number
+            bool                        positionalStop;     ///< Positional stop argument was found
+            std::vector<argSnapshot>    args;               ///< Key arguments followed by positional arguments
+        };
+
+    private:
+        /**
+         * @brief FNV-1a hash of a parse key
+         */
+        struct keyHash
+        {
+            size_t operator()(std::string_view key) const       {return static_cast<size_t>(parse_cache::hashKey(key));}
+        };
+
+        std::list<cacheEntry>                                                               lruList;        ///< Entries, most recently used first
+        std::unordered_map<std::string_view, std::list<cacheEntry>::iterator, keyHash>      entryIndex;     ///< Key to entry index, keys are views of cacheEntry::key
+        size_t                                                                              maxEntries;     ///< Entry limit
+        uint64_t                                                                            schemaVersion;  ///< Schema version included in every key
+        std::vector<argSnapshot>                                                            defaultArgs;    ///< Argument state every cached parse starts from
+        parseCacheStats                                                                     stats;          ///< Hit and miss counters
+
+    public:
+        /**
+         * @brief Construct an empty parse cache
+         *
+         * @param entryLimit - Maximum number of cached parse results
+         * @param version    - Schema version included in every key
+         */
+        parse_cache(size_t entryLimit, uint64_t version = 0);
+
+        /**
+         * @brief Compute the 64 bit FNV-1a hash of a parse key
+         *
+         * @param key - Parse key
+         *
+         * @return uint64_t - Key hash
+         */
+        static uint64_t hashKey(std::string_view key);
+
+        /**
+         * @brief Build the parse key for a parse call
+         *
+         * @param argc             - Number of char pointers in the argv[] array
+         * @param argv             - Array of command line text entries
+         * @param startingArgIndex - argv index to start parsing arguments
+         * @param endingArgIndex   - argv index to stop parsing arguments
+         * @param key              - Returned parse key
+         */
+        void buildKey(int argc, char* argv[], int startingArgIndex, int endingArgIndex, std::string& key) const;
+
+        /**
+         * @brief Find a parse result and mark it most recently used.  Updates the hit and miss counters.
+         *
+         * @param key - Parse key
+         *
+         * @return const cacheEntry* - Cached parse result or nullptr if the key is not cached
+         */
+        const cacheEntry* find(const std::string& key);
+
+        /**
+         * @brief Add a parse result, evicting the least recently used entry if the cache is full
+         *
+         * @param entry - Parse result to add
+         */
+        void insert(cacheEntry&& entry);
+
+        /**
+         * @brief Remove all entries, the counters are not reset
+         */
+        void clear();
+
+        /**
+         * @brief Set the schema version, all entries are removed if it changes
+         *
+         * @param version - New schema version
+         */
+        void setSchemaVersion(uint64_t version);
+
+        /**
+         * @brief Set the argument state every parse starts from, all entries are removed
+         *
+         * @param defaults - Key argument states followed by positional argument states
+         */
+        void setDefaults(std::vector<argSnapshot>&& defaults);
+
+        /**
+         * @brief Get the heap memory held by the cached results, the default
+         *        argument state and an estimate of the key index
+         *
+         * @return heapUsage - Heap bytes and blocks held by the cache
+         */
+        heapUsage getHeapUsage() const;
+
+        const std::vector<argSnapshot>& getDefaults() const     {return defaultArgs;}       ///< @brief Argument state every cached parse starts from
+        size_t                  size() const                    {return lruList.size();}    ///< @brief Number of cached parse results
+        const parseCacheStats&  getStats() const                {return stats;}             ///< @brief Hit and miss counters
+};
+
+}; // end of namespace argparser
+
+/** @} */
@@ -0,0 +1,819 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file static_cmd_line_parse.h
+ * @ingroup libcmd_line_parser
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string_view>
+#include "varg_intf.h"
+#include "parser_base.h"
+
+namespace argparser
+{
+
+/**
+ * @brief Fixed capacity parser error types
+ */
+enum staticParseError_e
+{
+    STATIC_ERROR_TABLE_FULL_e = 0,      ///< Registration failed, the argument or key table is full
+    STATIC_ERROR_NOT_LIST_e,            ///< Registration failed, more than one value needs list storage
+    STATIC_ERROR_UNKNOWN_KEY_e,         ///< Key is not in the key table
+    STATIC_ERROR_EXTRA_VALUE_e,         ///< Positional value with no positional argument left to take it
+    STATIC_ERROR_FLAG_VALUE_e,          ///< Value assigned to a flag argument
+    STATIC_ERROR_NO_VALUE_e,            ///< Argument needs at least one value
+    STATIC_ERROR_TOO_FEW_e,             ///< Fewer values than the argument requires
+    STATIC_ERROR_TOO_MANY_e,            ///< More values than the argument allows
+    STATIC_ERROR_ASSIGN_FAILED_e,       ///< Value conversion failed
+    STATIC_ERROR_MISSING_e,             ///< Required argument was not found
+};
+
+/**
+ * @brief Fixed capacity parser error record.  The text views point into the
+ *        registration strings or the parsed argv strings.
+ */
+struct staticParseError
+{
+    staticParseError_e  error;          ///< Error type
+    int                 argvIndex;      ///< argv index of the failing token, -1 for registration and missing argument errors
+    std::string_view    text;           ///< Key, argument name or value the error refers to
+    std::string_view    value;          ///< Failed value for STATIC_ERROR_ASSIGN_FAILED_e
+    int                 expected;       ///< Required value count, nargs or table capacity
+    size_t              found;          ///< Number of values found
+};
+
+/**
+ * @brief Command line parser with fixed capacity tables, for programs that may
+ *        not allocate after startup.
+ *
+ * The argument table, key table and error records are arrays sized by the
+ * template parameters and the registration strings are kept as views, so they
+ * must stay valid for the life of the parser, typically string literals.
+ * Adding an argument that does not fit is a registration error and every
+ * later parse() call fails until the parser is rebuilt.
+ *
+ * parse() makes no heap allocation and runs in O(argc x maxKeys x key length)
+ * time.  Errors are recorded, not printed, displayErrors() formats them
+ * afterwards.  Borrowing argument types keep views of the argv strings, and the
+ * value storage is the supplied varg_intf object, so a zero allocation parse
+ * also needs storage types that do not allocate, varg<T> of a numeric type,
+ * vargview or an inlinelistvarg within its inline capacity.
+ *
+ * @tparam maxArgs   - Maximum number of key and positional arguments, including the default help flag
+ * @tparam maxKeys   - Maximum number of argument keys
+ * @tparam maxErrors - Maximum number of recorded parse errors, later errors are only counted
+ */
+template <size_t maxArgs, size_t maxKeys = 2 * maxArgs, size_t maxErrors = 8> class static_cmd_line_parse
+{
+    private:
+        /**
+         * @brief Argument table entry
+         */
+        struct staticArgEntry
+        {
+            std::string_view    name;           ///< Argument name
+            std::string_view    help;           ///< Help description string
+            varg_intf*          argData;        ///< Argument storage object, nullptr for the default help flag
+            int                 nargs;          ///< Number of argument data values expected
+            int                 position;       ///< Positional argument position index, 0 for key arguments
+            bool                isRequired;     ///< True if this is a required argument
+            bool                isFound;        ///< True if the argument was found by the last parse
+        };
+
+        /**
+         * @brief Key table entry
+         */
+        struct staticKeyEntry
+        {
+            std::string_view    key;            ///< Key string
+            size_t              argIndex;       ///< Argument table index of the key argument
+        };
+
+        std::array<staticArgEntry, maxArgs>             argTable;           ///< Key and positional arguments in registration order
+        std::array<staticKeyEntry, maxKeys>             keyTable;           ///< Argument keys in registration order
+        std::array<staticParseError, maxErrors>         errorList;          ///< Errors of the last parse
+        size_t                                          argCount;           ///< Number of argTable entries used
+        size_t                                          keyCount;           ///< Number of keyTable entries used
+        size_t                                          errorCount;         ///< Number of errorList entries used
+        size_t                                          droppedErrorCount;  ///< Errors that did not fit in errorList
+        staticParseError                                registrationErrorRecord;    ///< First registration error
+        size_t                                          registrationErrorCount;     ///< Number of failed registrations
+
+        std::string_view        usageText;                  ///< Text to display in the usage field of the help message
+        std::string_view        descriptionText;            ///< Text to display in the description field of the help message
+        std::string_view        keyPrefix;                  ///< Key prefix characters, default = "-"
+        parserchar              keyListDelimiter;           ///< Registration key list delimiter, default = ','
+        parserchar              assignmentDelimiter;        ///< Argument key, Value delimiter, default = '='
+        parserchar              assignmentListDelimiter;    ///< Value list delimiter, default = ','
+        bool                    errorAbort;                 ///< True = Stop parsing at the first error
+        bool                    helpFlag;                   ///< Default help flag value
+        int                     positionNumber;             ///< Position of the next positional argument added
+
+        // Parse session state
+        char**                  argvList;                   ///< argv of the current parse
+        int                     currentArgumentIndex;       ///< Index of the next argv string
+        int                     argcount;                   ///< Index following the last argv string to parse
+        int                     parsingPositionNumber;      ///< Position of the next positional value
+
+        /**
+         * @brief Record a registration error, only the first one is kept
+         */
+        eAddStatusReturn addRegistrationError(staticParseError_e error, std::string_view name, int expected)
+        {
+            if (registrationErrorCount++ == 0)
+            {
+                registrationErrorRecord = {error, -1, name, std::string_view(), expected, 0};
+            }
+            return ((error == STATIC_ERROR_NOT_LIST_e) ? eAddArgNotList : eAddArgTableFull);
+        }
+
+        /**
+         * @brief Record a parse error, errors beyond maxErrors are only counted
+         */
+        void addError(const staticParseError& newError)
+        {
+            if (errorCount < maxErrors)
+            {
+                errorList[errorCount++] = newError;
+            }
+            else
+            {
+                droppedErrorCount++;
+            }
+        }
+
+        /**
+         * @brief Remove the leading and trailing spaces of a key
+         */
+        static std::string_view trimKey(std::string_view key)
+        {
+            while (!key.empty() && (' ' == key.front()))
+            {
+                key.remove_prefix(1);
+            }
+            while (!key.empty() && (' ' == key.back()))
+            {
+                key.remove_suffix(1);
+            }
+            return key;
+        }
+
+        /**
+         * @brief Check if an argv string starts with a key prefix character
+         */
+        bool isKeySwitch(int argIndex) const
+        {
+            return (std::string_view::npos != keyPrefix.find(argvList[argIndex][0]));
+        }
+
+        /**
+         * @brief Count the elements of a delimited value list, strips the leading assignment delimiter
+         */
+        size_t countValueList(std::string_view& valueString) const
+        {
+            size_t elementCount = 0;
+            if (!valueString.empty())
+            {
+                if (valueString[0] == assignmentDelimiter)
+                {
+                    valueString.remove_prefix(1);
+                }
+
+                for (size_t pos = 0; pos < valueString.length(); pos++)
+                {
+                    pos = valueString.find(assignmentListDelimiter, pos);
+                    elementCount++;
+                    if (pos == std::string_view::npos)
+                    {
+                        break;
+                    }
+                }
+            }
+            return elementCount;
+        }
+
+        /**
+         * @brief Check the number of values against the argument nargs value
+         *
+         * @return bool - True if the count is acceptable, else countError is set
+         */
+        static bool checkValueCount(const staticArgEntry& currentArg, size_t valueCount, staticParseError_e& countError)
+        {
+            auto requiredValueCount = static_cast<size_t>(abs(currentArg.nargs));
+            if (valueCount == 0)
+            {
+                countError = STATIC_ERROR_NO_VALUE_e;
+            }
+            else if ((valueCount > requiredValueCount) && (currentArg.nargs != -1))
+            {
+                countError = STATIC_ERROR_TOO_MANY_e;
+            }
+            else if (static_cast<int>(valueCount) < currentArg.nargs)
+            {
+                countError = STATIC_ERROR_TOO_FEW_e;
+            }
+            else
+            {
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Assign the values of a delimited value list string
+         *
+         * @return bool - True if every value was assigned, else failedValue is the failing element
+         */
+        bool assignDelimitedValues(staticArgEntry& currentArg, std::string_view valueString, std::string_view& failedValue) const
+        {
+            size_t failedIndex = 0;
+            if (valueParseStatus_e::PARSE_SUCCESS_e == currentArg.argData->setValueBuffer(valueString.data(), valueString.size(), assignmentListDelimiter, failedIndex))
+            {
+                return true;
+            }
+
+            failedValue = valueString;
+            for (size_t index = 0; index < failedIndex; index++)
+            {
+                size_t pos = failedValue.find(assignmentListDelimiter);
+                failedValue.remove_prefix((pos != std::string_view::npos) ? (pos + 1) : failedValue.size());
+            }
+            failedValue = failedValue.substr(0, failedValue.find(assignmentListDelimiter));
+            return false;
+        }
+
+        /**
+         * @brief Collect and assign the values of a key or positional argument
+         *
+         * @param currentArg  - Argument to set
+         * @param keyString   - Key or argument name used in the error record
+         * @param valueString - Embedded value string if present, else empty view
+         * @param keyIndex    - argv index of the key or first value
+         */
+        void assignValue(staticArgEntry& currentArg, std::string_view keyString, std::string_view valueString, int keyIndex)
+        {
+            // The initial value is the embedded value or the next argv string
+            std::string_view initialValue = valueString;
+            if (initialValue.empty() && (currentArgumentIndex < argcount))
+            {
+                initialValue = argvList[currentArgumentIndex++];
+            }
+            size_t valueCount = countValueList(initialValue);
+            auto requiredValueCount = static_cast<size_t>(abs(currentArg.nargs));
+
+            // Following values are consecutive argv strings up to the next key
+            const int firstFollowing = currentArgumentIndex;
+            int       followingEnd = currentArgumentIndex;
+            while (((valueCount < requiredValueCount) || (currentArg.nargs == -1)) && (currentArgumentIndex < argcount) && !isKeySwitch(currentArgumentIndex))
+            {
+                std::string_view currentValueString = argvList[currentArgumentIndex++];
+                size_t addCount = countValueList(currentValueString);
+                if (addCount == 0)
+                {
+                    break;
+                }
+                valueCount += addCount;
+                followingEnd = currentArgumentIndex;
+            }
+
+            staticParseError_e status = STATIC_ERROR_ASSIGN_FAILED_e;
+            std::string_view   failedValue;
+            bool               valid = checkValueCount(currentArg, valueCount, status);
+            if (valid)
+            {
+                currentArg.argData->reserveValues(valueCount);
+                valid = assignDelimitedValues(currentArg, initialValue, failedValue);
+                for (int argIndex = firstFollowing; valid && (argIndex < followingEnd); argIndex++)
+                {
+                    std::string_view nextValue = argvList[argIndex];
+                    countValueList(nextValue);
+                    valid = assignDelimitedValues(currentArg, nextValue, failedValue);
+                }
+            }
+
+            if (!valid)
+            {
+                addError({status, keyIndex, keyString, failedValue, currentArg.nargs, valueCount});
+            }
+        }
+
+        /**
+         * @brief Find the key argument and assign its value
+         *
+         * @param keyString   - Key to find
+         * @param valueString - Embedded value string if present, else empty view
+         * @param keyIndex    - argv index of the key
+         */
+        void parseSingleKeyArg(std::string_view keyString, std::string_view valueString, int keyIndex)
+        {
+            size_t keyTableIndex = 0;
+            while ((keyTableIndex < keyCount) && (keyTable[keyTableIndex].key != keyString))
+            {
+                keyTableIndex++;
+            }
+
+            if (keyTableIndex == keyCount)
+            {
+                addError({STATIC_ERROR_UNKNOWN_KEY_e, keyIndex, argvList[keyIndex], std::string_view(), 0, 0});
+                return;
+            }
+
+            staticArgEntry& currentArg = argTable[keyTable[keyTableIndex].argIndex];
+            currentArg.isFound = true;
+            if (currentArg.nargs != 0)
+            {
+                assignValue(currentArg, keyTable[keyTableIndex].key, valueString, keyIndex);
+            }
+            else if (!valueString.empty())
+            {
+                addError({STATIC_ERROR_FLAG_VALUE_e, keyIndex, keyTable[keyTableIndex].key, valueString, 0, 1});
+            }
+            else if (currentArg.argData == nullptr)
+            {
+                helpFlag = true;
+            }
+            else if (valueParseStatus_e::PARSE_SUCCESS_e != currentArg.argData->setValue())
+            {
+                addError({STATIC_ERROR_ASSIGN_FAILED_e, keyIndex, keyTable[keyTableIndex].key, std::string_view(), 0, 0});
+            }
+        }
+
+        /**
+         * @brief Parse the key argument at the current argv index
+         */
+        void parseKeyArg()
+        {
+            const int        keyIndex = currentArgumentIndex;
+            std::string_view currentArgString = argvList[currentArgumentIndex++];
+
+            // Split off an embedded value
+            size_t           valuePos = currentArgString.find(assignmentDelimiter);
+            std::string_view valueString;
+            if (valuePos != std::string_view::npos)
+            {
+                valueString = currentArgString.substr(valuePos + 1);
+            }
+            std::string_view keyString = currentArgString.substr(0, valuePos);
+
+            if ((keyString.size() > 2) && (std::string_view::npos == keyPrefix.find(keyString[1])))
+            {
+                // Single character key list, parsed backwards so the value goes to the last key
+                for (size_t index = keyString.size() - 1; index > 0; index--)
+                {
+                    const parserchar searchArg[] = {keyString[0], keyString[index]};
+                    parseSingleKeyArg(std::string_view(searchArg, sizeof(searchArg)), valueString, keyIndex);
+                    valueString = std::string_view();
+                }
+            }
+            else
+            {
+                parseSingleKeyArg(keyString, valueString, keyIndex);
+            }
+        }
+
+        /**
+         * @brief Parse the positional value at the current argv index
+         */
+        void parsePositionalArg()
+        {
+            const int valueIndex = currentArgumentIndex;
+            for (size_t argIndex = 0; argIndex < argCount; argIndex++)
+            {
+                staticArgEntry& currentArg = argTable[argIndex];
+                if (currentArg.position == parsingPositionNumber)
+                {
+                    parsingPositionNumber++;
+                    currentArg.isFound = true;
+                    assignValue(currentArg, currentArg.name, argvList[currentArgumentIndex++], valueIndex);
+                    return;
+                }
+            }
+
+            addError({STATIC_ERROR_EXTRA_VALUE_e, valueIndex, argvList[currentArgumentIndex++], std::string_view(), 0, 0});
+        }
+
+        /**
+         * @brief Record an error for each required argument that was not found
+         */
+        void checkRequiredArgsFound()
+        {
+            for (size_t argIndex = 0; argIndex < argCount; argIndex++)
+            {
+                if (argTable[argIndex].isRequired && !argTable[argIndex].isFound)
+                {
+                    addError({STATIC_ERROR_MISSING_e, -1, argTable[argIndex].name, std::string_view(), argTable[argIndex].nargs, 0});
+                }
+            }
+        }
+
+        /**
+         * @brief Format one error record
+         */
+        void displayError(std::ostream& outStream, BaseParserStringList& stringList, const staticParseError& currentError) const
+        {
+            const parserstr text(currentError.text);
+            switch (currentError.error)
+            {
+                case STATIC_ERROR_TABLE_FULL_e:
+                    outStream << stringList.getArgumentCreationError(text) << std::endl;
+                    break;
+                case STATIC_ERROR_NOT_LIST_e:
+                    outStream << stringList.getNotListTypeMessage(currentError.expected) << std::endl;
+                    break;
+                case STATIC_ERROR_UNKNOWN_KEY_e:
+                case STATIC_ERROR_EXTRA_VALUE_e:
+                    outStream << stringList.getUnknownArgumentMessage(text) << std::endl;
+                    break;
+                case STATIC_ERROR_FLAG_VALUE_e:
+                    outStream << stringList.getInvalidAssignmentMessage(text) << std::endl;
+                    break;
+                case STATIC_ERROR_NO_VALUE_e:
+                    outStream << stringList.getMissingAssignmentMessage(text) << std::endl;
+                    break;
+                case STATIC_ERROR_TOO_FEW_e:
+                    outStream << stringList.getMissingListAssignmentMessage(text, static_cast<size_t>(abs(currentError.expected)), currentError.found) << std::endl;
+                    break;
+                case STATIC_ERROR_TOO_MANY_e:
+                    outStream << stringList.getTooManyAssignmentMessage(text, static_cast<size_t>(abs(currentError.expected)), currentError.found) << std::endl;
+                    break;
+                case STATIC_ERROR_ASSIGN_FAILED_e:
+                    outStream << stringList.getAssignmentFailedMessage(text, parserstr(currentError.value)) << std::endl;
+                    break;
+                case STATIC_ERROR_MISSING_e:
+                default:
+                    outStream << stringList.getMissingArgumentMessage(text) << std::endl;
+                    break;
+            }
+        }
+
+        /**
+         * @brief Pad the option column of a help table row to optionWidth and print the help text
+         */
+        static void displayHelpRow(std::ostream& outStream, size_t optionLength, size_t optionWidth, std::string_view helpText)
+        {
+            for (size_t padCount = optionLength; padCount < optionWidth; padCount++)
+            {
+                outStream << ' ';
+            }
+            outStream << " " << helpText << std::endl;
+        }
+
+    public:
+        static constexpr size_t argCapacity = maxArgs;          ///< Argument table capacity
+        static constexpr size_t keyCapacity = maxKeys;          ///< Key table capacity
+        static constexpr size_t errorCapacity = maxErrors;      ///< Recorded error capacity
+
+        /**
+         * @brief Constructor
+         *
+         * @param usage              - Usage text, must stay valid for the life of the parser
+         * @param description        - Description text, must stay valid for the life of the parser
+         * @param abortOnError       - True = Stop parsing at the first error
+         * @param disableDefaultHelp - True = do not add the -h,--help,-? flag
+         */
+        static_cmd_line_parse(std::string_view usage = "%(prog) [options]", std::string_view description = "", bool abortOnError = false, bool disableDefaultHelp = false) :
+            argTable(), keyTable(), errorList(), argCount(0), keyCount(0), errorCount(0), droppedErrorCount(0),
+            registrationErrorRecord(), registrationErrorCount(0),
+            usageText(usage), descriptionText(description), keyPrefix("-"),
+            keyListDelimiter(','), assignmentDelimiter('='), assignmentListDelimiter(','),
+            errorAbort(abortOnError), helpFlag(false), positionNumber(1),
+            argvList(nullptr), currentArgumentIndex(0), argcount(0), parsingPositionNumber(1)
+        {
+            if (!disableDefaultHelp)
+            {
+                addKeyArgument(nullptr, "help", "-h,--help,-?", "Show this help message and exit", 0, false);
+            }
+        }
+
+        /**
+         * @brief Set the key prefix characters
+         *
+         * @param prefix - Key prefix characters, must stay valid for the life of the parser, default = "-"
+         */
+        void setKeyPrefix(std::string_view prefix)                      {keyPrefix = prefix;}
+
+        /**
+         * @brief Set the registration key list delimiter
+         *
+         * @param delimiter - Delimiter value, default = ','
+         */
+        void setKeyListDelimiter(parserchar delimiter)                  {keyListDelimiter = delimiter;}
+
+        /**
+         * @brief Set the argument assignment delimiter
+         *
+         * @param delimiter - Delimiter value, default = '='
+         */
+        void setAssignmentDelimiter(parserchar delimiter)               {assignmentDelimiter = delimiter;}
+
+        /**
+         * @brief Set the assignment list delimiter
+         *
+         * @param delimiter - Delimiter value, default = ','
+         */
+        void setAssignmentListDelimiter(parserchar delimiter)           {assignmentListDelimiter = delimiter;}
+
+        //=================================================================================================
+        //======================= Argument add interface methods ==========================================
+        //=================================================================================================
+        /**
+         * @brief Add a new key based command line argument to the argument table
+         *
+         * @param arg      - Pointer to the defined var argument to fill
+         * @param name     - Human name used in the help messages
+         * @param argKeys  - Delimited list of argument key values
+         * @param helpText - Help text to be printed in the help message
+         * @param nargs    - Number of argument values that follow, see cmd_line_parse::addKeyArgument()
+         * @param required - True if argument is required, false if arguemnt is optional
+         *
+         * @return eAddArgSuccess   - Argument was added
+         * @return eAddArgNotList   - nargs needs a list argument type
+         * @return eAddArgTableFull - Argument or key table is full
+         */
+        eAddStatusReturn addKeyArgument(varg_intf* arg, std::string_view name, std::string_view argKeys, std::string_view helpText, int nargs = 1, bool required = false)
+        {
+            if ((nargs != 0) && (nargs != 1) && !arg->isList())
+            {
+                return addRegistrationError(STATIC_ERROR_NOT_LIST_e, name, nargs);
+            }
+
+            // Count the keys before any table entry is used
+            size_t newKeyCount = 0;
+            for (std::string_view keyList = argKeys; !keyList.empty();)
+            {
+                size_t pos = keyList.find(keyListDelimiter);
+                newKeyCount += (trimKey(keyList.substr(0, pos)).empty() ? 0 : 1);
+                keyList.remove_prefix((pos != std::string_view::npos) ? (pos + 1) : keyList.size());
+            }
+            if (argCount == maxArgs)
+            {
+                return addRegistrationError(STATIC_ERROR_TABLE_FULL_e, name, static_cast<int>(maxArgs));
+            }
+            if ((maxKeys - keyCount) < newKeyCount)
+            {
+                return addRegistrationError(STATIC_ERROR_TABLE_FULL_e, name, static_cast<int>(maxKeys));
+            }
+
+            for (std::string_view keyList = argKeys; !keyList.empty();)
+            {
+                size_t pos = keyList.find(keyListDelimiter);
+                std::string_view key = trimKey(keyList.substr(0, pos));
+                if (!key.empty())
+                {
+                    keyTable[keyCount++] = {key, argCount};
+                }
+                keyList.remove_prefix((pos != std::string_view::npos) ? (pos + 1) : keyList.size());
+            }
+            argTable[argCount++] = {name, helpText, arg, nargs, 0, required, false};
+            return eAddArgSuccess;
+        }
+
+        /**
+         * @brief Add a new key based flag command line argument to the argument table
+         *
+         * @param arg      - Pointer to the defined var argument to fill
+         * @param name     - Human name used in the help messages
+         * @param argKeys  - Delimited list of argument key values
+         * @param helpText - Help text to be printed in the help message
+         * @param required - True if argument is required, false if arguemnt is optional
+         *
+         * @return eAddStatusReturn - see addKeyArgument()
+         */
+        eAddStatusReturn addFlagArgument(varg_intf* arg, std::string_view name, std::string_view argKeys, std::string_view helpText, bool required = false)
+        {
+            return addKeyArgument(arg, name, argKeys, helpText, 0, required);
+        }
+
+        /**
+         * @brief Add a new positional command line argument to the argument table
+         *
+         * @param arg      - Pointer to the defined var argument to fill
+         * @param name     - Name of the argument
+         * @param helpText - Help text to be printed in the help message
+         * @param nargs    - Number of argument values that follow, see cmd_line_parse::addPositionalArgument()
+         * @param required - True if argument is required, false if arguemnt is optional
+         *
+         * @return eAddArgSuccess   - Argument was added
+         * @return eAddArgNotList   - nargs needs a list argument type
+         * @return eAddArgTableFull - Argument table is full
+         */
+        eAddStatusReturn addPositionalArgument(varg_intf* arg, std::string_view name, std::string_view helpText, int nargs = 1, bool required = false)
+        {
+            if ((nargs != 0) && (nargs != 1) && !arg->isList())
+            {
+                return addRegistrationError(STATIC_ERROR_NOT_LIST_e, name, nargs);
+            }
+            if (argCount == maxArgs)
+            {
+                return addRegistrationError(STATIC_ERROR_TABLE_FULL_e, name, static_cast<int>(maxArgs));
+            }
+
+            argTable[argCount++] = {name, helpText, arg, nargs, positionNumber++, required, false};
+            return eAddArgSuccess;
+        }
+
+        //=================================================================================================
+        //======================= Commandline parser interface methods ====================================
+        //=================================================================================================
+        /**
+         * @brief Parse the input command line arguments, no heap allocation is made
+         *
+         * @param argc - Number of char pointers in the argv[] array
+         * @param argv - Array of command line text entries, borrowing argument types keep views of them
+         * @param startingArgIndex - argv index to start parsing arguments
+         * @param endingArgIndex - argv index to stop parsing arguments, -1 == argc
+         *
+         * @return int - Index of the last argument parsed or -1 if an error occured or an argument add failed
+         */
+        int parse(int argc, char* argv[], int startingArgIndex = 1, int endingArgIndex = -1)
+        {
+            errorCount = 0;
+            droppedErrorCount = 0;
+            helpFlag = false;
+            if (registrationErrorCount != 0)
+            {
+                return -1;
+            }
+
+            for (size_t argIndex = 0; argIndex < argCount; argIndex++)
+            {
+                argTable[argIndex].isFound = false;
+            }
+
+            argvList = argv;
+            currentArgumentIndex = startingArgIndex;
+            argcount = ((endingArgIndex > 0) ? std::min(endingArgIndex, argc) : argc);
+            parsingPositionNumber = 1;
+
+            while ((currentArgumentIndex < argcount) && !(errorAbort && (errorCount != 0)))
+            {
+                if (isKeySwitch(currentArgumentIndex))
+                {
+                    parseKeyArg();
+                }
+                else
+                {
+                    parsePositionalArg();
+                }
+            }
+
+            int returnValue = currentArgumentIndex;
+            if (errorCount == 0)
+            {
+                checkRequiredArgsFound();
+            }
+            return ((errorCount == 0) ? returnValue : -1);
+        }
+
+        /**
+         * @brief Check if the default help flag was found by the last parse
+         *
+         * @return bool - True if the help flag was found
+         */
+        bool isHelpFlagSet() const                                      {return helpFlag;}
+
+        size_t getArgCount() const                                      {return argCount;}              ///< @brief Number of arguments added
+        size_t getKeyCount() const                                      {return keyCount;}              ///< @brief Number of keys added
+        size_t getErrorCount() const                                    {return errorCount;}            ///< @brief Number of recorded errors of the last parse
+        size_t getDroppedErrorCount() const                             {return droppedErrorCount;}     ///< @brief Errors of the last parse beyond maxErrors
+        const staticParseError& getError(size_t index) const            {return errorList[index];}      ///< @brief Recorded error, index < getErrorCount()
+        size_t getRegistrationErrorCount() const                        {return registrationErrorCount;}    ///< @brief Number of failed argument adds
+        const staticParseError& getRegistrationError() const            {return registrationErrorRecord;}   ///< @brief First failed argument add
+
+        /**
+         * @brief Print the registration error and the errors of the last parse.
+         *        Formatting the messages allocates, call it outside the no allocation section.
+         *
+         * @param outStream - Output streem to use for text output.  Default is the standard error stream
+         */
+        void displayErrors(std::ostream &outStream = std::cerr) const
+        {
+            std::unique_ptr<BaseParserStringList> stringList(BaseParserStringList::getInternationalizedClass());
+            if (registrationErrorCount != 0)
+            {
+                displayError(outStream, *stringList, registrationErrorRecord);
+            }
+            for (size_t index = 0; index < errorCount; index++)
+            {
+                displayError(outStream, *stringList, errorList[index]);
+            }
+        }
+
+        /**
+         * @brief Print the formatted help message to the input stream.
+         *        Formatting the messages allocates, call it outside the no allocation section.
+         *
+         * @param outStream - Output streem to use for text output.  Default is the standard error stream
+         */
+        void displayHelp(std::ostream &outStream = std::cerr) const
+        {
+            std::unique_ptr<BaseParserStringList> stringList(BaseParserStringList::getInternationalizedClass());
+            outStream << stringList->getUsageMessage() << std::endl << usageText << std::endl;
+            if (!descriptionText.empty())
+            {
+                outStream << std::endl << descriptionText << std::endl << std::endl;
+            }
+
+            // Option column width, " key,key=name" for key arguments and " name" for positional arguments
+            size_t optionLength[maxArgs] = {};
+            size_t optionWidth = 0;
+            for (size_t keyIndex = 0; keyIndex < keyCount; keyIndex++)
+            {
+                const staticArgEntry& keyArg = argTable[keyTable[keyIndex].argIndex];
+                size_t& length = optionLength[keyTable[keyIndex].argIndex];
+                length += 1 + keyTable[keyIndex].key.size();
+                if ((keyIndex + 1 == keyCount) || (keyTable[keyIndex + 1].argIndex != keyTable[keyIndex].argIndex))
+                {
+                    length += ((keyArg.nargs != 0) ? (keyArg.name.size() + 1) : 0);
+                }
+            }
+            for (size_t argIndex = 0; argIndex < argCount; argIndex++)
+            {
+                if (argTable[argIndex].position != 0)
+                {
+                    optionLength[argIndex] = argTable[argIndex].name.size() + 1;
+                }
+                optionWidth = std::max(optionWidth, optionLength[argIndex]);
+            }
+
+            bool headerDone = false;
+            for (size_t keyIndex = 0; keyIndex < keyCount; keyIndex++)
+            {
+                const size_t argIndex = keyTable[keyIndex].argIndex;
+                const bool   firstKey = ((keyIndex == 0) || (keyTable[keyIndex - 1].argIndex != argIndex));
+                const bool   lastKey = ((keyIndex + 1 == keyCount) || (keyTable[keyIndex + 1].argIndex != argIndex));
+                if (!headerDone)
+                {
+                    outStream << stringList->getSwitchArgumentsMessage() << std::endl;
+                    headerDone = true;
+                }
+                outStream << (firstKey ? " " : ",") << keyTable[keyIndex].key;
+                if (lastKey)
+                {
+                    if (argTable[argIndex].nargs != 0)
+                    {
+                        outStream << assignmentDelimiter << argTable[argIndex].name;
+                    }
+                    displayHelpRow(outStream, optionLength[argIndex], optionWidth, argTable[argIndex].help);
+                }
+            }
+            if (headerDone)
+            {
+                outStream << std::endl;
+            }
+
+            headerDone = false;
+            for (size_t argIndex = 0; argIndex < argCount; argIndex++)
+            {
+                if (argTable[argIndex].position != 0)
+                {
+                    if (!headerDone)
+                    {
+                        outStream << stringList->getPositionalArgumentsMessage() << std::endl;
+                        headerDone = true;
+                    }
+                    outStream << " " << argTable[argIndex].name;
+                    displayHelpRow(outStream, optionLength[argIndex], optionWidth, argTable[argIndex].help);
+                }
+            }
+            if (headerDone)
+            {
+                outStream << std::endl;
+            }
+        }
+};
+
+}; // end of namespace argparser
+
+/** @} */
@@ -48,6 +48,403 @@ using namespace argparser;
 //======================= Argument add helper interface methods ===================================
 //=================================================================================================
 
+/**
+ * @brief Check the argument setup and add it to the key argument list
+ *
+ * @param newKeyArg - Argument entry with the name, help, nargs, required and storage fields set
+ * @param argKeys   - Delimieted list of argument key values
+ */
+void cmd_line_parse::addKeyArgEntry(ArgEntry& newKeyArg, std::string_view argKeys)
+{
+    // Only list type storage is allowed more than 1 value
+    if ((newKeyArg.nargs != 0) && (newKeyArg.nargs != 1) && !parser_base::isArgList(newKeyArg))
+    {
+        std::cerr << parser_base::getParserStringList()->getNotListTypeMessage(newKeyArg.nargs) << std::endl;
+    }
+    else
+    {
+        // Add the keys to the argument, the caller strings are only valid for the add call
+        parser_base::addArgKeyList(newKeyArg, argKeys);
+        newKeyArg.name = parser_base::storeSchemaString(newKeyArg.name);
+        newKeyArg.help = parser_base::storeSchemaString(newKeyArg.help);
+        newKeyArg.position = 0;
+        newKeyArg.isFound = false;
+
+
+        // Construct the key option help string
+        parserstr optionString = " ";
+        optionString += argKeys;
+        if (newKeyArg.nargs != 0)
+        {
+            optionString += parser_base::getAssignmentDelimeter();
+
+            if (newKeyArg.nargs > 0)
+            {
+                optionString += newKeyArg.name;
+                if (newKeyArg.nargs > 1)
+                {
+                    optionString += parser_base::getAssignmentListDelimeter();
+                    optionString += "...";
+                }
+            }
+
+            if (newKeyArg.nargs < 0)
+            {
+                optionString += newKeyArg.name;
+                optionString += parser_base::getAssignmentListDelimeter();
+                optionString += "[";
+                optionString += parser_base::getAssignmentListDelimeter();
+                optionString += "...";
+                optionString += "]";
+            }
+        }
+
+        parser_base::resizeMaxOptionLength(optionString.size());
+        newKeyArg.optionString = parser_base::storeSchemaString(optionString);
+
+        // Add the new argument to the list
+        parser_base::addKeyArgListEntry(newKeyArg);
+        resetParseCache();
+    }
+}
+
+/**
+ * @brief Check the argument setup and add it to the positional argument list
+ *
+ * @param newArg - Argument entry with the name, help, nargs, required and storage fields set
+ */
+void cmd_line_parse::addPositionalArgEntry(ArgEntry& newArg)
+{
+    // Only list type storage is allowed more than 1 value
+    if ((newArg.nargs != 0) && (newArg.nargs != 1) && !parser_base::isArgList(newArg))
+    {
+        std::cerr << parser_base::getParserStringList()->getNotListTypeMessage(newArg.nargs) << std::endl;
+    }
+    else
+    {
+        newArg.name = parser_base::storeSchemaString(newArg.name);
+        newArg.help = parser_base::storeSchemaString(newArg.help);
+        newArg.position = positionNumber++;
+        newArg.isFound = false;
+        newArg.keyList.clear();
+
+        // Construct the key option help string
+        parserstr optionString = " ";
+        optionString += newArg.name;
+        if (newArg.nargs > 1)
+        {
+            optionString += parser_base::getAssignmentListDelimeter();
+            optionString += newArg.name;
+            optionString += parser_base::getAssignmentListDelimeter();
+            optionString += "...";
+        }
+        if (newArg.nargs < 0)
+        {
+            optionString += newArg.name;
+            optionString += "[";
+            optionString += parser_base::getAssignmentListDelimeter();
+            optionString += newArg.name;
+            optionString += parser_base::getAssignmentListDelimeter();
+            optionString += "...]";
+        }
+
+        parser_base::resizeMaxOptionLength(optionString.size());
+        newArg.optionString = parser_base::storeSchemaString(optionString);
+
+        // Add the new argument to the list
+        parser_base::addPositionalArgListEntry(newArg);
+        resetParseCache();
+    }
+}
+
+/**
+ * @brief Get the name of a bound field argument, the last key without the key prefix
+ *
+ * @param argKeys - Delimieted list of argument key values
+ *
+ * @return std::string_view - Argument name, a view of argKeys
+ */
+std::string_view cmd_line_parse::getBoundArgName(std::string_view argKeys)
+{
+    const size_t delimiterPos = argKeys.rfind(parser_base::getKeyListDelimeter());
+    std::string_view lastKey = ((delimiterPos != std::string_view::npos) ? argKeys.substr(delimiterPos + 1) : argKeys);
+
+    parserstr skipChars = keyPrefix;
+    skipChars += ' ';
+    const size_t nameStart = lastKey.find_first_not_of(skipChars);
+    return ((nameStart != std::string_view::npos) ? lastKey.substr(nameStart) : lastKey);
+}
+
+/**
+ * @brief Get the argv index of the parse session argv string that holds a value
+ *
+ * @param valuePtr - Pointer into the parse session argv storage
+ *
+ * @return int - argv index or -1 if the pointer is not in the argv storage
+ */
+int cmd_line_parse::getArgvIndex(const char* valuePtr) const
+{
+    // Values are queued as they are parsed, so search back from the current argument
+    for (int argIdx = std::min(currentArgumentIndex, static_cast<int>(argvArray.size()) - 1); argIdx >= 0; argIdx--)
+    {
+        std::string_view argString = argvArray[argIdx];
+        if ((valuePtr >= argString.data()) && (valuePtr <= (argString.data() + argString.size())))
+        {
+            return argIdx;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Queue each value of a delimited value list for the argument validator
+ *
+ * @param currentArg  - Argument the values were assigned to
+ * @param valueString - Delimited value list, a view into the parse session argv storage
+ */
+void cmd_line_parse::queueValidation(const ArgEntry& currentArg, std::string_view valueString)
+{
+    queueValidation(currentArg, valueString, getArgvIndex(valueString.data()));
+}
+
+/**
+ * @brief Queue each value of a delimited value list for the argument validator
+ *
+ * @param currentArg  - Argument the values were assigned to
+ * @param valueString - Delimited value list, a view into the parse session memory
+ * @param argvIndex   - argv index reported for a failed value
+ */
+void cmd_line_parse::queueValidation(const ArgEntry& currentArg, std::string_view valueString, int argvIndex)
+{
+    if (valueString.empty())
+    {
+        return;
+    }
+
+    if (!parser_base::isArgList(currentArg))
+    {
+        pendingValidations.push_back({&currentArg, valueString, argvIndex, true});
+        return;
+    }
+
+    const parserchar delimiter = parser_base::getAssignmentListDelimeter();
+    size_t startPos = 0;
+    while (startPos < valueString.size())
+    {
+        size_t endPos = valueString.find(delimiter, startPos);
+        if (endPos == std::string_view::npos)
+        {
+            endPos = valueString.size();
+        }
+        pendingValidations.push_back({&currentArg, valueString.substr(startPos, endPos - startPos), argvIndex, true});
+        startPos = endPos + 1;
+    }
+}
+
+/**
+ * @brief Run the queued argument validators and report each failed value
+ */
+void cmd_line_parse::runPendingValidations()
+{
+    if (pendingValidations.empty())
+    {
+        return;
+    }
+
+    if (0 != parser_base::runValidators(pendingValidations, validatorThreads))
+    {
+        parser_base::setParsingError(true);
+        for (auto const& currentItem : pendingValidations)
+        {
+            if (!currentItem.valid)
+            {
+                std::cerr << parser_base::getParserStringList()->getValidationFailedMessage(parserstr(currentItem.arg->name), parserstr(currentItem.value), currentItem.argvIndex) << std::endl;
+            }
+        }
+    }
+    pendingValidations.clear();
+}
+
+/**
+ * @brief Expand and assign the values of a glob enabled positional argument.
+ *        Values without glob characters, and patterns that match nothing,
+ *        are assigned as given.  All values are expanded and counted before
+ *        any is assigned.
+ *
+ * @param currentArg      - Argument to set
+ * @param initialValue    - Delimited value list of the current argv string
+ * @param followingValues - Delimited value lists of the following argv strings
+ * @param valueCount      - Returned number of values assigned
+ * @param failedValue     - Value string that failed assignment
+ *
+ * @return eAssignmentReturn - Assignment return status
+ */
+eAssignmentReturn cmd_line_parse::assignGlobValues(ArgEntry& currentArg, std::string_view initialValue, const std::pmr::vector<std::string_view>& followingValues,
+                                                   size_t& valueCount, parserstr& failedValue)
+{
+    // Expand every value first so a bad value count leaves the argument unchanged.  The values
+    // are null terminated copies in the parse session memory, the validator queue keeps a view.
+    std::pmr::vector<validationItem> expandedValues(parser_base::getParseResource());
+    auto keepValue = [&](std::string_view value, int argvIndex)
+    {
+        expandedValues.push_back({&currentArg, parser_base::storeParseString(value), argvIndex, true});
+        return true;
+    };
+
+    auto expandValueList = [&](std::string_view valueList)
+    {
+        const parserchar delimiter = parser_base::getAssignmentListDelimeter();
+        const int argvIndex = getArgvIndex(valueList.data());
+        size_t startPos = 0;
+        while (startPos < valueList.size())
+        {
+            size_t endPos = valueList.find(delimiter, startPos);
+            if (endPos == std::string_view::npos)
+            {
+                endPos = valueList.size();
+            }
+            std::string_view value = valueList.substr(startPos, endPos - startPos);
+            startPos = endPos + 1;
+
+            path_glob pattern;
+            if (path_glob::hasGlobChars(value) && pattern.compile(value))
+            {
+                // The result depends on the directory contents, never cache it
+                parseUncacheable = true;
+                if (0 != pattern.expand([&](std::string_view path) {return keepValue(path, argvIndex);},
+                                        (currentArg.globMode == GLOB_SORTED_e), globThreads))
+                {
+                    continue;
+                }
+            }
+            keepValue(value, argvIndex);
+        }
+    };
+
+    expandValueList(initialValue);
+    for (auto const& nextValue : followingValues)
+    {
+        expandValueList(nextValue);
+    }
+
+    valueCount = expandedValues.size();
+    eAssignmentReturn status = parser_base::checkValueCount(currentArg, valueCount);
+    if (eAssignSuccess != status)
+    {
+        return status;
+    }
+
+    parser_base::reserveArgValues(currentArg, valueCount);
+    for (auto const& currentItem : expandedValues)
+    {
+        if (valueParseStatus_e::PARSE_SUCCESS_e != parser_base::setArgValue(currentArg, currentItem.value.data()))
+        {
+            failedValue = parserstr(currentItem.value);
+            return eAssignFailed;
+        }
+    }
+    if (currentArg.validator)
+    {
+        pendingValidations.insert(pendingValidations.end(), expandedValues.begin(), expandedValues.end());
+    }
+    return eAssignSuccess;
+}
+
+/**
+ * @brief Check if every argument uses the built in value storage
+ *
+ * @return true  - Parse results can be cached
+ * @return false - One or more arguments use varg_intf storage, a bound field or a validator
+ */
+bool cmd_line_parse::isParseCacheable() const
+{
+    auto usesValueStore = [](const ArgEntry& currentArg) {return ((currentArg.argData == nullptr) && !currentArg.binding.isBound() && !currentArg.validator);};
+    const argEntryRange keyArgs = parser_base::getKeyArgList();
+    const argEntryRange positionalArgs = parser_base::getPositionalArgList();
+    return (std::all_of(keyArgs.begin(), keyArgs.end(), usesValueStore) &&
+            std::all_of(positionalArgs.begin(), positionalArgs.end(), usesValueStore));
+}
+
+/**
+ * @brief Copy the value and found state of every argument
+ *
+ * @param snapshot - Returned key argument states followed by positional argument states
+ */
+void cmd_line_parse::saveArgState(std::vector<parse_cache::argSnapshot>& snapshot) const
+{
+    snapshot.clear();
+    snapshot.reserve(parser_base::getKeyArgList().size() + parser_base::getPositionalArgList().size());
+    for (auto const& keyArg : parser_base::getKeyArgList())
+    {
+        snapshot.push_back({keyArg.valueStore, keyArg.isFound});
+    }
+
+    for (auto const& positionalArg : parser_base::getPositionalArgList())
+    {
+        snapshot.push_back({positionalArg.valueStore, positionalArg.isFound});
+    }
+}
+
+/**
+ * @brief Restore the value and found state of every argument
+ *
+ * @param snapshot - Key argument states followed by positional argument states
+ */
+void cmd_line_parse::restoreArgState(const std::vector<parse_cache::argSnapshot>& snapshot)
+{
+    // A shared entry that was never changed still holds the state every snapshot saved for it
+    auto argState = snapshot.begin();
+    auto restoreArg = [this, &argState, &snapshot](const ArgEntry& currentArg)
+    {
+        if (argState != snapshot.end())
+        {
+            if (!parser_base::isSharedArg(currentArg))
+            {
+                ArgEntry& writableArg = parser_base::getWritableArg(currentArg);
+                writableArg.valueStore = argState->value;
+                writableArg.isFound = argState->isFound;
+            }
+            ++argState;
+        }
+    };
+
+    for (auto const& keyArg : parser_base::getKeyArgList())
+    {
+        restoreArg(keyArg);
+    }
+
+    for (auto const& positionalArg : parser_base::getPositionalArgList())
+    {
+        restoreArg(positionalArg);
+    }
+}
+
+/**
+ * @brief Remove the cached parse results and capture the current argument state
+ *        as the state every cached parse starts from
+ */
+void cmd_line_parse::resetParseCache()
+{
+    if (parseCache != nullptr)
+    {
+        std::vector<parse_cache::argSnapshot> defaults;
+        saveArgState(defaults);
+        parseCache->setDefaults(std::move(defaults));
+    }
+}
+
+/**
+ * @brief Check if the default help flag was set during parsing
+ *
+ * @return true  - Help flag was found
+ * @return false - Help flag was not found or the default help argument is not in use
+ */
+bool cmd_line_parse::isHelpFlagSet() const
+{
+    const bool* helpValue = getValue<bool>("help");
+    return ((helpValue != nullptr) && *helpValue);
+}
+
 /**
  * @brief Test if the next command line argument is a key switch
  *
@@ -56,7 +453,8 @@ using namespace argparser;
  */
 bool cmd_line_parse::isCurrentArgKeySwitch()
 {
-    return (parserstr::npos != keyPrefix.find(argvArray[currentArgumentIndex][0]));
+    // The session argv strings are null terminated, an empty string is never a key
+    return (parserstr::npos != keyPrefix.find(argvArray[currentArgumentIndex].data()[0]));
 }
 
 /**
@@ -66,11 +464,11 @@ bool cmd_line_parse::isCurrentArgKeySwitch()
 void cmd_line_parse::checkRequiredArgsFound()
 {
     // Check that all the required positional arguments were found
-    for (auto const& positionalArg : positionalArgList)
+    for (auto const& positionalArg : parser_base::getPositionalArgList())
     {
         if ((positionalArg.isRequired) && !(positionalArg.isFound))
         {
-            std::cerr << parser_base::getParserStringList()->getMissingArgumentMessage(positionalArg.name) << std::endl;
+            std::cerr << parser_base::getParserStringList()->getMissingArgumentMessage(parserstr(positionalArg.name)) << std::endl;
             parser_base::setParsingError(true);
         }
     }
@@ -131,22 +529,19 @@ void cmd_line_parse::addDefaultHelpArgument()
     }
 
     // Add the argument to the key argument list
-    helpFlag = new varg<bool>(false, true);
-    addKeyArgument(helpFlag, "help", keyList, parser_base::getParserStringList()->getHelpString(), 0, false);
+    addFlagValue("help", keyList, parser_base::getParserStringList()->getHelpString(), false, false);
 }
 
 /**
- * @brief Break the input value list into it's parts
+ * @brief Get the initial delimited value list string
  *
- * @param valueString - delimited list of value data
- * @param valueList  - Reference to the current value string list
+ * @param valueString - Embedded value string view if present, else empty view
  *
- * @return size_t - number of elements in the list
+ * @return std::string_view - Initial delimited value list string, a view into the parse session argv storage
  */
-size_t cmd_line_parse::getInitialValueList(parserstr& valueString, std::list<parserstr>& valueList)
+std::string_view cmd_line_parse::getInitialValue(std::string_view valueString)
 {
-    parserstr currentValue = ((valueString.empty() && (currentArgumentIndex < argcount)) ? argvArray[currentArgumentIndex++] : valueString);
-    return parser_base::getValueList(currentValue, valueList);
+    return ((valueString.empty() && (currentArgumentIndex < argcount)) ? std::string_view(argvArray[currentArgumentIndex++]) : valueString);
 }
 
 /**
@@ -157,14 +552,14 @@ size_t cmd_line_parse::getInitialValueList(parserstr& valueString, std::list<par
  *
  * @return ArgEntry - Reference to the ArgEntry from the ArgEntry if match was found. Or nullptr if not.
  */
-ArgEntry& cmd_line_parse::findMatchingArg(const parserstr& keystring, bool& found)
+ArgEntry& cmd_line_parse::findMatchingArg(std::string_view keystring, bool& found)
 {
     ArgEntry& returnArg = parser_base::findMatchingArg(keystring, found);
 
     // Unknown argument key
     if ((!found) && ((!ignoreUnknownKey) || (debugMsgLevel > noDebugMsg)))
     {
-        std::cerr << parser_base::getParserStringList()->getUnknownArgumentMessage(keystring) << std::endl;
+        std::cerr << parser_base::getParserStringList()->getUnknownArgumentMessage(parserstr(keystring)) << std::endl;
         parser_base::setParsingError(!ignoreUnknownKey);
     }
     return returnArg;
@@ -175,11 +570,11 @@ ArgEntry& cmd_line_parse::findMatchingArg(const parserstr& keystring, bool& foun
  *
  * @param currentArg - Pointer to the argument to set
  * @param keyString  - Key value that was matched
- * @param valueString - Reference to the embedded value string if present, else empty string
+ * @param valueString - Embedded value string view if present, else empty view
  *
  * @return bool - False = assignment worked, true = assignment failed
  */
-bool cmd_line_parse::assignKeyFlagValue(ArgEntry& currentArg, const char* keyString, parserstr& valueString)
+bool cmd_line_parse::assignKeyFlagValue(ArgEntry& currentArg, const char* keyString, std::string_view valueString)
 {
     bool status = false;
     if (!valueString.empty())
@@ -189,7 +584,7 @@ bool cmd_line_parse::assignKeyFlagValue(ArgEntry& currentArg, const char* keyStr
     }
     else if (eAssignSuccess != parser_base::assignKeyFlagValue(currentArg))
     {
-        std::cerr << parser_base::getParserStringList()->getAssignmentFailedMessage(keyString, valueString) << std::endl;
+        std::cerr << parser_base::getParserStringList()->getAssignmentFailedMessage(keyString, parserstr(valueString)) << std::endl;
         status = true;
     }
 
@@ -206,18 +601,19 @@ bool cmd_line_parse::assignKeyFlagValue(ArgEntry& currentArg, const char* keyStr
  *
  * @param currentArg - Pointer to the argument to set
  * @param keyString  - Key value that was matched
- * @param valueString - Reference to the embedded value string if present, else empty string
+ * @param valueString - Embedded value string view if present, else empty view
  *
  * @return bool - False = assignment worked, true = assignment failed
  */
-bool cmd_line_parse::assignKeyValue(ArgEntry& currentArg, const char* keyString, parserstr& valueString)
+bool cmd_line_parse::assignKeyValue(ArgEntry& currentArg, const char* keyString, std::string_view valueString)
 {
     if (debugMsgLevel > veryVerboseDebug)
     {
         std::cout << "Initial value string: " << valueString << std::endl;
     }
-    std::list<parserstr> assignmentValues;
-    size_t valueCount = getInitialValueList(valueString, assignmentValues);
+    std::pmr::vector<std::string_view> followingValues(parser_base::getParseResource());
+    std::string_view initialValue = getInitialValue(valueString);
+    size_t valueCount = parser_base::countValueList(initialValue);
     auto requiredValueCount = static_cast<size_t>(abs(currentArg.nargs));
     if (debugMsgLevel > veryVerboseDebug)
     {
@@ -226,15 +622,18 @@ bool cmd_line_parse::assignKeyValue(ArgEntry& currentArg, const char* keyString,
         std::cout << "Current arg index: " << currentArgumentIndex << " of " << argcount << std::endl;
     }
 
-    // Argument list is the input values list
-    while (((valueCount < requiredValueCount) || (currentArg.nargs == -1)) &&
+    // Argument list is the input values list, a value source file supplies all of the values
+    bool fileSource = parser_base::isFileValueSource(currentArg, initialValue);
+    fileSourceRead |= fileSource;
+    while (!fileSource &&
+           ((valueCount < requiredValueCount) || (currentArg.nargs == -1)) &&
            (currentArgumentIndex < argcount) &&
            !isCurrentArgKeySwitch()
           )
     {
         // Get the next argument
-        parserstr currentValueString = argvArray[currentArgumentIndex++];
-        size_t    addCount = parser_base::getValueList(currentValueString, assignmentValues);
+        std::string_view currentValueString = argvArray[currentArgumentIndex++];
+        size_t           addCount = parser_base::countValueList(currentValueString);
         if (debugMsgLevel > veryVerboseDebug)
         {
             std::cout << "Next value string: " << currentValueString << std::endl;
@@ -248,17 +647,62 @@ bool cmd_line_parse::assignKeyValue(ArgEntry& currentArg, const char* keyString,
         }
 
         // Add the new values to the counter
+        followingValues.push_back(currentValueString);
         valueCount += addCount;
     }
 
     // Check we got the correct number of arguments
     if (debugMsgLevel > veryVerboseDebug) 
     {
-        std::cout << "Assignment string count: " << assignmentValues.size() << std::endl;
+        std::cout << "Assignment string count: " << valueCount << std::endl;
     }
 
+    // Assign the initial delimited list in one pass, then any following argument values
     parserstr failedValue;
-    eAssignmentReturn status = parser_base::assignListKeyValue(currentArg, assignmentValues, failedValue);
+    // Glob patterns are expanded before the values are assigned
+    const bool globSource = !fileSource && (currentArg.globMode != GLOB_DISABLED_e);
+    eAssignmentReturn status;
+    if (fileSource)
+    {
+        // The file is closed on return, keep a copy of each line for the validator
+        std::function<void(std::string_view)> keepLine;
+        if (currentArg.validator)
+        {
+            keepLine = [&](std::string_view line) {followingValues.push_back(parser_base::storeParseString(line));};
+        }
+        status = parser_base::assignFileValues(currentArg, initialValue.substr(1), valueCount, failedValue, keepLine);
+    }
+    else if (globSource)
+    {
+        status = assignGlobValues(currentArg, initialValue, followingValues, valueCount, failedValue);
+    }
+    else
+    {
+        status = parser_base::assignDelimitedKeyValue(currentArg, initialValue, valueCount, failedValue);
+        for (auto nextValue = followingValues.begin(); (eAssignSuccess == status) && (nextValue != followingValues.end()); ++nextValue)
+        {
+            status = parser_base::assignDelimitedValues(currentArg, *nextValue, failedValue);
+        }
+    }
+    // Queue the values for the argument validator, expanded glob values are already queued
+    if ((eAssignSuccess == status) && currentArg.validator && fileSource)
+    {
+        // File values are reported against the argv string that named the file
+        const int argvIndex = getArgvIndex(initialValue.data());
+        for (auto const& nextValue : followingValues)
+        {
+            queueValidation(currentArg, nextValue, argvIndex);
+        }
+    }
+    else if ((eAssignSuccess == status) && currentArg.validator && !globSource)
+    {
+        queueValidation(currentArg, initialValue);
+        for (auto const& nextValue : followingValues)
+        {
+            queueValidation(currentArg, nextValue);
+        }
+    }
+
     switch(status)
     {
         case eAssignSuccess:
@@ -293,7 +737,7 @@ bool cmd_line_parse::assignKeyValue(ArgEntry& currentArg, const char* keyString,
  * @param searchString - Key argument value to find and set
  * @param valueString - Value string from the argument or empty string
  */
-void cmd_line_parse::parseSingleKeyArg(const char* searchString, parserstr valueString)
+void cmd_line_parse::parseSingleKeyArg(const char* searchString, std::string_view valueString)
 {
     // Find the matching key in the argument list
     bool found = false;
@@ -305,7 +749,7 @@ void cmd_line_parse::parseSingleKeyArg(const char* searchString, parserstr value
             std::cout << "Value string: " << valueString << std::endl;
         }
     }
-    ArgEntry currentArg = findMatchingArg(searchString, found);
+    ArgEntry& currentArg = findMatchingArg(searchString, found);
     if (found)
     {
         if (debugMsgLevel >= debugVerbosityLevel_e::veryVerboseDebug)
@@ -347,19 +791,19 @@ void cmd_line_parse::parseSingleKeyArg(const char* searchString, parserstr value
  */
 void cmd_line_parse::parseKeyArg()
 {
-    parserstr currentArg = argvArray[currentArgumentIndex++];
+    std::string_view currentArgString = argvArray[currentArgumentIndex++];
 
-    // Check for value as part of the argument
-    std::size_t valuePos = currentArg.find(parser_base::getAssignmentDelimeter());
-    parserstr valueString;
-    if (valuePos != parserstr::npos)
+    // Check for value as part of the argument, the value string is a view into the session argv storage
+    std::size_t      valuePos = currentArgString.find(parser_base::getAssignmentDelimeter());
+    std::string_view valueString;
+    if (valuePos != std::string_view::npos)
     {
-        // Copy the assignment string into valueString and truncate the currentArg string
-        // to just the argument protion
-        valueString = currentArg.substr(valuePos + sizeof(char), parserstr::npos);
-        currentArg.erase(valuePos);
+        valueString = currentArgString.substr(valuePos + sizeof(char));
     }
 
+    // Null terminated copy of just the argument portion, from the parse session arena
+    std::pmr::string currentArg(currentArgString.substr(0, valuePos), parser_base::getParseResource());
+
     // Check for switch list
     if (parserstr::npos != keyPrefix.find(currentArg[1]))
     {
@@ -373,15 +817,14 @@ void cmd_line_parse::parseKeyArg()
             // parse the single character key list backwards
             for (size_t index = currentArg.size() - 1; index > 0; index--)
             {
-                parserstr searchArg;
-                searchArg += currentArg[0];     // key delemiter
-                searchArg += currentArg[index]; // key character
+                // key delemiter and key character
+                const parserchar searchArg[] = {currentArg[0], currentArg[index], '\0'};
 
                 // Parse the current single character
-                parseSingleKeyArg(searchArg.c_str(), valueString);
+                parseSingleKeyArg(searchArg, valueString);
 
                 // Clear the value string
-                valueString.erase();
+                valueString = std::string_view();
             }
         }
         else
@@ -397,13 +840,14 @@ void cmd_line_parse::parseKeyArg()
  */
 void cmd_line_parse::parsePositionalArg()
 {
-    if (!positionalArgList.empty())
+    if (!parser_base::isPositionalArgListEmpty())
     {
-        parserstr valueString = argvArray[currentArgumentIndex++];
-        for (auto& currentArg : positionalArgList)
+        std::string_view valueString = argvArray[currentArgumentIndex++];
+        for (auto const& positionalArg : parser_base::getPositionalArgList())
         {
-            if ((currentArg.position == parseingPositionNumber) || (currentArg.position == 0))
+            if ((positionalArg.position == parseingPositionNumber) || (positionalArg.position == 0))
             {
+                ArgEntry& currentArg = parser_base::getWritableArg(positionalArg);
                 if (debugMsgLevel > veryVerboseDebug)
                 {
                     std::cout << "Positional Argument Name: " << currentArg.name << ", position: " << currentArg.position << std::endl;
@@ -420,7 +864,7 @@ void cmd_line_parse::parsePositionalArg()
                     positionalStopArgumentFound = true;
                 }
 
-                parser_base::setParsingError(assignKeyValue(currentArg, currentArg.name.c_str(), valueString));
+                parser_base::setParsingError(assignKeyValue(currentArg, currentArg.name.data(), valueString));
                 break;
             }
         }
@@ -428,7 +872,7 @@ void cmd_line_parse::parsePositionalArg()
     else
     {
         parser_base::setParsingError(true);
-        std::cerr << parser_base::getParserStringList()->getUnknownArgumentMessage(argvArray[currentArgumentIndex++]) << std::endl;
+        std::cerr << parser_base::getParserStringList()->getUnknownArgumentMessage(parserstr(argvArray[currentArgumentIndex++])) << std::endl;
     }
 }
 
@@ -440,10 +884,9 @@ void cmd_line_parse::parsePositionalArg()
 cmd_line_parse::cmd_line_parse() : usageText("%(prog) [options]"), keyPrefix("-"), 
     displayHelpOnError(true), enableDefaultHelp(true), 
     ignoreUnknownKey(false), singleCharArgListAllowed(true), 
-    positionNumber(1), parseingPositionNumber(1), currentArgumentIndex(0), argcount(0),
-    debugMsgLevel(0), positionalStopArgumentFound(false), helpFlag(nullptr)
+    positionNumber(1), parseingPositionNumber(1), currentArgumentIndex(0), argcount(0), argvArray(parser_base::getParseResource()),
+    debugMsgLevel(0), positionalStopArgumentFound(false), fileSourceRead(false), parseUncacheable(false), validatorThreads(0), globThreads(0)
 {
-    positionalArgList.clear();
     argvArray.clear();
     addDefaultHelpArgument();
 }
@@ -453,41 +896,35 @@ cmd_line_parse::cmd_line_parse(const cmd_line_parse& other) :
     usageText(other.usageText), descriptionText(other.descriptionText), keyPrefix(other.keyPrefix),
     displayHelpOnError(other.displayHelpOnError), enableDefaultHelp(other.enableDefaultHelp),
     ignoreUnknownKey(other.ignoreUnknownKey), singleCharArgListAllowed(other.singleCharArgListAllowed),
-    positionNumber(1), parseingPositionNumber(1), currentArgumentIndex(0), argcount(0),
-    debugMsgLevel(other.debugMsgLevel), positionalStopArgumentFound(false), 
-    positionalArgList(other.positionalArgList), helpFlag(nullptr)
+    positionNumber(other.positionNumber), parseingPositionNumber(1), currentArgumentIndex(0), argcount(0), argvArray(parser_base::getParseResource()),
+    debugMsgLevel(other.debugMsgLevel), positionalStopArgumentFound(false), fileSourceRead(false), parseUncacheable(false),
+    validatorThreads(other.validatorThreads), globThreads(other.globThreads)
 {
     argvArray.clear();
-    if (nullptr != other.helpFlag)
-    {
-        addDefaultHelpArgument();
-    }
 }
 
 cmd_line_parse::cmd_line_parse(cmd_line_parse&& other) : 
-    parser_base(other), programName(other.programName), 
-    usageText(other.usageText), descriptionText(other.descriptionText), keyPrefix(other.keyPrefix),
+    parser_base(std::move(other)), programName(std::move(other.programName)), 
+    usageText(std::move(other.usageText)), descriptionText(std::move(other.descriptionText)), keyPrefix(std::move(other.keyPrefix)),
     displayHelpOnError(other.displayHelpOnError), enableDefaultHelp(other.enableDefaultHelp),
     ignoreUnknownKey(other.ignoreUnknownKey), singleCharArgListAllowed(other.singleCharArgListAllowed),
-    positionNumber(1), parseingPositionNumber(1), currentArgumentIndex(0), argcount(0),
-    debugMsgLevel(other.debugMsgLevel), positionalStopArgumentFound(false), 
-    positionalArgList(other.positionalArgList), helpFlag(nullptr)
+    positionNumber(other.positionNumber), parseingPositionNumber(1), currentArgumentIndex(0), argcount(0), argvArray(parser_base::getParseResource()),
+    debugMsgLevel(other.debugMsgLevel), positionalStopArgumentFound(false), fileSourceRead(false), parseUncacheable(false),
+    validatorThreads(other.validatorThreads), globThreads(other.globThreads),
+    parseCache(std::move(other.parseCache))
 {
+    // The argv views belong to the source parse session and are not moved
     argvArray.clear();
-    if (nullptr != other.helpFlag)
-    {
-        addDefaultHelpArgument();
-    }
+    other.positionNumber = 1;
 }
 
 cmd_line_parse::cmd_line_parse(parserstr& usage, parserstr& description, bool abortOnError, bool disableDefaultHelp, int debugLevel) :
     parser_base(abortOnError, debugLevel), keyPrefix("-"), 
     displayHelpOnError(true), enableDefaultHelp(!disableDefaultHelp), 
     ignoreUnknownKey(false), singleCharArgListAllowed(true), 
-    positionNumber(1), parseingPositionNumber(1), currentArgumentIndex(0), argcount(0),  
-    debugMsgLevel(debugLevel), positionalStopArgumentFound(false), helpFlag(nullptr)
+    positionNumber(1), parseingPositionNumber(1), currentArgumentIndex(0), argcount(0), argvArray(parser_base::getParseResource()),  
+    debugMsgLevel(debugLevel), positionalStopArgumentFound(false), fileSourceRead(false), parseUncacheable(false), validatorThreads(0), globThreads(0)
 {
-    positionalArgList.clear();
     argvArray.clear();
 
     if (!usage.empty())
@@ -510,10 +947,9 @@ cmd_line_parse::cmd_line_parse(const char* usage, const char* description, bool
     parser_base(abortOnError, debugLevel), keyPrefix("-"), 
     displayHelpOnError(true), enableDefaultHelp(!disableDefaultHelp), 
     ignoreUnknownKey(false), singleCharArgListAllowed(true), 
-    positionNumber(1), parseingPositionNumber(1), currentArgumentIndex(0), argcount(0),  
-    debugMsgLevel(debugLevel), positionalStopArgumentFound(false), helpFlag(nullptr)
+    positionNumber(1), parseingPositionNumber(1), currentArgumentIndex(0), argcount(0), argvArray(parser_base::getParseResource()),  
+    debugMsgLevel(debugLevel), positionalStopArgumentFound(false), fileSourceRead(false), parseUncacheable(false), validatorThreads(0), globThreads(0)
 {
-    positionalArgList.clear();
     argvArray.clear();
 
     if (nullptr != usage)
@@ -536,6 +972,7 @@ cmd_line_parse& cmd_line_parse::operator=(const cmd_line_parse& other)
 {
     if (this != &other)
     {
+        parser_base::operator=(other);
         programName                 = other.programName; 
         usageText                   = other.usageText; 
         descriptionText             = other.descriptionText;
@@ -545,21 +982,19 @@ cmd_line_parse& cmd_line_parse::operator=(const cmd_line_parse& other)
         ignoreUnknownKey            = other.ignoreUnknownKey;
         singleCharArgListAllowed    = other.singleCharArgListAllowed; 
         debugMsgLevel               = other.debugMsgLevel;
+        validatorThreads            = other.validatorThreads;
+        globThreads                 = other.globThreads;
 
-        positionNumber              = 1; 
+        positionNumber              = other.positionNumber; 
         parseingPositionNumber      = 1; 
         currentArgumentIndex        = 0;
         argcount                    = 0;
         positionalStopArgumentFound = false;
-        helpFlag                    = nullptr;
+        fileSourceRead              = false;
+        parseUncacheable            = false;
 
         argvArray.clear(); 
-        positionalArgList.clear();
-        positionalArgList           = other.positionalArgList;
-        if (enableDefaultHelp)
-        {
-            addDefaultHelpArgument();
-        }
+        parseCache.reset();
     }
     return *this;
 }
@@ -568,26 +1003,30 @@ cmd_line_parse& cmd_line_parse::operator=(cmd_line_parse&& other)
 {
     if (this != &other)
     {
-        programName                 = other.programName; 
-        usageText                   = other.usageText; 
-        descriptionText             = other.descriptionText;
-        keyPrefix                   = other.keyPrefix; 
+        parser_base::operator=(std::move(other));
+        programName                 = std::move(other.programName); 
+        usageText                   = std::move(other.usageText); 
+        descriptionText             = std::move(other.descriptionText);
+        keyPrefix                   = std::move(other.keyPrefix); 
         displayHelpOnError          = other.displayHelpOnError;
         enableDefaultHelp           = other.enableDefaultHelp; 
         ignoreUnknownKey            = other.ignoreUnknownKey;
         singleCharArgListAllowed    = other.singleCharArgListAllowed; 
         debugMsgLevel               = other.debugMsgLevel;
+        validatorThreads            = other.validatorThreads;
+        globThreads                 = other.globThreads;
 
-        positionNumber              = 1; 
+        positionNumber              = other.positionNumber; 
         parseingPositionNumber      = 1; 
         currentArgumentIndex        = 0;
         argcount                    = 0;
         positionalStopArgumentFound = false;
+        fileSourceRead              = false;
+        parseUncacheable            = false;
 
-        positionalArgList.clear();
         argvArray.clear(); 
-        positionalArgList           = other.positionalArgList;
-        other.positionalArgList.clear();
+        other.positionNumber        = 1;
+        parseCache                  = std::move(other.parseCache);
     }
     return *this;
 }
@@ -618,62 +1057,36 @@ cmd_line_parse& cmd_line_parse::operator=(cmd_line_parse&& other)
  *                       are found it is flagged as an error
  * @param required - True if argument is required, false if arguemnt is optional
  */
-void cmd_line_parse::addKeyArgument(varg_intf* arg, parserstr name, parserstr argKeys, parserstr helpText, int nargs, bool required)
+void cmd_line_parse::addKeyArgument(varg_intf* arg, std::string_view name, std::string_view argKeys, std::string_view helpText, int nargs, bool required)
 {
-    // Only list type varg_intf are allowed more than 1 value
-    if ((nargs != 0) && (nargs != 1) && !arg->isList())
-    {
-        std::cerr << parser_base::getParserStringList()->getNotListTypeMessage(nargs) << std::endl;
-    }
-    else
-    {
-        // Add the keys to the argument
-        ArgEntry newKeyArg = {};
-        size_t   keyCount = parser_base::addArgKeyList(newKeyArg, argKeys);
-
-        // Setup the key argument parameters
-        newKeyArg.name = name;
-        newKeyArg.help = helpText;
-        newKeyArg.argData = arg;
-        newKeyArg.nargs = nargs;
-        newKeyArg.position = 0;
-        newKeyArg.isRequired = required;
-        newKeyArg.isFound = false;
-
-        // Construct the key option help string
-        parserstr optionString = " ";
-        optionString += argKeys;
-        if (nargs != 0)
-        {
-            optionString += parser_base::getAssignmentDelimeter();
-
-            if (nargs > 0)
-            {
-                optionString += newKeyArg.name;
-                if (nargs > 1)
-                {
-                    optionString += parser_base::getAssignmentListDelimeter();
-                    optionString += "...";
-                }
-            }
-
-            if (nargs < 0)
-            {
-                optionString += newKeyArg.name;
-                optionString += parser_base::getAssignmentListDelimeter();
-                optionString += "[";
-                optionString += parser_base::getAssignmentListDelimeter();
-                optionString += "...";
-                optionString += "]";
-            }
-        }
-
-        parser_base::resizeMaxOptionLength(optionString.size());
-        newKeyArg.optionString = optionString;
+    ArgEntry newKeyArg = {};
+    newKeyArg.name = name;
+    newKeyArg.help = helpText;
+    newKeyArg.argData = arg;
+    newKeyArg.nargs = nargs;
+    newKeyArg.isRequired = required;
+    addKeyArgEntry(newKeyArg, argKeys);
+}
 
-        // Add the new argument to the list
-        parser_base::addKeyArgListEntry(newKeyArg);
-    }
+/**
+ * @brief Add a new key based flag command line argument to the argument list
+ *
+ * @param name         - Name of the argument
+ * @param argKeys      - Delimieted list of argument key values
+ * @param helpText     - Help text to be printed in the help message
+ * @param defaultValue - Initial flag value, the flag key sets the inverse value
+ * @param required     - True if argument is required, false if arguemnt is optional
+ */
+void cmd_line_parse::addFlagValue(std::string_view name, std::string_view argKeys, std::string_view helpText, bool defaultValue, bool required)
+{
+    ArgEntry newKeyArg = {};
+    newKeyArg.name = name;
+    newKeyArg.help = helpText;
+    newKeyArg.argData = nullptr;
+    newKeyArg.nargs = 0;
+    newKeyArg.isRequired = required;
+    newKeyArg.valueStore = argValueStore::createFlag(defaultValue);
+    addKeyArgEntry(newKeyArg, argKeys);
 }
 
 
@@ -686,7 +1099,7 @@ void cmd_line_parse::addKeyArgument(varg_intf* arg, parserstr name, parserstr ar
  * @param helpText - Help text to be printed in the help message
  * @param required - True if argument is required, false if arguemnt is optional
  */
-void cmd_line_parse::addFlagArgument(varg_intf* arg, parserstr name, parserstr argKeys, parserstr helpText, bool required)
+void cmd_line_parse::addFlagArgument(varg_intf* arg, std::string_view name, std::string_view argKeys, std::string_view helpText, bool required)
 {
     addKeyArgument(arg, name, argKeys, helpText, 0, required);
 }
@@ -705,60 +1118,79 @@ void cmd_line_parse::addFlagArgument(varg_intf* arg, parserstr name, parserstr a
  *                  -N : List argument with up to N arguments, if more than N arguments
  *                       are found it is flagged as an error
  * @param required - True if argument is required, false if arguemnt is optional
+ * @param globMode - Expand file path glob patterns in the values
  */
-void cmd_line_parse::addPositionalArgument(varg_intf* arg, parserstr name, parserstr helpText, int nargs, bool required)
+void cmd_line_parse::addPositionalArgument(varg_intf* arg, std::string_view name, std::string_view helpText, int nargs, bool required, globMode_e globMode)
 {
-    // Only list type varg_intf are allowed more than 1 value
-    if ((nargs != 0) && (nargs != 1) && !arg->isList())
-    {
-        std::cerr << parser_base::getParserStringList()->getNotListTypeMessage(nargs) << std::endl;
-    }
-    else
-    {
-        // Add the keys to the argument
-        ArgEntry newArg = {};
-
-        // Setup the key argument parameters
-        newArg.name = name;
-        newArg.help = helpText;
-        newArg.argData = arg;
-        newArg.nargs = nargs;
-        newArg.position = positionNumber++;
-        newArg.isRequired = required;
-        newArg.isFound = false;
-        newArg.keyList.clear();
+    ArgEntry newArg = {};
+    newArg.name = name;
+    newArg.help = helpText;
+    newArg.argData = arg;
+    newArg.nargs = nargs;
+    newArg.isRequired = required;
+    newArg.globMode = globMode;
+    addPositionalArgEntry(newArg);
+}
 
-        // Construct the key option help string
-        parserstr optionString = " ";
-        optionString += newArg.name;
-        if (nargs > 1)
+//=================================================================================================
+//======================= Parse interface methods =================================================
+//=================================================================================================
+/**
+ * @brief Set the value validator of an argument
+ *
+ * @param name      - Argument name
+ * @param validator - Value validator, must be safe to call from several threads
+ *
+ * @return true  - Validator was set
+ * @return false - No argument has the name
+ */
+bool cmd_line_parse::setArgValidator(const parserstr& name, argValidator validator)
+{
+    for (auto const& keyArg : parser_base::getKeyArgList())
+    {
+        if (keyArg.name == name)
         {
-            optionString += parser_base::getAssignmentListDelimeter();
-            optionString += newArg.name;
-            optionString += parser_base::getAssignmentListDelimeter();
-            optionString += "...";
+            parser_base::getWritableArg(keyArg).validator = std::move(validator);
+            return true;
         }
-        if (nargs < 0)
+    }
+
+    for (auto const& positionalArg : parser_base::getPositionalArgList())
+    {
+        if (positionalArg.name == name)
         {
-            optionString += newArg.name;
-            optionString += "[";
-            optionString += parser_base::getAssignmentListDelimeter();
-            optionString += newArg.name;
-            optionString += parser_base::getAssignmentListDelimeter();
-            optionString += "...]";
+            parser_base::getWritableArg(positionalArg).validator = std::move(validator);
+            return true;
         }
+    }
+    return false;
+}
 
-        parser_base::resizeMaxOptionLength(optionString.size());
-        newArg.optionString = optionString;
+/**
+ * @brief Enable the parse result cache
+ *
+ * @param maxEntries    - Maximum number of cached parse results
+ * @param schemaVersion - Version included in every cache key
+ */
+void cmd_line_parse::enableParseCache(size_t maxEntries, uint64_t schemaVersion)
+{
+    parseCache = std::make_unique<parse_cache>(maxEntries, schemaVersion);
+    resetParseCache();
+}
 
-        // Add the new argument to the list
-        positionalArgList.push_back(newArg);
+/**
+ * @brief Set the schema version included in every cache key
+ *
+ * @param schemaVersion - New schema version
+ */
+void cmd_line_parse::setParseCacheSchemaVersion(uint64_t schemaVersion)
+{
+    if (parseCache != nullptr)
+    {
+        parseCache->setSchemaVersion(schemaVersion);
     }
 }
 
-//=================================================================================================
-//======================= Parse interface methods =================================================
-//=================================================================================================
 /*
  * @brief Set the name of the positional argument to stop parsing
  *
@@ -779,18 +1211,60 @@ void cmd_line_parse::setPositionalNameStop(const char* positionalArgumentName)
  */
 int cmd_line_parse::parse(int argc, char* argv[], int startingArgIndex, int endingArgIndex)
 {
-    // Load the argument vector
-    argvArray.clear();
+    // Check the parse result cache
+    std::string cacheKey;
+    const bool cacheParse = ((parseCache != nullptr) && isParseCacheable());
+    if (cacheParse)
+    {
+        parseCache->buildKey(argc, argv, startingArgIndex, endingArgIndex, cacheKey);
+        const parse_cache::cacheEntry* cachedResult = parseCache->find(cacheKey);
+        if (cachedResult != nullptr)
+        {
+            if (programName.empty())
+            {
+                programName = argv[0];
+            }
+
+            restoreArgState(cachedResult->args);
+            parseingPositionNumber = cachedResult->parsePosition;
+            positionalStopArgumentFound = cachedResult->positionalStop;
+            currentArgumentIndex = cachedResult->returnValue;
+            parser_base::clearParsingError();
+            return cachedResult->returnValue;
+        }
+
+        // Every cached parse starts from the same argument state
+        restoreArgState(parseCache->getDefaults());
+        parseingPositionNumber = 1;
+        positionalStopArgumentFound = false;
+    }
+    fileSourceRead = false;
+    parseUncacheable = false;
+    pendingValidations.clear();
+
+    // Release the previous session and load the argument vector into one arena block
+    std::pmr::vector<std::string_view>(parser_base::getParseResource()).swap(argvArray);
+    parser_base::resetParseArena();
+    size_t argvLength = 0;
+    for (int argIdx = 0; argIdx < argc; argIdx++)
+    {
+        argvLength += strlen(argv[argIdx]) + 1;
+    }
+    auto* argvStorage = static_cast<parserchar*>(parser_base::getParseResource()->allocate(argvLength, alignof(parserchar)));
+    argvArray.reserve(static_cast<size_t>(argc));
     for (int argIdx = 0; argIdx < argc; argIdx++)
     {
-        argvArray.emplace_back(argv[argIdx]);
+        size_t argLength = strlen(argv[argIdx]);
+        memcpy(argvStorage, argv[argIdx], argLength + 1);
+        argvArray.emplace_back(argvStorage, argLength);
+        argvStorage += argLength + 1;
     }
 
     // Check for program name default
     if(programName.empty())
     {
         // Set program name from argument 0
-        programName = argvArray[0];
+        programName = parserstr(argvArray[0]);
     }
 
     // Parse the rest of the arguments
@@ -799,6 +1273,15 @@ int cmd_line_parse::parse(int argc, char* argv[], int startingArgIndex, int endi
     argcount = std::min(argcount, argc);
     parser_base::clearParsingError();
 
+    // Check the argument text once before any value is converted
+    if (parser_base::isUtf8Validation())
+    {
+        for (int argIdx = currentArgumentIndex; argIdx < argcount; argIdx++)
+        {
+            parser_base::checkUtf8Input(argvArray[argIdx], "argv[" + std::to_string(argIdx) + "]");
+        }
+    }
+
     while ((currentArgumentIndex < argcount) && parser_base::isParserAbort() && (!positionalStopArgumentFound))
     {
         // Check for key delimiter
@@ -814,6 +1297,9 @@ int cmd_line_parse::parse(int argc, char* argv[], int startingArgIndex, int endi
 
     int returnValue = currentArgumentIndex; //number of arguments parsed
 
+    // Check the tokenized values with the argument validators
+    runPendingValidations();
+
     // If we haven't already failed, check if all required arguments were found
     if (!parser_base::isParsingError())
     {
@@ -823,17 +1309,58 @@ int cmd_line_parse::parse(int argc, char* argv[], int startingArgIndex, int endi
     // Display help on error
     if (parser_base::isParsingError()) 
     {
-        if (displayHelpOnError || (enableDefaultHelp && dynamic_cast< varg<bool>* >(helpFlag)->value))
+        if (displayHelpOnError || (enableDefaultHelp && isHelpFlagSet()))
         {
             displayHelp(std::cerr);
         }
         returnValue = -1; //-1 for error
     }
 
+    // Save the successful result, file values may change between calls
+    if (cacheParse && (returnValue >= 0) && !fileSourceRead && !parseUncacheable)
+    {
+        parse_cache::cacheEntry newEntry = {std::move(cacheKey), returnValue, parseingPositionNumber, positionalStopArgumentFound, {}};
+        saveArgState(newEntry.args);
+        parseCache->insert(std::move(newEntry));
+    }
+
     // Return the number of arguments parsed or -1 for error
     return returnValue;
 }
 
+/**
+ * @brief Convert and check every deferred argument value now, reporting each
+ *        invalid value
+ *
+ * @return true  - All argument values are valid
+ * @return false - One or more argument values are invalid, the parsing error is set
+ */
+bool cmd_line_parse::validateAll()
+{
+    bool valid = true;
+    auto validateArg = [this, &valid](const ArgEntry& currentArg)
+    {
+        if ((currentArg.argData != nullptr) && (valueParseStatus_e::PARSE_SUCCESS_e != currentArg.argData->validate()))
+        {
+            std::cerr << parser_base::getParserStringList()->getInvalidAssignmentMessage(parserstr(currentArg.name)) << std::endl;
+            valid = false;
+        }
+    };
+
+    for (auto const& keyArg : parser_base::getKeyArgList())
+    {
+        validateArg(keyArg);
+    }
+
+    for (auto const& positionalArg : parser_base::getPositionalArgList())
+    {
+        validateArg(positionalArg);
+    }
+
+    parser_base::setParsingError(!valid);
+    return valid;
+}
+
 //=================================================================================================
 //======================= Help display interface methods ==========================================
 //=================================================================================================
@@ -870,11 +1397,11 @@ void cmd_line_parse::displayPositionHelp(std::ostream &outStream)
     const size_t optionKeyWidth = parser_base::getOptionKeyWidth();
     const size_t helpKeyWidth = parser_base::getHelpKeyWidth(optionKeyWidth);
 
-    if (!positionalArgList.empty())
+    if (!parser_base::isPositionalArgListEmpty())
     {
         // Display the position arguments list
         outStream << parser_base::getParserStringList()->getPositionalArgumentsMessage() << std::endl;
-        for (auto const& positionalArg : positionalArgList)
+        for (auto const& positionalArg : parser_base::getPositionalArgList())
         {
             // Display the arg block
             displayArgHelpBlock(outStream, positionalArg.optionString, positionalArg.help, optionKeyWidth, helpKeyWidth);
@@ -908,4 +1435,48 @@ void cmd_line_parse::displayHelp(std::ostream &outStream)
     }
 }
 
+/**
+ * @brief Get the heap memory held by the parser by category
+ *
+ * @return memoryUsageReport - Heap bytes and blocks per category
+ */
+memoryUsageReport cmd_line_parse::memoryUsage() const
+{
+    memoryUsageReport report = parser_base::memoryUsage();
+    for (const parserstr* text : {&programName, &usageText, &descriptionText, &epilogText, &keyPrefix, &positionalStop})
+    {
+        report.schema += getStringHeapUsage(*text);
+    }
+
+    report.parseBuffers += getContainerHeapUsage(pendingValidations);
+    if (parseCache != nullptr)
+    {
+        report.parseBuffers += heapUsage{sizeof(parse_cache), 1};
+        report.parseBuffers += parseCache->getHeapUsage();
+    }
+    return report;
+}
+
+/**
+ * @brief Print the memory usage report
+ *
+ * @param outStream   - Output stream for the report
+ * @param perArgument - True to add a line for each key and positional argument
+ */
+void cmd_line_parse::displayMemoryUsage(std::ostream &outStream, bool perArgument) const
+{
+    displayMemoryUsageReport(outStream, memoryUsage());
+    if (perArgument)
+    {
+        for (const ArgEntry& keyArg : getKeyArgList())
+        {
+            displayArgMemoryUsage(outStream, keyArg);
+        }
+        for (const ArgEntry& positionalArg : getPositionalArgList())
+        {
+            displayArgMemoryUsage(outStream, positionalArg);
+        }
+    }
+}
+
 /** @} */
@@ -28,8 +28,34 @@
 
 // Includes
 #include <iostream>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
 #include "cmd_line_parse_api_lib_private.h"
 
+/**
+ * @brief Copy the leading list values to the C reflection array and remove them from the list.
+ *        Contiguous storage of trivially copyable elements is copied with a single memcpy.
+ *
+ * @param cArray       - C reflection array
+ * @param elementCount - Number of elements in the C reflection array
+ * @param values       - List argument value storage
+ */
+template <typename T, typename Storage> static void copyListValues(T* cArray, int elementCount, Storage& values)
+{
+    const size_t copyCount = std::min(static_cast<size_t>(std::max(elementCount, 0)), values.size());
+
+    if constexpr (argparser::listStorageIsContiguous<Storage>::value && std::is_trivially_copyable_v<T>)
+    {
+        memcpy(cArray, values.data(), copyCount * sizeof(T));
+    }
+    else
+    {
+        std::copy_n(values.begin(), copyCount, cArray);
+    }
+    values.erase(values.begin(), values.begin() + copyCount);
+}
+
 /**
  * @brief Update the C corresponding reflection of the signed short varg object
  *
@@ -43,11 +69,7 @@ static void updateParserArgCDataShort(argHandle arg)
     }
     else
     {
-        for (int index = 0; (index < arg->elementCount) && (!arg->argptr.vargIntf->isEmpty()); index++)
-        {
-            (arg->cStoragePtr.shortIntVal)[index] = arg->argptr.shortintArrayArg->value.front();
-            arg->argptr.shortintArrayArg->value.pop_front();
-        }
+        copyListValues(arg->cStoragePtr.shortIntVal, arg->elementCount, arg->argptr.shortintArrayArg->value);
     }
 }
 
@@ -64,11 +86,7 @@ static void updateParserArgCDataInt(argHandle arg)
     }
     else
     {
-        for (int index = 0; (index < arg->elementCount) && (!arg->argptr.vargIntf->isEmpty()); index++)
-        {
-            (arg->cStoragePtr.integerVal)[index] = arg->argptr.intArrayArg->value.front();
-            arg->argptr.intArrayArg->value.pop_front();
-        }
+        copyListValues(arg->cStoragePtr.integerVal, arg->elementCount, arg->argptr.intArrayArg->value);
     }
 }
 
@@ -85,11 +103,7 @@ static void updateParserArgCDataLong(argHandle arg)
     }
     else
     {
-        for (int index = 0; (index < arg->elementCount) && (!arg->argptr.vargIntf->isEmpty()); index++)
-        {
-            (arg->cStoragePtr.longIntVal)[index] = arg->argptr.longintArrayArg->value.front();
-            arg->argptr.longintArrayArg->value.pop_front();
-        }
+        copyListValues(arg->cStoragePtr.longIntVal, arg->elementCount, arg->argptr.longintArrayArg->value);
     }
 }
 
@@ -106,11 +120,7 @@ static void updateParserArgCDataLongLong(argHandle arg)
     }
     else
     {
-        for (int index = 0; (index < arg->elementCount) && (!arg->argptr.vargIntf->isEmpty()); index++)
-        {
-            (arg->cStoragePtr.llIntVal)[index] = arg->argptr.llintArrayArg->value.front();
-            arg->argptr.llintArrayArg->value.pop_front();
-        }
+        copyListValues(arg->cStoragePtr.llIntVal, arg->elementCount, arg->argptr.llintArrayArg->value);
     }
 }
 
@@ -127,11 +137,7 @@ static void updateParserArgCDataUShort(argHandle arg)
     }
     else
     {
-        for (int index = 0; (index < arg->elementCount) && (!arg->argptr.vargIntf->isEmpty()); index++)
-        {
-            (arg->cStoragePtr.shortUIntVal)[index] = arg->argptr.shortuintArrayArg->value.front();
-            arg->argptr.shortuintArrayArg->value.pop_front();
-        }
+        copyListValues(arg->cStoragePtr.shortUIntVal, arg->elementCount, arg->argptr.shortuintArrayArg->value);
     }
 }
 
@@ -148,11 +154,7 @@ static void updateParserArgCDataUInt(argHandle arg)
     }
     else
     {
-        for (int index = 0; (index < arg->elementCount) && (!arg->argptr.vargIntf->isEmpty()); index++)
-        {
-            (arg->cStoragePtr.unsignedVal)[index] = arg->argptr.uintArrayArg->value.front();
-            arg->argptr.uintArrayArg->value.pop_front();
-        }
+        copyListValues(arg->cStoragePtr.unsignedVal, arg->elementCount, arg->argptr.uintArrayArg->value);
     }
 }
 
@@ -169,11 +171,7 @@ static void updateParserArgCDataULong(argHandle arg)
     }
     else
     {
-        for (int index = 0; (index < arg->elementCount) && (!arg->argptr.vargIntf->isEmpty()); index++)
-        {
-            (arg->cStoragePtr.longUIntVal)[index] = arg->argptr.longuintArrayArg->value.front();
-            arg->argptr.longuintArrayArg->value.pop_front();
-        }
+        copyListValues(arg->cStoragePtr.longUIntVal, arg->elementCount, arg->argptr.longuintArrayArg->value);
     }
 }
 
@@ -190,11 +188,7 @@ static void updateParserArgCDataULongLong(argHandle arg)
     }
     else
     {
-        for (int index = 0; (index < arg->elementCount) && (!arg->argptr.vargIntf->isEmpty()); index++)
-        {
-            (arg->cStoragePtr.llUIntVal)[index] = arg->argptr.lluintArrayArg->value.front();
-            arg->argptr.lluintArrayArg->value.pop_front();
-        }
+        copyListValues(arg->cStoragePtr.llUIntVal, arg->elementCount, arg->argptr.lluintArrayArg->value);
     }
 }
 
@@ -211,11 +205,7 @@ static void updateParserArgCDataFloat(argHandle arg)
     }
     else
     {
-        for (int index = 0; (index < arg->elementCount) && (!arg->argptr.vargIntf->isEmpty()); index++)
-        {
-            (arg->cStoragePtr.floatVal)[index] = arg->argptr.floatArrayArg->value.front();
-            arg->argptr.floatArrayArg->value.pop_front();
-        }
+        copyListValues(arg->cStoragePtr.floatVal, arg->elementCount, arg->argptr.floatArrayArg->value);
     }
 }
 
@@ -232,11 +222,7 @@ static void updateParserArgCDataBool(argHandle arg)
     }
     else
     {
-        for (int index = 0; (index < arg->elementCount) && (!arg->argptr.vargIntf->isEmpty()); index++)
-        {
-            (arg->cStoragePtr.flagVal)[index] = arg->argptr.boolArrayArg->value.front();
-            arg->argptr.boolArrayArg->value.pop_front();
-        }
+        copyListValues(arg->cStoragePtr.flagVal, arg->elementCount, arg->argptr.boolArrayArg->value);
     }
 }
 
@@ -270,10 +256,11 @@ static void updateParserArgCDataStringArray(argHandle arg)
 {
     if (arg->argptr.vargIntf->isList()) 
     {
-        for (int index = 0; (index < (arg->elementCount)) && (!arg->argptr.vargIntf->isEmpty()); index++)
+        // Strings stay in the list so the reflected pointers remain valid
+        auto& stringValues = arg->argptr.stringArrayArg->value;
+        for (size_t index = 0; (static_cast<int>(index) < arg->elementCount) && (index < stringValues.size()); index++)
         {
-            (arg->cStoragePtr.stringArray)[index] = (char*)(arg->argptr.stringArrayArg->value.front().c_str());
-            arg->argptr.stringArrayArg->value.pop_front();
+            (arg->cStoragePtr.stringArray)[index] = (char*)(stringValues[index].c_str());
         }
     }
 }
@@ -0,0 +1,216 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file parse_cache.cpp
+ * @ingroup libcmd_line_parser
+ * @{
+ */
+
+// Includes
+#include <cstring>
+#include <utility>
+#include "parse_cache.h"
+
+using namespace argparser;
+
+//============================================================================================================================
+//============================================================================================================================
+//  Constructor functions
+//============================================================================================================================
+//============================================================================================================================
+
+/**
+ * @brief Construct an empty parse cache
+ *
+ * @param entryLimit - Maximum number of cached parse results
+ * @param version    - Schema version included in every key
+ */
+parse_cache::parse_cache(size_t entryLimit, uint64_t version) :
+    lruList(), entryIndex(), maxEntries(entryLimit), schemaVersion(version), defaultArgs(), stats{0, 0, 0}
+{
+    entryIndex.reserve(entryLimit);
+}
+
+//============================================================================================================================
+//============================================================================================================================
+//  Public functions
+//============================================================================================================================
+//============================================================================================================================
+
+/**
+ * @brief Compute the 64 bit FNV-1a hash of a parse key
+ *
+ * @param key - Parse key
+ *
+ * @return uint64_t - Key hash
+ */
+uint64_t parse_cache::hashKey(std::string_view key)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (char keyChar : key)
+    {
+        hash ^= static_cast<unsigned char>(keyChar);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief Build the parse key for a parse call.  The key is the schema version
+ *        and index range followed by each argv token with its terminating null,
+ *        so different token splits never produce the same key.
+ *
+ * @param argc             - Number of char pointers in the argv[] array
+ * @param argv             - Array of command line text entries
+ * @param startingArgIndex - argv index to start parsing arguments
+ * @param endingArgIndex   - argv index to stop parsing arguments
+ * @param key              - Returned parse key
+ */
+void parse_cache::buildKey(int argc, char* argv[], int startingArgIndex, int endingArgIndex, std::string& key) const
+{
+    const int header[] = {argc, startingArgIndex, endingArgIndex};
+    key.assign(reinterpret_cast<const char*>(&schemaVersion), sizeof(schemaVersion));
+    key.append(reinterpret_cast<const char*>(header), sizeof(header));
+    for (int argIdx = 0; argIdx < argc; argIdx++)
+    {
+        key.append(argv[argIdx], strlen(argv[argIdx]) + 1);
+    }
+}
+
+/**
+ * @brief Find a parse result and mark it most recently used
+ *
+ * @param key - Parse key
+ *
+ * @return const cacheEntry* - Cached parse result or nullptr if the key is not cached
+ */
+const parse_cache::cacheEntry* parse_cache::find(const std::string& key)
+{
+    auto indexEntry = entryIndex.find(key);
+    if (indexEntry == entryIndex.end())
+    {
+        stats.misses++;
+        return nullptr;
+    }
+
+    stats.hits++;
+    lruList.splice(lruList.begin(), lruList, indexEntry->second);
+    return &lruList.front();
+}
+
+/**
+ * @brief Add a parse result, evicting the least recently used entry if the cache is full
+ *
+ * @param entry - Parse result to add
+ */
+void parse_cache::insert(cacheEntry&& entry)
+{
+    if ((maxEntries == 0) || (entryIndex.find(entry.key) != entryIndex.end()))
+    {
+        return;
+    }
+
+    while (lruList.size() >= maxEntries)
+    {
+        entryIndex.erase(lruList.back().key);
+        lruList.pop_back();
+        stats.evictions++;
+    }
+
+    lruList.push_front(std::move(entry));
+    entryIndex.emplace(lruList.front().key, lruList.begin());
+}
+
+/**
+ * @brief Remove all entries, the counters are not reset
+ */
+void parse_cache::clear()
+{
+    entryIndex.clear();
+    lruList.clear();
+}
+
+/**
+ * @brief Set the schema version, all entries are removed if it changes
+ *
+ * @param version - New schema version
+ */
+void parse_cache::setSchemaVersion(uint64_t version)
+{
+    if (version != schemaVersion)
+    {
+        clear();
+        schemaVersion = version;
+    }
+}
+
+/**
+ * @brief Set the argument state every parse starts from, all entries are removed
+ *        because they were built from the previous argument set
+ *
+ * @param defaults - Key argument states followed by positional argument states
+ */
+void parse_cache::setDefaults(std::vector<argSnapshot>&& defaults)
+{
+    clear();
+    defaultArgs = std::move(defaults);
+}
+
+/**
+ * @brief Get the heap memory held by the cached results, the default
+ *        argument state and an estimate of the key index
+ *
+ * @return heapUsage - Heap bytes and blocks held by the cache
+ */
+heapUsage parse_cache::getHeapUsage() const
+{
+    auto snapshotUsage = [](const std::vector<argSnapshot>& snapshots)
+                         {
+                             heapUsage usage = getContainerHeapUsage(snapshots);
+                             for (const argSnapshot& snapshot : snapshots)
+                             {
+                                 usage += snapshot.value.getHeapUsage();
+                             }
+                             return usage;
+                         };
+
+    heapUsage usage = snapshotUsage(defaultArgs);
+    for (const cacheEntry& entry : lruList)
+    {
+        usage += heapUsage{sizeof(entry) + (2 * sizeof(void*)), 1};
+        usage += getStringHeapUsage(entry.key);
+        usage += snapshotUsage(entry.args);
+    }
+
+    // Key index, one node per entry plus the bucket array
+    const size_t nodeSize = sizeof(void*) + sizeof(std::string_view) + sizeof(std::list<cacheEntry>::iterator) + sizeof(size_t);
+    usage += heapUsage{entryIndex.size() * nodeSize, entryIndex.size()};
+    if (entryIndex.bucket_count() > 1)
+    {
+        usage += heapUsage{entryIndex.bucket_count() * sizeof(void*), 1};
+    }
+    return usage;
+}
+
+/** @} */
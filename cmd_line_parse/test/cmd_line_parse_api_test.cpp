@@ -124,7 +124,7 @@ template <typename T> class CreateListVargApi : public testing::Test
         argHandle   cvarghandle;
         T           cvarg[TEST_ARRAY_COUNT];
 
-        std::list<T> getVargValue(void);
+        std::vector<T> getVargValue(void);
         argVarType_e getVargType(void);
 };
 
@@ -140,17 +140,17 @@ template <> CreateListVargApi<long unsigned>::CreateListVargApi()       {cvargha
 
 template <> CreateListVargApi<double>::CreateListVargApi()              {cvarghandle = createDoubleArrayParserArg(&(cvarg[0]), TEST_ARRAY_COUNT);}
 
-template <> std::list<short int>           CreateListVargApi<short int>::getVargValue(void)            {return (cvarghandle->argptr.shortintArrayArg->value);}
-template <> std::list<int>                 CreateListVargApi<int>::getVargValue(void)                  {return (cvarghandle->argptr.intArrayArg->value);}
-template <> std::list<long int>            CreateListVargApi<long int>::getVargValue(void)             {return (cvarghandle->argptr.longintArrayArg->value);}
-template <> std::list<long long int>       CreateListVargApi<long long int>::getVargValue(void)        {return (cvarghandle->argptr.llintArrayArg->value);}
+template <> std::vector<short int>           CreateListVargApi<short int>::getVargValue(void)            {return (cvarghandle->argptr.shortintArrayArg->value);}
+template <> std::vector<int>                 CreateListVargApi<int>::getVargValue(void)                  {return (cvarghandle->argptr.intArrayArg->value);}
+template <> std::vector<long int>            CreateListVargApi<long int>::getVargValue(void)             {return (cvarghandle->argptr.longintArrayArg->value);}
+template <> std::vector<long long int>       CreateListVargApi<long long int>::getVargValue(void)        {return (cvarghandle->argptr.llintArrayArg->value);}
 
-template <> std::list<short unsigned>      CreateListVargApi<short unsigned >::getVargValue(void)      {return (cvarghandle->argptr.shortuintArrayArg->value);}
-template <> std::list<unsigned>            CreateListVargApi<unsigned>::getVargValue(void)             {return (cvarghandle->argptr.uintArrayArg->value);}
-template <> std::list<long unsigned>       CreateListVargApi<long unsigned>::getVargValue(void)        {return (cvarghandle->argptr.longuintArrayArg->value);}
-//template <> std::list<long long unsigned>  CreateListVargApi<long long unsigned>::getVargValue(void)   {return (cvarghandle->argptr.lluintArrayArg->value);}
+template <> std::vector<short unsigned>      CreateListVargApi<short unsigned >::getVargValue(void)      {return (cvarghandle->argptr.shortuintArrayArg->value);}
+template <> std::vector<unsigned>            CreateListVargApi<unsigned>::getVargValue(void)             {return (cvarghandle->argptr.uintArrayArg->value);}
+template <> std::vector<long unsigned>       CreateListVargApi<long unsigned>::getVargValue(void)        {return (cvarghandle->argptr.longuintArrayArg->value);}
+//template <> std::vector<long long unsigned>  CreateListVargApi<long long unsigned>::getVargValue(void)   {return (cvarghandle->argptr.lluintArrayArg->value);}
 
-template <> std::list<double>              CreateListVargApi<double>::getVargValue(void)               {return (cvarghandle->argptr.floatArrayArg->value);}
+template <> std::vector<double>              CreateListVargApi<double>::getVargValue(void)               {return (cvarghandle->argptr.floatArrayArg->value);}
 
 template <> argVarType_e        CreateListVargApi<short int>::getVargType(void)             {return (argVarType_e::VT_SHORT_INT);}
 template <> argVarType_e        CreateListVargApi<int>::getVargType(void)                   {return (argVarType_e::VT_INTEGER);}
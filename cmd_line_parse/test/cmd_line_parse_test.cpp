@@ -29,9 +29,22 @@
 // Includes
 #include "varg.h"
 #include "listvarg.h"
+#include "vargview.h"
+#include "vargenumset.h"
+#include "vargmap.h"
+#include "vargfile.h"
+#include "internlistvarg.h"
+#include "vargpattern.h"
 #include "parser_string_list.h"
 #include "cmd_line_parse.h"
 #include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <gtest/gtest.h>
 
 const size_t defaultArgWidth = 14;
@@ -406,11 +419,9 @@ TEST(cmd_line_parse, parseTestAddListArg)
 
     EXPECT_EQ(3, testvar.parse(3, argv));
     EXPECT_EQ(3, testlistvarg.value.size());
-    EXPECT_EQ(18, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(22, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(43, testlistvarg.value.front());
+    EXPECT_EQ(18, testlistvarg.value[0]);
+    EXPECT_EQ(22, testlistvarg.value[1]);
+    EXPECT_EQ(43, testlistvarg.value[2]);
 }
 
 TEST(cmd_line_parse, parseTestAddListArgMultipleArgv)
@@ -430,11 +441,9 @@ TEST(cmd_line_parse, parseTestAddListArgMultipleArgv)
 
     EXPECT_EQ(5, testvar.parse(5, argv));
     EXPECT_EQ(3, testlistvarg.value.size());
-    EXPECT_EQ(19, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(21, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(42, testlistvarg.value.front());
+    EXPECT_EQ(19, testlistvarg.value[0]);
+    EXPECT_EQ(21, testlistvarg.value[1]);
+    EXPECT_EQ(42, testlistvarg.value[2]);
 }
 
 TEST(cmd_line_parse, parseTestAddListArgTooFew)
@@ -494,11 +503,9 @@ TEST(cmd_line_parse, parseTestAddDynamicListArg)
 
     EXPECT_EQ(3, testvar.parse(3, argv));
     EXPECT_EQ(3, testlistvarg.value.size());
-    EXPECT_EQ(18, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(22, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(43, testlistvarg.value.front());
+    EXPECT_EQ(18, testlistvarg.value[0]);
+    EXPECT_EQ(22, testlistvarg.value[1]);
+    EXPECT_EQ(43, testlistvarg.value[2]);
 }
 
 TEST(cmd_line_parse, parseTestAddDynamicListArg2Vals)
@@ -516,9 +523,8 @@ TEST(cmd_line_parse, parseTestAddDynamicListArg2Vals)
 
     EXPECT_EQ(3, testvar.parse(3, argv));
     EXPECT_EQ(2, testlistvarg.value.size());
-    EXPECT_EQ(18, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(22, testlistvarg.value.front());
+    EXPECT_EQ(18, testlistvarg.value[0]);
+    EXPECT_EQ(22, testlistvarg.value[1]);
 }
 
 TEST(cmd_line_parse, parseTestAddDynamicListArg2ValsMultiArgv)
@@ -537,9 +543,8 @@ TEST(cmd_line_parse, parseTestAddDynamicListArg2ValsMultiArgv)
 
     EXPECT_EQ(4, testvar.parse(4, argv));
     EXPECT_EQ(2, testlistvarg.value.size());
-    EXPECT_EQ(81, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(13, testlistvarg.value.front());
+    EXPECT_EQ(81, testlistvarg.value[0]);
+    EXPECT_EQ(13, testlistvarg.value[1]);
 }
 
 TEST(cmd_line_parse, parseTestAddDynamicListArgMultiArgvSwitchTermination)
@@ -561,9 +566,8 @@ TEST(cmd_line_parse, parseTestAddDynamicListArgMultiArgvSwitchTermination)
 
     EXPECT_EQ(5, testvar.parse(5, argv));
     EXPECT_EQ(2, testlistvarg.value.size());
-    EXPECT_EQ(81, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(13, testlistvarg.value.front());
+    EXPECT_EQ(81, testlistvarg.value[0]);
+    EXPECT_EQ(13, testlistvarg.value[1]);
 }
 
 TEST(cmd_line_parse, parseTestAddDynamicListNargNeg1ArgcTermination)
@@ -582,9 +586,8 @@ TEST(cmd_line_parse, parseTestAddDynamicListNargNeg1ArgcTermination)
 
     EXPECT_EQ(4, testvar.parse(4, argv));
     EXPECT_EQ(2, testlistvarg.value.size());
-    EXPECT_EQ(81, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(13, testlistvarg.value.front());
+    EXPECT_EQ(81, testlistvarg.value[0]);
+    EXPECT_EQ(13, testlistvarg.value[1]);
 }
 
 TEST(cmd_line_parse, parseTestAddDynamicListNargNeg1SwitchTermination)
@@ -607,9 +610,8 @@ TEST(cmd_line_parse, parseTestAddDynamicListNargNeg1SwitchTermination)
 
     EXPECT_EQ(5, testvar.parse(5, argv));
     EXPECT_EQ(2, testlistvarg.value.size());
-    EXPECT_EQ(81, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(13, testlistvarg.value.front());
+    EXPECT_EQ(81, testlistvarg.value[0]);
+    EXPECT_EQ(13, testlistvarg.value[1]);
 }
 
 TEST(cmd_line_parse, parseTestAddDynamicListNargNeg1LongSwitchTermination)
@@ -635,15 +637,11 @@ TEST(cmd_line_parse, parseTestAddDynamicListNargNeg1LongSwitchTermination)
 
     EXPECT_EQ(8, testvar.parse(8, argv));
     EXPECT_EQ(5, testlistvarg.value.size());
-    EXPECT_EQ(81, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(13, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(14, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(15, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(16, testlistvarg.value.front());
+    EXPECT_EQ(81, testlistvarg.value[0]);
+    EXPECT_EQ(13, testlistvarg.value[1]);
+    EXPECT_EQ(14, testlistvarg.value[2]);
+    EXPECT_EQ(15, testlistvarg.value[3]);
+    EXPECT_EQ(16, testlistvarg.value[4]);
 }
 
 TEST(cmd_line_parse, parseTestAddDynamicListNargNeg1FailAssignment)
@@ -668,7 +666,7 @@ TEST(cmd_line_parse, parseTestAddDynamicListNargNeg1FailAssignment)
     testvar.disableHelpDisplayOnError();
     EXPECT_EQ(-1, testvar.parse(5, argv));
     EXPECT_EQ(1, testlistvarg.value.size());
-    EXPECT_EQ(81, testlistvarg.value.front());
+    EXPECT_EQ(81, testlistvarg.value[0]);
     parserstr output = testing::internal::GetCapturedStderr();
     EXPECT_STREQ("\"-i foo\" assignment failed\n", output.c_str());
 }
@@ -1000,4 +998,1000 @@ TEST(cmd_line_parse, parseTestMissingRequiredSubcommand)
     EXPECT_STREQ("\"subcommand\" required argument missing\n", output.c_str());
 }
 
+TEST(cmd_line_parse, parseTestValueStoreArgs)
+{
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+
+    testvar.addFlagValue("verbose", "-v,--verbose", "This is the test flag argument");
+    testvar.addKeyValue<int>("count", "-c,--count", "This is the test count argument", 1);
+    testvar.addKeyValue<std::vector<double>>("scale", "-s,--scale", "This is the test list argument", {}, -4);
+    testvar.addPositionalValue<std::string>("outputname", "This is the test output name argument", "outname");
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "george";
+    parserchar opt2[] = "-v";
+    parserchar opt3[] = "--count=12";
+    parserchar opt4[] = "-s";
+    parserchar opt5[] = "1.5,2.5";
+    parserchar* argv[] = {progname, opt1, opt2, opt3, opt4, opt5};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    // Parse
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    ASSERT_NE(nullptr, testvar.getValue<bool>("verbose"));
+    EXPECT_TRUE(*testvar.getValue<bool>("verbose"));
+    EXPECT_EQ(12, *testvar.getValue<int>("count"));
+    EXPECT_EQ(nullptr, testvar.getValue<long int>("count"));
+    EXPECT_EQ(nullptr, testvar.getValue<int>("missing"));
+
+    const std::vector<double>* scaleList = testvar.getValue<std::vector<double>>("scale");
+    ASSERT_NE(nullptr, scaleList);
+    ASSERT_EQ(2U, scaleList->size());
+    EXPECT_DOUBLE_EQ(1.5, (*scaleList)[0]);
+    EXPECT_DOUBLE_EQ(2.5, (*scaleList)[1]);
+    EXPECT_EQ("george", *testvar.getValue<std::string>("outputname"));
+    EXPECT_FALSE(*testvar.getValue<bool>("help"));
+}
+
+TEST(cmd_line_parse, parseTestValueStoreNotList)
+{
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+
+    testing::internal::CaptureStderr();
+    testvar.addKeyValue<int>("count", "-c,--count", "This is the test count argument", 1, 3);
+    parserstr output = testing::internal::GetCapturedStderr();
+    EXPECT_STREQ("Only list type arguments can have an argument count of 3\n", output.c_str());
+    EXPECT_EQ(nullptr, testvar.getValue<int>("count"));
+}
+
+TEST(cmd_line_parse, parseTestValueStoreCopy)
+{
+    argparser::cmd_line_parse basevar("testprog [options]", "Description of the test program");
+    basevar.addKeyValue<unsigned>("count", "-c,--count", "This is the test count argument", 1);
+
+    argparser::cmd_line_parse testvar(basevar);
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "-c";
+    parserchar opt2[] = "7";
+    parserchar* argv[] = {progname, opt1, opt2};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    EXPECT_EQ(7U, *testvar.getValue<unsigned>("count"));
+    EXPECT_EQ(1U, *basevar.getValue<unsigned>("count"));
+}
+
+TEST(cmd_line_parse, parseTestMove)
+{
+    argparser::cmd_line_parse basevar("testprog [options]", "Description of the test program");
+    basevar.addKeyValue<unsigned>("count", "-c,--count", "This is the test count argument", 1);
+    basevar.addPositionalValue<std::string>("outputname", "This is the test output name argument", "outname");
+    argparser::varg<bool>* ownedArg = basevar.addFlagArgument(std::make_unique<argparser::varg<bool>>(false, true), "verbose", "-v,--verbose", "This is the test flag argument");
+
+    // The argument entries and the owned argument object are transferred, not copied
+    argparser::cmd_line_parse movedvar(std::move(basevar));
+    argparser::cmd_line_parse testvar;
+    testvar = std::move(movedvar);
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "-c";
+    parserchar opt2[] = "7";
+    parserchar opt3[] = "-v";
+    parserchar opt4[] = "george";
+    parserchar* argv[] = {progname, opt1, opt2, opt3, opt4};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    EXPECT_EQ(7U, *testvar.getValue<unsigned>("count"));
+    EXPECT_EQ("george", *testvar.getValue<std::string>("outputname"));
+    EXPECT_TRUE(ownedArg->value);
+}
+
+TEST(cmd_line_parse, parseTestOwnedArgumentCopy)
+{
+    argparser::varg<int>* ownedArg = nullptr;
+    std::unique_ptr<argparser::cmd_line_parse> copyvar;
+    {
+        argparser::cmd_line_parse basevar("testprog [options]", "Description of the test program");
+        ownedArg = basevar.addKeyArgument(std::make_unique<argparser::varg<int>>(2), "count", "-c,--count", "This is the test count argument");
+        basevar.addPositionalArgument(std::make_unique<argparser::listvarg<int>>(), "values", "This is the test list argument", -4);
+        copyvar = std::make_unique<argparser::cmd_line_parse>(basevar);
+    }
+
+    // The copy shares the owned argument objects and keeps them alive
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--count=5";
+    parserchar opt2[] = "1";
+    parserchar opt3[] = "2";
+    parserchar* argv[] = {progname, opt1, opt2, opt3};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    EXPECT_EQ(argc, copyvar->parse(argc, argv));
+    EXPECT_EQ(5, ownedArg->value);
+}
+
+TEST(cmd_line_parse, parseTestSharedSchemaClone)
+{
+    argparser::cmd_line_parse basevar("testprog [options]", "Description of the test program");
+    basevar.addKeyValue<unsigned>("count", "-c,--count", "This is the test count argument", 1);
+    basevar.addPositionalValue<std::string>("outputname", "This is the test output name argument", "outname");
+
+    // Each clone adds its own options to the shared base schema
+    argparser::cmd_line_parse clone1(basevar);
+    argparser::cmd_line_parse clone2(basevar);
+    clone1.addKeyValue<std::string>("region", "-r,--region", "This is the clone 1 region argument", "east");
+    clone2.addFlagValue("trace", "-t,--trace", "This is the clone 2 trace argument");
+    clone2.addPositionalValue<int>("level", "This is the clone 2 level argument", 0);
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "-c";
+    parserchar opt2[] = "7";
+    parserchar opt3[] = "--region=west";
+    parserchar opt4[] = "george";
+    parserchar* argv1[] = {progname, opt1, opt2, opt3, opt4};
+    int argc1 = sizeof(argv1) / sizeof(argv1[0]);
+    EXPECT_EQ(argc1, clone1.parse(argc1, argv1));
+
+    parserchar opt5[] = "-t";
+    parserchar opt6[] = "fred";
+    parserchar opt7[] = "3";
+    parserchar* argv2[] = {progname, opt5, opt6, opt7};
+    int argc2 = sizeof(argv2) / sizeof(argv2[0]);
+    EXPECT_EQ(argc2, clone2.parse(argc2, argv2));
+
+    // The values set in one clone are not seen by the base or the other clone
+    EXPECT_EQ(7U, *clone1.getValue<unsigned>("count"));
+    EXPECT_EQ("west", *clone1.getValue<std::string>("region"));
+    EXPECT_EQ("george", *clone1.getValue<std::string>("outputname"));
+    EXPECT_EQ(nullptr, clone1.getValue<bool>("trace"));
+
+    EXPECT_EQ(1U, *clone2.getValue<unsigned>("count"));
+    EXPECT_TRUE(*clone2.getValue<bool>("trace"));
+    EXPECT_EQ("fred", *clone2.getValue<std::string>("outputname"));
+    EXPECT_EQ(3, *clone2.getValue<int>("level"));
+    EXPECT_EQ(nullptr, clone2.getValue<std::string>("region"));
+
+    EXPECT_EQ(1U, *basevar.getValue<unsigned>("count"));
+    EXPECT_EQ("outname", *basevar.getValue<std::string>("outputname"));
+    EXPECT_EQ(nullptr, basevar.getValue<std::string>("region"));
+
+    // A clone of a clone sees the base and the added arguments
+    argparser::cmd_line_parse clone3(clone1);
+    EXPECT_EQ("west", *clone3.getValue<std::string>("region"));
+    EXPECT_EQ(7U, *clone3.getValue<unsigned>("count"));
+
+    testing::internal::CaptureStdout();
+    clone2.displayHelp(std::cout);
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("--count"));
+    EXPECT_NE(std::string::npos, output.find("--trace"));
+    EXPECT_EQ(std::string::npos, output.find("--region"));
+    EXPECT_LT(output.find("outputname"), output.find("level"));
+}
+
+TEST(cmd_line_parse, sharedSchemaMemoryUsage)
+{
+    argparser::cmd_line_parse basevar("testprog [options]", "Description of the test program", false, true);
+    for (int argIndex = 0; argIndex < 20; argIndex++)
+    {
+        std::string name = "option" + std::to_string(argIndex);
+        basevar.addKeyValue<int>(name, "--" + name, "This is a base schema argument", 0);
+    }
+
+    // The clone only holds the argument it added and the base entry it changed
+    argparser::cmd_line_parse clonevar(basevar);
+    const argparser::memoryUsageReport baseReport = basevar.memoryUsage();
+    argparser::memoryUsageReport cloneReport = clonevar.memoryUsage();
+    EXPECT_EQ(baseReport.sharedSchema.allocations, cloneReport.sharedSchema.allocations);
+    EXPECT_EQ(0U, cloneReport.keyLists.allocations);
+
+    clonevar.addKeyValue<int>("extra", "--extra", "This is the clone argument", 0);
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--option3=5";
+    parserchar* argv[] = {progname, opt1};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    EXPECT_EQ(argc, clonevar.parse(argc, argv));
+    EXPECT_EQ(5, *clonevar.getValue<int>("option3"));
+    EXPECT_EQ(0, *basevar.getValue<int>("option3"));
+
+    cloneReport = clonevar.memoryUsage();
+    EXPECT_EQ(2U, cloneReport.keyLists.allocations);
+    EXPECT_LT(cloneReport.schema.bytes, baseReport.schema.bytes / 4);
+}
+
+enum class bindMode_e
+{
+    FAST,
+    SAFE,
+    DEBUG,
+};
+
+struct bindConfig
+{
+    unsigned                    threads = 1;
+    bool                        verbose = false;
+    std::string                 output = "out.txt";
+    std::vector<int>            sizes;
+    bindMode_e                  mode = bindMode_e::SAFE;
+    std::vector<bindMode_e>     modeList;
+};
+
+TEST(cmd_line_parse, parseTestBindFields)
+{
+    bindConfig config;
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    testvar.bindTo(config)
+           .bind(&bindConfig::threads, "-t,--threads", "This is the thread count argument")
+           .bind(&bindConfig::verbose, "-v,--verbose", "This is the verbose flag argument")
+           .bind(&bindConfig::output, "-o,--output", "This is the output name argument")
+           .bind(&bindConfig::sizes, "-s,--sizes", "This is the size list argument")
+           .bindEnum(&bindConfig::mode, "-m,--mode", "This is the mode argument",
+                     {{"fast", bindMode_e::FAST}, {"safe", bindMode_e::SAFE}, {"debug", bindMode_e::DEBUG}})
+           .bindEnum(&bindConfig::modeList, "--modes", "This is the mode list argument",
+                     {{"fast", bindMode_e::FAST}, {"safe", bindMode_e::SAFE}, {"debug", bindMode_e::DEBUG}}, 2);
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--threads=8";
+    parserchar opt2[] = "-v";
+    parserchar opt3[] = "-o";
+    parserchar opt4[] = "result.txt";
+    parserchar opt5[] = "--sizes=1,2";
+    parserchar opt6[] = "3";
+    parserchar opt7[] = "--mode=debug";
+    parserchar opt8[] = "--modes=fast,debug";
+    parserchar* argv[] = {progname, opt1, opt2, opt3, opt4, opt5, opt6, opt7, opt8};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    // The values are converted straight into the structure
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    EXPECT_EQ(8U, config.threads);
+    EXPECT_TRUE(config.verbose);
+    EXPECT_EQ("result.txt", config.output);
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), config.sizes);
+    EXPECT_EQ(bindMode_e::DEBUG, config.mode);
+    EXPECT_EQ((std::vector<bindMode_e>{bindMode_e::FAST, bindMode_e::DEBUG}), config.modeList);
+
+    // The argument name is the last key without the key prefix
+    testing::internal::CaptureStdout();
+    testvar.displayHelp(std::cout);
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("-t,--threads=threads"));
+}
+
+TEST(cmd_line_parse, parseTestBindFieldErrors)
+{
+    bindConfig config;
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program", false, true);
+    testvar.disableHelpDisplayOnError();
+    testvar.bindKeyArgument(config, &bindConfig::threads, "-t,--threads", "This is the thread count argument", 1, true);
+    testvar.bindEnumKeyArgument(config, &bindConfig::mode, "-m,--mode", "This is the mode argument", {{"fast", bindMode_e::FAST}});
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--mode=slow";
+    parserchar* argv[] = {progname, opt1};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    // Unknown enum name and missing required argument, the fields are not changed
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(-1, testvar.parse(argc, argv));
+    std::string errorOutput = testing::internal::GetCapturedStderr();
+    EXPECT_NE(std::string::npos, errorOutput.find("slow"));
+    EXPECT_EQ(1U, config.threads);
+    EXPECT_EQ(bindMode_e::SAFE, config.mode);
+}
+
+TEST(cmd_line_parse, parseTestParseCacheHit)
+{
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    testvar.addFlagValue("verbose", "-v,--verbose", "This is the test flag argument");
+    testvar.addKeyValue<std::vector<int>>("count", "-c,--count", "This is the test count argument", {}, -4);
+    testvar.addPositionalValue<std::string>("outputname", "This is the test output name argument", "outname");
+    EXPECT_EQ(nullptr, testvar.getParseCacheStats());
+    testvar.enableParseCache(4);
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "george";
+    parserchar opt2[] = "-v";
+    parserchar opt3[] = "--count=1,2";
+    parserchar* argv[] = {progname, opt1, opt2, opt3};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    // Every parse starts from the default values, list values do not accumulate
+    for (int parseCount = 0; parseCount < 3; parseCount++)
+    {
+        EXPECT_EQ(argc, testvar.parse(argc, argv));
+        EXPECT_TRUE(*testvar.getValue<bool>("verbose"));
+        ASSERT_EQ(2U, testvar.getValue<std::vector<int>>("count")->size());
+        EXPECT_EQ("george", *testvar.getValue<std::string>("outputname"));
+    }
+
+    const argparser::parseCacheStats* stats = testvar.getParseCacheStats();
+    ASSERT_NE(nullptr, stats);
+    EXPECT_EQ(2U, stats->hits);
+    EXPECT_EQ(1U, stats->misses);
+
+    // A different command line restores the defaults before parsing
+    parserchar* shortArgv[] = {progname, opt3};
+    EXPECT_EQ(2, testvar.parse(2, shortArgv));
+    EXPECT_FALSE(*testvar.getValue<bool>("verbose"));
+    EXPECT_EQ("outname", *testvar.getValue<std::string>("outputname"));
+    EXPECT_EQ(2U, stats->misses);
+
+    // Restored result matches the original parse
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    EXPECT_TRUE(*testvar.getValue<bool>("verbose"));
+    EXPECT_EQ(3U, stats->hits);
+
+    // Schema change drops the cached results
+    testvar.setParseCacheSchemaVersion(1);
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    EXPECT_EQ(3U, stats->misses);
+
+    testvar.disableParseCache();
+    EXPECT_EQ(nullptr, testvar.getParseCacheStats());
+}
+
+TEST(cmd_line_parse, parseTestParseCacheErrorNotCached)
+{
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    testvar.disableHelpDisplayOnError();
+    testvar.addKeyValue<int>("count", "-c,--count", "This is the test count argument", 1);
+    testvar.enableParseCache(4);
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--count=x";
+    parserchar* argv[] = {progname, opt1};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(-1, testvar.parse(argc, argv));
+    EXPECT_EQ(-1, testvar.parse(argc, argv));
+    testing::internal::GetCapturedStderr();
+    EXPECT_EQ(0U, testvar.getParseCacheStats()->hits);
+    EXPECT_EQ(2U, testvar.getParseCacheStats()->misses);
+}
+
+TEST(cmd_line_parse, parseTestParseCacheVargBypass)
+{
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    argparser::varg<int> countArg(1);
+    testvar.addKeyArgument(&countArg, "count", "-c,--count", "This is the test count argument");
+    testvar.enableParseCache(4);
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--count=5";
+    parserchar* argv[] = {progname, opt1};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    EXPECT_EQ(5, countArg.value);
+    EXPECT_EQ(0U, testvar.getParseCacheStats()->hits);
+    EXPECT_EQ(0U, testvar.getParseCacheStats()->misses);
+}
+
+TEST(cmd_line_parse, parseTestInternedStringList)
+{
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    EXPECT_EQ(0U, testvar.getStringPoolStats().internCount);
+
+    argparser::internlistvarg hostArg(testvar.getStringPool());
+    testvar.addKeyArgument(&hostArg, "hosts", "-H,--hosts", "This is the test host list argument", -10);
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--hosts=alpha,beta,alpha,alpha";
+    parserchar opt2[] = "beta";
+    parserchar* argv[] = {progname, opt1, opt2};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    ASSERT_EQ(5U, hostArg.value.size());
+    EXPECT_EQ("alpha", hostArg.value[0]);
+    EXPECT_EQ("beta", hostArg.value[4]);
+
+    argparser::stringPoolStats stats = testvar.getStringPoolStats();
+    EXPECT_EQ(5U, stats.internCount);
+    EXPECT_EQ(2U, stats.uniqueCount);
+    EXPECT_DOUBLE_EQ(2.5, stats.dedupRatio());
+    EXPECT_EQ(14U, stats.bytesSaved());
+
+    // Copies share the pool so the interned views stay valid
+    argparser::cmd_line_parse copyvar(testvar);
+    EXPECT_EQ(&testvar.getStringPool(), &copyvar.getStringPool());
+}
+
+/**
+ * @brief Parser copy with its own tag argument, for the threaded parse tests
+ */
+struct threadTenant
+{
+    argparser::cmd_line_parse   parser;     ///< Copy of the base parser
+    argparser::internlistvarg   tagArg;     ///< Tenant tag list argument
+    std::string                 tagValue;   ///< Tenant tag argument string
+
+    threadTenant(const argparser::cmd_line_parse& baseParser, int threadIndex, int pass) :
+        parser(baseParser), tagArg(parser.getStringPool()), tagValue()
+    {
+        std::string tagKey = "--tag" + std::to_string(threadIndex) + "_" + std::to_string(pass);
+        parser.addKeyArgument(&tagArg, tagKey.substr(2), tagKey, "Thread tag list argument " + tagKey, -10);
+        tagValue = tagKey + "=a" + std::to_string(pass) + ",b" + std::to_string(threadIndex) + ",shared";
+    }
+
+    bool parseTags(int pass)
+    {
+        parserchar progname[] = "runprog";
+        parserchar* argv[] = {progname, tagValue.data()};
+        return ((parser.parse(2, argv) == 2) && (tagArg.value.size() == 3) && (tagArg.value[2] == "shared") &&
+                (tagArg.value[0] == ("a" + std::to_string(pass))));
+    }
+};
+
+TEST(cmd_line_parse, parseTestCopiesOnThreads)
+{
+    argparser::cmd_line_parse basevar("testprog [options]", "Description of the test program");
+    argparser::internlistvarg baseHostArg(basevar.getStringPool());
+    basevar.addKeyArgument(&baseHostArg, "hosts", "-H,--hosts", "This is the test host list argument", -10);
+
+    // Copies are handed to the worker threads, they share the string pool
+    constexpr int passCount = 200;
+    std::vector<std::unique_ptr<threadTenant>> tenantList[2];
+    for (int threadIndex = 0; threadIndex < 2; threadIndex++)
+    {
+        for (int pass = 0; pass < passCount; pass++)
+        {
+            tenantList[threadIndex].push_back(std::make_unique<threadTenant>(basevar, threadIndex, pass));
+        }
+    }
+
+    auto worker = [&tenantList](int threadIndex, size_t& failCount)
+    {
+        for (int pass = 0; pass < passCount; pass++)
+        {
+            failCount += (tenantList[threadIndex][pass]->parseTags(pass) ? 0 : 1);
+        }
+    };
+
+    size_t failCount[2] = {0, 0};
+    std::thread firstThread(worker, 0, std::ref(failCount[0]));
+    std::thread secondThread(worker, 1, std::ref(failCount[1]));
+    firstThread.join();
+    secondThread.join();
+
+    EXPECT_EQ(0U, failCount[0]);
+    EXPECT_EQ(0U, failCount[1]);
+    EXPECT_EQ(2U * passCount * 3U, basevar.getStringPoolStats().internCount);
+}
+
+TEST(cmd_line_parse, parseTestCopyOnThreads)
+{
+    argparser::cmd_line_parse basevar("testprog [options]", "Description of the test program");
+    argparser::internlistvarg baseHostArg(basevar.getStringPool());
+    basevar.addKeyArgument(&baseHostArg, "hosts", "-H,--hosts", "This is the test host list argument", -10);
+
+    // Each thread copies the base parser, registers its own argument and parses
+    constexpr int passCount = 200;
+    auto worker = [&basevar](int threadIndex, size_t& failCount)
+    {
+        for (int pass = 0; pass < passCount; pass++)
+        {
+            threadTenant tenant(basevar, threadIndex, pass);
+            failCount += (tenant.parseTags(pass) ? 0 : 1);
+        }
+    };
+
+    size_t failCount[2] = {0, 0};
+    std::thread firstThread(worker, 0, std::ref(failCount[0]));
+    std::thread secondThread(worker, 1, std::ref(failCount[1]));
+    firstThread.join();
+    secondThread.join();
+
+    EXPECT_EQ(0U, failCount[0]);
+    EXPECT_EQ(0U, failCount[1]);
+    EXPECT_EQ(2U * passCount * 3U, basevar.getStringPoolStats().internCount);
+}
+
+TEST(cmd_line_parse, parseTestPatternArgs)
+{
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    testvar.disableHelpDisplayOnError();
+
+    argparser::vargpattern nameArg("[a-z][a-z0-9_]*");
+    argparser::listvargpattern tagArg("[a-z]+=[0-9]+");
+    testvar.addKeyArgument(&nameArg, "name", "-n,--name", "This is the test name argument");
+    testvar.addKeyArgument(&tagArg, "tags", "-t,--tags", "This is the test tag list argument", -10);
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--name=job_1";
+    parserchar opt2[] = "--tags=cpu=4,mem=16";
+    parserchar* argv[] = {progname, opt1, opt2};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    EXPECT_EQ("job_1", nameArg.value);
+    ASSERT_EQ(2U, tagArg.value.size());
+    EXPECT_EQ("mem=16", tagArg.value[1]);
+
+    parserchar badOpt[] = "--name=1job";
+    parserchar* badArgv[] = {progname, badOpt};
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(-1, testvar.parse(2, badArgv));
+    parserstr output = testing::internal::GetCapturedStderr();
+    EXPECT_FALSE(output.empty());
+    EXPECT_EQ("job_1", nameArg.value);
+}
+
+TEST(cmd_line_parse, parseTestArgValidators)
+{
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    testvar.disableHelpDisplayOnError();
+    testvar.addKeyValue<std::vector<std::string>>("include", "-I,--include", "This is the test include list argument", {}, -10);
+    testvar.addPositionalValue<std::vector<std::string>>("inputs", "This is the test input file list argument", {}, -100);
+    argparser::varg<int> countArg(0);
+    testvar.addKeyArgument(&countArg, "count", "-c,--count", "This is the test count argument");
+
+    EXPECT_TRUE(testvar.setPathValidator("inputs"));
+    EXPECT_TRUE(testvar.setArgValidator("include", [](std::string_view value) {return (value.find("..") == std::string_view::npos);}));
+    EXPECT_TRUE(testvar.setArgValidator("count", [](std::string_view value) {return (value != "13");}));
+    EXPECT_FALSE(testvar.setArgValidator("missing", [](std::string_view value) {return true;}));
+    testvar.setValidatorThreads(2);
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "/";
+    parserchar opt2[] = "/nonexistent/input.txt";
+    parserchar opt3[] = "-I";
+    parserchar opt4[] = "inc,../up";
+    parserchar opt5[] = "--count=13";
+    parserchar* argv[] = {progname, opt1, opt2, opt3, opt4, opt5};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    // Values are still assigned, failures map back to their argv index
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(-1, testvar.parse(argc, argv));
+    parserstr output = testing::internal::GetCapturedStderr();
+    EXPECT_STREQ("argv[2] \"inputs /nonexistent/input.txt\" validation failed\n"
+                 "argv[4] \"include ../up\" validation failed\n"
+                 "argv[5] \"count 13\" validation failed\n", output.c_str());
+    EXPECT_EQ(2U, testvar.getValue<std::vector<std::string>>("inputs")->size());
+
+    parserchar goodOpt[] = "--count=12";
+    parserchar* goodArgv[] = {progname, opt1, goodOpt};
+    EXPECT_EQ(3, testvar.parse(3, goodArgv));
+    EXPECT_EQ(12, countArg.value);
+}
+
+TEST(cmd_line_parse, parseTestBorrowedLazyArgs)
+{
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    argparser::vargview namevar;
+    argparser::varglazy<int> countvar(1);
+    argparser::vargview outputvar("outname");
+
+    testvar.addKeyArgument(&namevar, "name", "-n,--name", "This is the test name argument");
+    testvar.addKeyArgument(&countvar, "count", "-c,--count", "This is the test count argument");
+    testvar.addPositionalArgument(&outputvar, "outputname", "This is the test output name argument");
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--name=george";
+    parserchar opt2[] = "-c";
+    parserchar opt3[] = "12";
+    parserchar opt4[] = "output.txt";
+    parserchar* argv[] = {progname, opt1, opt2, opt3, opt4};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    // Parse
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    EXPECT_EQ("george", namevar.value);
+    EXPECT_EQ("output.txt", outputvar.value);
+    EXPECT_EQ("12", countvar.getRawValue());
+    EXPECT_TRUE(testvar.validateAll());
+    EXPECT_EQ(12, countvar.getValue());
+}
+
+TEST(cmd_line_parse, parseTestLazyArgValidateAll)
+{
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    argparser::varglazy<unsigned> countvar(1, 0, 10);
+    testvar.addKeyArgument(&countvar, "count", "-c,--count", "This is the test count argument");
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--count=11";
+    parserchar* argv[] = {progname, opt1};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    // The conversion is deferred, so the parse itself succeeds
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+
+    testing::internal::CaptureStderr();
+    EXPECT_FALSE(testvar.validateAll());
+    parserstr output = testing::internal::GetCapturedStderr();
+    EXPECT_STREQ("\"count\" invalid assignment\n", output.c_str());
+    EXPECT_EQ(1U, countvar.getValue());
+}
+
+TEST(cmd_line_parse, parseTestEnumSetArg)
+{
+    enum feature_e {featureA_e, featureB_e, featureC_e};
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    argparser::vargenumset<feature_e> featurevar("feature");
+    featurevar.setEnumValue("a", featureA_e);
+    featurevar.setEnumValue("b", featureB_e);
+    featurevar.setEnumValue("c", featureC_e);
+    testvar.addKeyArgument(&featurevar, "features", "--features", "This is the test feature set argument", -1);
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--features=a,c";
+    parserchar* argv[] = {progname, opt1};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    EXPECT_TRUE(featurevar.isSet(featureA_e));
+    EXPECT_FALSE(featurevar.isSet(featureB_e));
+    EXPECT_TRUE(featurevar.isSet(featureC_e));
+}
+
+TEST(cmd_line_parse, parseTestMapArg)
+{
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    argparser::vargmap<std::string> definevar;
+    testvar.addKeyArgument(&definevar, "define", "-D,--define", "This is the test define argument", -1);
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--define=k1=v1,k2=v2";
+    parserchar opt2[] = "-D";
+    parserchar opt3[] = "k3=v3";
+    parserchar* argv[] = {progname, opt1, opt2, opt3};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    EXPECT_EQ(3U, definevar.getMap().size());
+    EXPECT_EQ("v1", *definevar.find("k1"));
+    EXPECT_EQ("v2", *definevar.find("k2"));
+    EXPECT_EQ("v3", *definevar.find("k3"));
+}
+
+TEST(cmd_line_parse, parseTestFileValueSource)
+{
+    char path[] = "/tmp/cmd_line_parse_testXXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    const char fileContents[] = "1,2\n3\n\n4\n";
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(fileContents) - 1), write(fd, fileContents, sizeof(fileContents) - 1));
+    close(fd);
+
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    argparser::listvarg<int> idvar;
+    argparser::listvarg<int> badvar;
+    testvar.addKeyArgument(&idvar, "ids", "-i,--ids", "This is the test id list argument", -1);
+    testvar.addKeyArgument(&badvar, "bad", "-b,--bad", "This is the test missing file argument", -1);
+
+    parserstr fileArg = parserstr("--ids=@") + path;
+    parserchar progname[] = "runprog";
+    parserchar* argv[] = {progname, fileArg.data()};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    ASSERT_EQ(4U, idvar.value.size());
+    EXPECT_EQ(1, idvar.value[0]);
+    EXPECT_EQ(3, idvar.value[2]);
+    EXPECT_EQ(4, idvar.value[3]);
+
+    parserchar opt1[] = "-b";
+    parserchar opt2[] = "@/nonexistent/ids";
+    parserchar* badArgv[] = {progname, opt1, opt2};
+    testvar.disableHelpDisplayOnError();
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(-1, testvar.parse(3, badArgv));
+    parserstr output = testing::internal::GetCapturedStderr();
+    EXPECT_STREQ("\"-b @/nonexistent/ids\" assignment failed\n", output.c_str());
+    remove(path);
+}
+
+TEST(cmd_line_parse, parseTestFileValueSourceCount)
+{
+    char path[] = "/tmp/cmd_line_parse_testXXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    const char fileContents[] = "=a\nb,c\nd\n";
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(fileContents) - 1), write(fd, fileContents, sizeof(fileContents) - 1));
+    close(fd);
+
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    argparser::listvarg<std::string> namevar;
+    argparser::listvarg<std::string> shortvar;
+    testvar.addKeyArgument(&namevar, "names", "-n,--names", "This is the test name list argument", -1);
+    testvar.addKeyArgument(&shortvar, "short", "-s,--short", "This is the test short list argument", 3);
+    testvar.disableHelpDisplayOnError();
+
+    // A leading assignment delimiter in the file is part of the value
+    parserstr fileArg = parserstr("--names=@") + path;
+    parserchar progname[] = "runprog";
+    parserchar* argv[] = {progname, fileArg.data()};
+    EXPECT_EQ(2, testvar.parse(2, argv));
+    ASSERT_EQ(4U, namevar.value.size());
+    EXPECT_EQ("=a", namevar.value[0]);
+    EXPECT_EQ("d", namevar.value[3]);
+
+    // Too many file values leave the argument unchanged
+    parserstr shortArg = parserstr("--short=@") + path;
+    parserchar* shortArgv[] = {progname, shortArg.data()};
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(-1, testvar.parse(2, shortArgv));
+    parserstr output = testing::internal::GetCapturedStderr();
+    EXPECT_STREQ("\"--short\" too many assignment values. Expected: 3 found: 4 arguments\n", output.c_str());
+    EXPECT_TRUE(shortvar.value.empty());
+    remove(path);
+}
+
+TEST(cmd_line_parse, parseTestFileValueSourceValidators)
+{
+    char path[] = "/tmp/cmd_line_parse_testXXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    const char fileContents[] = "inc,../up\n\nlib\n";
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(fileContents) - 1), write(fd, fileContents, sizeof(fileContents) - 1));
+    close(fd);
+
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    argparser::listvarg<std::string> includevar;
+    testvar.addKeyArgument(&includevar, "include", "-I,--include", "This is the test include list argument", -10);
+    EXPECT_TRUE(testvar.setArgValidator("include", [](std::string_view value) {return (!value.empty() && (value.find("..") == std::string_view::npos));}));
+    testvar.disableHelpDisplayOnError();
+
+    // File values are validated and reported against the argv string naming the file
+    parserstr fileArg = parserstr("--include=@") + path;
+    parserchar progname[] = "runprog";
+    parserchar* argv[] = {progname, fileArg.data()};
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(-1, testvar.parse(2, argv));
+    parserstr output = testing::internal::GetCapturedStderr();
+    EXPECT_STREQ("argv[1] \"include ../up\" validation failed\n", output.c_str());
+    EXPECT_EQ(3U, includevar.value.size());
+
+    // A trailing list delimiter does not queue an empty value
+    parserchar opt1[] = "-I";
+    parserchar opt2[] = "inc,lib,";
+    parserchar* trailArgv[] = {progname, opt1, opt2};
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(3, testvar.parse(3, trailArgv));
+    output = testing::internal::GetCapturedStderr();
+    EXPECT_TRUE(output.empty());
+    remove(path);
+}
+
+TEST(cmd_line_parse, parseTestFileArg)
+{
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    argparser::vargfile inputvar;
+    testvar.addKeyArgument(&inputvar, "input", "--input", "This is the test input file argument");
+    testvar.disableHelpDisplayOnError();
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--input=/nonexistent/input.txt";
+    parserchar* argv[] = {progname, opt1};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(-1, testvar.parse(argc, argv));
+    parserstr output = testing::internal::GetCapturedStderr();
+    EXPECT_STREQ("\"--input /nonexistent/input.txt\" assignment failed\n", output.c_str());
+}
+
+TEST(cmd_line_parse, parseTestUtf8Validation)
+{
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    testvar.addKeyValue<std::string>("name", "--name", "This is the test name argument", "");
+    testvar.addPositionalValue<std::vector<std::string>>("inputs", "This is the test input list argument", {}, -10);
+    testvar.disableHelpDisplayOnError();
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--name=caf\xC3\xA9";
+    parserchar opt2[] = "na\xC3\xAFve";
+    parserchar opt3[] = "bad\xED\xA0\x80";
+    parserchar* argv[] = {progname, opt1, opt2, opt3};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    // Unchecked by default
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+
+    testvar.setUtf8Validation(true);
+    EXPECT_EQ(3, testvar.parse(3, argv));
+    EXPECT_EQ("caf\xC3\xA9", *testvar.getValue<std::string>("name"));
+
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(-1, testvar.parse(argc, argv));
+    parserstr output = testing::internal::GetCapturedStderr();
+    EXPECT_STREQ("\"argv[3]\" invalid UTF-8 at byte 3\n", output.c_str());
+}
+
+TEST(cmd_line_parse, parseTestSessionArena)
+{
+    /**
+     * @brief Upstream resource that counts the blocks it hands out
+     */
+    class countingResource : public std::pmr::memory_resource
+    {
+        public:
+            size_t allocateCount = 0;
+            size_t deallocateCount = 0;
+
+        private:
+            void* do_allocate(size_t bytes, size_t alignment) override
+            {
+                allocateCount++;
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+            void do_deallocate(void* block, size_t bytes, size_t alignment) override
+            {
+                deallocateCount++;
+                std::pmr::new_delete_resource()->deallocate(block, bytes, alignment);
+            }
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {return (this == &other);}
+    };
+
+    countingResource upstream;
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    testvar.setMemoryResource(&upstream);
+    argparser::vargview nameArg;
+    argparser::listvarg<int> listArg;
+    testvar.addKeyArgument(&nameArg, "name", "-n,--name-of-the-test-argument", "This is the test name argument");
+    testvar.addKeyArgument(&listArg, "list", "-l,--list", "This is the test list argument", -10);
+
+    // A short command line fits in the arena buffer
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--name-of-the-test-argument=first";
+    parserchar opt2[] = "-l";
+    parserchar opt3[] = "1,2";
+    parserchar opt4[] = "3";
+    parserchar* argv[] = {progname, opt1, opt2, opt3, opt4};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    EXPECT_EQ("first", nameArg.value);
+    EXPECT_EQ(3U, listArg.value.size());
+    EXPECT_GT(testvar.getParseArenaBytes(), sizeof(opt1) + sizeof(opt3));
+    EXPECT_EQ(0U, upstream.allocateCount);
+
+    // A long command line takes upstream blocks, returned when the next parse starts
+    std::vector<parserstr> longValues(200, parserstr("7"));
+    std::vector<parserchar*> longArgv = {progname, opt1};
+    for (auto& value : longValues)
+    {
+        longArgv.push_back(&value[0]);
+    }
+    testvar.parse(static_cast<int>(longArgv.size()), longArgv.data());
+    EXPECT_GT(upstream.allocateCount, 0U);
+    EXPECT_EQ(0U, upstream.deallocateCount);
+
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    EXPECT_EQ(upstream.allocateCount, upstream.deallocateCount);
+    EXPECT_EQ("first", nameArg.value);
+}
+
+TEST(cmd_line_parse, parseTestPositionalGlob)
+{
+    char rootPath[] = "/tmp/cmd_line_globXXXXXX";
+    ASSERT_NE(nullptr, mkdtemp(rootPath));
+    parserstr root = rootPath;
+    ASSERT_EQ(0, mkdir((root + "/logs").c_str(), 0755));
+    for (const char* name : {"/b.gz", "/a.gz", "/logs/c.gz", "/logs/d.txt"})
+    {
+        int fd = open((root + name).c_str(), O_CREAT | O_WRONLY, 0644);
+        ASSERT_GE(fd, 0);
+        close(fd);
+    }
+
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program");
+    argparser::listvarg<std::string> inputs;
+    testvar.addPositionalArgument(&inputs, "inputs", "This is the test input file list argument", -100, false, argparser::GLOB_SORTED_e);
+    testvar.setGlobThreads(2);
+
+    parserchar progname[] = "runprog";
+    parserstr  pattern = root + "/**/*.gz";
+    parserstr  literal = root + "/logs/d.txt";
+    parserstr  noMatch = root + "/*.zip";
+    parserchar* argv[] = {progname, &pattern[0], &literal[0], &noMatch[0]};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    // Matches in level order, plain values and patterns without a match are kept as given
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    ASSERT_EQ(5U, inputs.value.size());
+    EXPECT_EQ(root + "/a.gz", inputs.value[0]);
+    EXPECT_EQ(root + "/b.gz", inputs.value[1]);
+    EXPECT_EQ(root + "/logs/c.gz", inputs.value[2]);
+    EXPECT_EQ(literal, inputs.value[3]);
+    EXPECT_EQ(noMatch, inputs.value[4]);
+
+    // Glob mode is opt in
+    argparser::cmd_line_parse plainvar("testprog [options]", "Description of the test program");
+    plainvar.addPositionalValue<std::vector<std::string>>("inputs", "This is the test input file list argument", {}, -100);
+    EXPECT_EQ(2, plainvar.parse(2, argv));
+    ASSERT_EQ(1U, plainvar.getValue<std::vector<std::string>>("inputs")->size());
+    EXPECT_EQ(pattern, plainvar.getValue<std::vector<std::string>>("inputs")->front());
+
+    // Too many matches leave the argument unchanged
+    argparser::cmd_line_parse shortvar("testprog [options]", "Description of the test program");
+    argparser::listvarg<std::string> shortInputs;
+    shortvar.addPositionalArgument(&shortInputs, "inputs", "This is the test input file list argument", 2, false, argparser::GLOB_SORTED_e);
+    shortvar.disableHelpDisplayOnError();
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(-1, shortvar.parse(2, argv));
+    parserstr output = testing::internal::GetCapturedStderr();
+    EXPECT_FALSE(output.empty());
+    EXPECT_TRUE(shortInputs.value.empty());
+
+    EXPECT_EQ(0, system(("rm -rf " + root).c_str()));
+}
+
+TEST(cmd_line_parse, parseTestSchemaPool)
+{
+    auto original = std::make_unique<argparser::cmd_line_parse>("testprog [options]", "Description of the test program", false, true);
+
+    // Literal registration strings are used in place, the option help string is built
+    original->addKeyValue<int>("count", "-c,--count", "This is the test count argument", 0);
+    argparser::schemaPoolStats stats = original->getSchemaPoolStats();
+    EXPECT_EQ(3U, stats.referencedCount);
+    EXPECT_EQ(1U, stats.copied.uniqueCount);
+
+    // Built strings are copied once and outlive the caller strings and the original parser
+    parserstr name = "size";
+    parserstr keys = "-s,--size";
+    parserstr help = "This is the test size argument";
+    original->addKeyValue<int>(name, keys, help, 0);
+    name = "changed";
+    keys = "-x";
+    help.clear();
+    EXPECT_EQ(4U, original->getSchemaPoolStats().copied.uniqueCount - stats.copied.uniqueCount);
+
+    argparser::cmd_line_parse copyvar(*original);
+    original.reset();
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--size=7";
+    parserchar opt2[] = "-c";
+    parserchar opt3[] = "3";
+    parserchar* argv[] = {progname, opt1, opt2, opt3};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    EXPECT_EQ(argc, copyvar.parse(argc, argv));
+    ASSERT_NE(nullptr, copyvar.getValue<int>("size"));
+    EXPECT_EQ(7, *copyvar.getValue<int>("size"));
+    EXPECT_EQ(3, *copyvar.getValue<int>("count"));
+}
+
+TEST(cmd_line_parse, memoryUsage)
+{
+    argparser::cmd_line_parse testvar("testprog [options]", "Description of the test program", false, true);
+    argparser::listvarg<int> listArg;
+    testvar.addKeyArgument(&listArg, "list", "-l,--list", "This is the test list argument", -100);
+    testvar.addKeyValue<int>("count", "-c,--count", "This is the test count argument", 0);
+    testvar.addPositionalValue<std::string>("file", "This is the test file argument", "");
+
+    argparser::memoryUsageReport before = testvar.memoryUsage();
+    EXPECT_GE(before.schema.allocations, 3U);
+    EXPECT_EQ(2U, before.keyLists.allocations);
+    EXPECT_EQ(1U, before.stringList.allocations);
+    EXPECT_EQ(0U, before.valueStrings.allocations);
+
+    // The list values are reported in the values category
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "/tmp/input.txt";
+    parserchar opt2[] = "--list=1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16";
+    parserchar* argv[] = {progname, opt1, opt2};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+
+    argparser::memoryUsageReport after = testvar.memoryUsage();
+    EXPECT_GE(after.values.bytes, before.values.bytes + (16 * sizeof(int)));
+    EXPECT_EQ(after.getTotal().allocations - before.getTotal().allocations, after.values.allocations - before.values.allocations);
+
+    // The report and the per argument lines
+    testing::internal::CaptureStdout();
+    testvar.displayMemoryUsage(std::cout, true);
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("values"));
+    EXPECT_NE(std::string::npos, output.find("total"));
+    EXPECT_NE(std::string::npos, output.find("  list"));
+    EXPECT_NE(std::string::npos, output.find("  file"));
+}
+
 /** @} */
@@ -0,0 +1,380 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file parse_allocation_test.cpp
+ * @ingroup libcmd_line_parser_unittest
+ * @defgroup Parser entry point heap allocation test
+ * @{
+ */
+
+// Includes
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <optional>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include "varg.h"
+#include "vargincrement.h"
+#include "vargenum.h"
+#include "listvarg.h"
+#include "cmd_line_parse.h"
+#include "static_cmd_line_parse.h"
+#include "envparse.h"
+#include <gtest/gtest.h>
+
+using namespace argparser;
+
+//======================================================================================
+// Heap allocation tracking
+//======================================================================================
+static std::atomic<size_t> heapBytes(0);   ///< Total number of bytes requested from operator new
+static std::atomic<size_t> heapBlocks(0);  ///< Total number of operator new calls
+
+void* operator new(size_t size)
+{
+    heapBytes += size;
+    heapBlocks++;
+    void* block = malloc((size != 0) ? size : 1);
+    if (block == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return block;
+}
+
+void operator delete(void* block) noexcept                          {free(block);}
+void operator delete(void* block, size_t /* size */) noexcept       {free(block);}
+
+/**
+ * @brief Heap allocation count of a single call
+ */
+struct allocationCount
+{
+    size_t blocks;                  ///< Number of operator new calls
+    size_t bytes;                   ///< Number of bytes requested
+};
+
+/**
+ * @brief Count the heap allocations made by a callable
+ *
+ * @param call - Callable to measure
+ *
+ * @return allocationCount - Allocations made during the call
+ */
+template <typename Call> allocationCount countAllocations(Call call)
+{
+    size_t startBlocks = heapBlocks;
+    size_t startBytes = heapBytes;
+    call();
+    return {heapBlocks - startBlocks, heapBytes - startBytes};
+}
+
+/**
+ * @brief Output stream buffer that discards the text, so the help output
+ *        does not add stream buffer allocations to the measured call
+ */
+class nullBuffer : public std::streambuf
+{
+    protected:
+        int_type overflow(int_type ch) override                    {return traits_type::not_eof(ch);}
+        std::streamsize xsputn(const char*, std::streamsize count) override {return count;}
+};
+
+//======================================================================================
+// Sample schemas
+//======================================================================================
+static char progName[]   = "sample";
+static char flagKey[]    = "-f";
+static char countKey[]   = "-c";
+static char countKey2[]  = "--count";
+static char inputKey[]   = "-i";
+static char inputValue[] = "42";
+static char outputKey[]  = "--output";
+static char outputValue[]= "result.txt";
+static char positional[] = "input.txt";
+static char subCommand[] = "write";
+static char lineKey[]    = "-l";
+static char lineValue[]  = "25";
+static char listKey[]    = "--list";
+static char listValue1[] = "1";
+static char listValue2[] = "2";
+static char listValue3[] = "3";
+
+/**
+ * @brief sample1 argument set, flag, counter, integer, string and positional string
+ */
+struct sample1Schema
+{
+    varg<std::string>   positionalArg;
+    varg<std::string>   argString;
+    varg<int>           intArg;
+    varg<bool>          flagArg;
+    vargincrement       counter;
+    cmd_line_parse      parser;
+
+    sample1Schema() : positionalArg(""), argString("default"), intArg(2), flagArg(false, true), counter(),
+                      parser("sample1 [switched options ] [positional arg]", "Description of the utility to be included in the help display")
+    {
+        parser.addFlagArgument(&flagArg, "version", "-f,--flag", "Example of a simple true/false flag argument");
+        parser.addFlagArgument(&counter, "counter", "-c,--count", "Example of a incrementing counter argument");
+        parser.addKeyArgument(&intArg, "integerValue", "-i,--input", "Example of a basic integer value argument");
+        parser.addKeyArgument(&argString, "argString", "-o, --output", "Example of a switched string argument", 1);
+        parser.addPositionalArgument(&positionalArg, "positionalString", "Example of a string argument as positional", 1);
+    }
+};
+
+enum subcommand_e
+{
+    subcmd_invalid,
+    subcmd_read,
+    subcmd_write,
+    subcmd_append
+};
+
+/**
+ * @brief sample5 argument set, positional enum sub command with unsigned and string keys
+ */
+struct sample5Schema
+{
+    vargenum<subcommand_e>  subcommand;
+    varg<unsigned>          linecount;
+    varg<std::string>       filename;
+    cmd_line_parse          parser;
+
+    sample5Schema() : subcommand(subcommand_e::subcmd_invalid, "subcmd"), linecount(0), filename("default.txt"),
+                      parser("sample5 [subcommand] [subcommand options]", "Description of the utility to be included in the help display")
+    {
+        subcommand.setEnumValue("read", subcommand_e::subcmd_read);
+        subcommand.setEnumValue("write", subcommand_e::subcmd_write);
+        subcommand.setEnumValue("append", subcommand_e::subcmd_append);
+        parser.addPositionalArgument(&subcommand, "subcommand", "Example of a positional enum argument as subcommand", 1, true);
+        parser.addKeyArgument(&linecount, "linecount", "-l,--lines", "Example of an integer argument");
+        parser.addKeyArgument(&filename, "filename", "-f,--file", "Example of a string argument");
+    }
+};
+
+/**
+ * @brief Built in value storage argument set, flag, counter-free integer, string and list values
+ */
+struct valueStoreSchema
+{
+    cmd_line_parse      parser;
+
+    valueStoreSchema() : parser("sample [options] [positional arg]", "Description of the utility to be included in the help display")
+    {
+        parser.addFlagValue("flag", "-f,--flag", "Example of a simple true/false flag argument", false);
+        parser.addKeyValue<int>("integerValue", "-i,--input", "Example of a basic integer value argument", 2);
+        parser.addKeyValue<std::string>("argString", "-o, --output", "Example of a switched string argument", "default");
+        parser.addKeyValue<std::vector<int>>("intList", "--list", "Example of a list argument", {}, 3);
+        parser.addPositionalValue<std::string>("positionalString", "Example of a string argument as positional", "");
+    }
+};
+
+//======================================================================================
+// Per call allocation budgets
+//======================================================================================
+constexpr size_t sample5FirstParseBudget = 2;   ///< First parse of the enum positional, the first setValue() builds the enum name table
+constexpr size_t listValueBudget = 1;           ///< Parse with a three element list value, the list storage itself
+constexpr size_t cachedParseBudget = 2;         ///< Cached parse, the saved values are copied back into the argument values
+constexpr size_t sample1HelpBudget = 70;        ///< sample1 help text, line formatting strings
+constexpr size_t envHelpBudget = 39;            ///< Three variable environment help text, line formatting strings
+
+TEST(parseAllocation, sample1Parse)
+{
+    char* argv[] = {progName, flagKey, countKey, countKey2, inputKey, inputValue, outputKey, outputValue, positional, nullptr};
+    const int argc = static_cast<int>(sizeof(argv)/sizeof(argv[0])) - 1;
+    sample1Schema schema;
+
+    int lastArg = 0;
+    allocationCount first = countAllocations([&]() {lastArg = schema.parser.parse(argc, argv);});
+    EXPECT_EQ(argc, lastArg);
+    EXPECT_EQ(42, schema.intArg.value);
+    EXPECT_EQ("result.txt", schema.argString.value);
+    EXPECT_EQ("input.txt", schema.positionalArg.value);
+    EXPECT_EQ(2, schema.counter.value);
+    EXPECT_EQ(0U, first.blocks);
+
+    allocationCount repeat = countAllocations([&]() {lastArg = schema.parser.parse(argc, argv);});
+    EXPECT_EQ(argc, lastArg);
+    EXPECT_EQ(0U, repeat.blocks);
+}
+
+TEST(parseAllocation, sample5Parse)
+{
+    char* argv[] = {progName, subCommand, lineKey, lineValue, nullptr};
+    const int argc = static_cast<int>(sizeof(argv)/sizeof(argv[0])) - 1;
+    sample5Schema schema;
+
+    int lastArg = 0;
+    allocationCount first = countAllocations([&]() {lastArg = schema.parser.parse(argc, argv);});
+    EXPECT_EQ(argc, lastArg);
+    EXPECT_EQ(subcommand_e::subcmd_write, schema.subcommand.value);
+    EXPECT_EQ(25U, schema.linecount.value);
+    EXPECT_LE(first.blocks, sample5FirstParseBudget);
+
+    allocationCount repeat = countAllocations([&]() {lastArg = schema.parser.parse(argc, argv);});
+    EXPECT_EQ(argc, lastArg);
+    EXPECT_EQ(0U, repeat.blocks);
+}
+
+TEST(parseAllocation, valueStoreParse)
+{
+    char* argv[] = {progName, flagKey, inputKey, inputValue, listKey, listValue1, listValue2, listValue3, positional, nullptr};
+    const int argc = static_cast<int>(sizeof(argv)/sizeof(argv[0])) - 1;
+    valueStoreSchema schema;
+
+    int lastArg = 0;
+    allocationCount first = countAllocations([&]() {lastArg = schema.parser.parse(argc, argv);});
+    EXPECT_EQ(argc, lastArg);
+    ASSERT_NE(nullptr, schema.parser.getValue<std::vector<int>>("intList"));
+    EXPECT_EQ(3U, schema.parser.getValue<std::vector<int>>("intList")->size());
+    EXPECT_LE(first.blocks, listValueBudget);
+
+    allocationCount repeat = countAllocations([&]() {lastArg = schema.parser.parse(argc, argv);});
+    EXPECT_EQ(argc, lastArg);
+    EXPECT_LE(repeat.blocks, listValueBudget);
+
+    schema.parser.enableParseCache(4);
+    schema.parser.parse(argc, argv);
+    allocationCount cached = countAllocations([&]() {lastArg = schema.parser.parse(argc, argv);});
+    EXPECT_EQ(argc, lastArg);
+    EXPECT_LE(cached.blocks, cachedParseBudget);
+}
+
+TEST(parseAllocation, displayHelp)
+{
+    nullBuffer discard;
+    std::ostream nullStream(&discard);
+    sample1Schema schema;
+
+    allocationCount help = countAllocations([&]() {schema.parser.displayHelp(nullStream);});
+    EXPECT_GT(help.blocks, 0U);
+    EXPECT_LE(help.blocks, sample1HelpBudget);
+}
+
+TEST(parseAllocation, envParse)
+{
+    varg<int>          intArg(0);
+    varg<bool>         flagArg(false);
+    listvarg<int>      listArg;
+    envparser          parser;
+    parser.addArgument(&intArg, "ALLOC_TEST_INT", "Example of an integer environment value");
+    parser.addArgument(&flagArg, "ALLOC_TEST_FLAG", "Example of a boolean environment value");
+    parser.addArgument(&listArg, "ALLOC_TEST_LIST", "Example of a list environment value", 3);
+    setenv("ALLOC_TEST_INT", "10", 1);
+    setenv("ALLOC_TEST_FLAG", "true", 1);
+    setenv("ALLOC_TEST_LIST", "1,2,3", 1);
+
+    bool status = false;
+    allocationCount first = countAllocations([&]() {status = parser.parse();});
+    EXPECT_TRUE(status);
+    EXPECT_EQ(10, intArg.value);
+    EXPECT_EQ(3U, listArg.value.size());
+    EXPECT_LE(first.blocks, listValueBudget);
+
+    allocationCount repeat = countAllocations([&]() {status = parser.parse();});
+    EXPECT_TRUE(status);
+    EXPECT_LE(repeat.blocks, listValueBudget);
+
+    nullBuffer discard;
+    std::ostream nullStream(&discard);
+    allocationCount help = countAllocations([&]() {parser.displayHelp(nullStream);});
+    EXPECT_LE(help.blocks, envHelpBudget);
+
+    unsetenv("ALLOC_TEST_INT");
+    unsetenv("ALLOC_TEST_FLAG");
+    unsetenv("ALLOC_TEST_LIST");
+}
+
+TEST(parseAllocation, parserMove)
+{
+    valueStoreSchema schema;
+
+    // A move transfers the argument lists, strings and pools without allocating
+    std::optional<cmd_line_parse> movedParser;
+    allocationCount move = countAllocations([&]() {movedParser.emplace(std::move(schema.parser));});
+    EXPECT_EQ(0U, move.blocks);
+
+    cmd_line_parse assigned;
+    allocationCount assign = countAllocations([&]() {assigned = std::move(*movedParser);});
+    EXPECT_EQ(0U, assign.blocks);
+
+    char* argv[] = {progName, inputKey, inputValue, positional, nullptr};
+    const int argc = static_cast<int>(sizeof(argv)/sizeof(argv[0])) - 1;
+    EXPECT_EQ(argc, assigned.parse(argc, argv));
+    EXPECT_EQ(42, *assigned.getValue<int>("integerValue"));
+}
+
+TEST(parseAllocation, boundFieldParse)
+{
+    struct sampleConfig
+    {
+        int         input = 2;
+        bool        flag = false;
+        std::string output = "default";
+    } config;
+
+    cmd_line_parse parser("sample [options]", "Bound field parse", false, true);
+    parser.bindTo(config)
+          .bind(&sampleConfig::input, "-i,--input", "Example of a bound integer field")
+          .bind(&sampleConfig::flag, "-f,--flag", "Example of a bound flag field")
+          .bind(&sampleConfig::output, "-o,--output", "Example of a bound string field");
+
+    // Scalar fields are set in place, the short string value fits the string's own buffer
+    static char shortValue[] = "out.txt";
+    char* argv[] = {progName, flagKey, inputKey, inputValue, outputKey, shortValue, nullptr};
+    const int argc = static_cast<int>(sizeof(argv)/sizeof(argv[0])) - 1;
+
+    int lastArg = 0;
+    allocationCount first = countAllocations([&]() {lastArg = parser.parse(argc, argv);});
+    EXPECT_EQ(argc, lastArg);
+    EXPECT_EQ(42, config.input);
+    EXPECT_TRUE(config.flag);
+    EXPECT_EQ("out.txt", config.output);
+    EXPECT_EQ(0U, first.blocks);
+}
+
+TEST(parseAllocation, staticParse)
+{
+    varg<int>           intArg(0);
+    varg<bool>          flagArg(false, true);
+    varg<std::string>   positionalArg("");
+    char* argv[] = {progName, flagKey, inputKey, inputValue, positional, nullptr};
+    const int argc = static_cast<int>(sizeof(argv)/sizeof(argv[0])) - 1;
+
+    static_cmd_line_parse<4> parser;
+    parser.addFlagArgument(&flagArg, "flag", "-f,--flag", "Example of a simple true/false flag argument");
+    parser.addKeyArgument(&intArg, "integerValue", "-i,--input", "Example of a basic integer value argument");
+    parser.addPositionalArgument(&positionalArg, "positionalString", "Example of a string argument as positional");
+
+    int lastArg = 0;
+    allocationCount count = countAllocations([&]() {lastArg = parser.parse(argc, argv);});
+    EXPECT_EQ(argc, lastArg);
+    EXPECT_EQ(0U, count.blocks);
+    EXPECT_EQ(42, intArg.value);
+    EXPECT_TRUE(flagArg.value);
+}
+
+/** @} */
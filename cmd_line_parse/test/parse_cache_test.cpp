@@ -0,0 +1,163 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file parse_cache_test.cpp
+ * @ingroup libcmd_line_parser_unittest
+ * @{
+ */
+
+// Includes
+#include "parse_cache.h"
+#include <gtest/gtest.h>
+
+using namespace argparser;
+
+/**
+ * @brief Build a cache entry for the input argv
+ */
+static parse_cache::cacheEntry makeEntry(const parse_cache& testCache, int argc, char* argv[], int returnValue)
+{
+    parse_cache::cacheEntry newEntry = {"", returnValue, 1, false, {}};
+    testCache.buildKey(argc, argv, 1, -1, newEntry.key);
+    newEntry.args.push_back({argValueStore::create<int>(returnValue), true});
+    return newEntry;
+}
+
+TEST(parse_cache, buildKeyTokenBoundaries)
+{
+    parse_cache testCache(4);
+
+    char progname[] = "prog";
+    char splitA[] = "ab";
+    char splitB[] = "c";
+    char joinA[] = "a";
+    char joinB[] = "bc";
+    char* argvSplit[] = {progname, splitA, splitB};
+    char* argvJoin[] = {progname, joinA, joinB};
+
+    std::string splitKey;
+    std::string joinKey;
+    testCache.buildKey(3, argvSplit, 1, -1, splitKey);
+    testCache.buildKey(3, argvJoin, 1, -1, joinKey);
+    EXPECT_NE(splitKey, joinKey);
+
+    std::string rangeKey;
+    testCache.buildKey(3, argvSplit, 2, -1, rangeKey);
+    EXPECT_NE(splitKey, rangeKey);
+
+    parse_cache versionCache(4, 7);
+    std::string versionKey;
+    versionCache.buildKey(3, argvSplit, 1, -1, versionKey);
+    EXPECT_NE(splitKey, versionKey);
+}
+
+TEST(parse_cache, findInsertCounters)
+{
+    parse_cache testCache(4);
+
+    char progname[] = "prog";
+    char opt1[] = "-c";
+    char* argv[] = {progname, opt1};
+
+    parse_cache::cacheEntry newEntry = makeEntry(testCache, 2, argv, 2);
+    std::string key = newEntry.key;
+    EXPECT_EQ(nullptr, testCache.find(key));
+    testCache.insert(std::move(newEntry));
+    EXPECT_EQ(1U, testCache.size());
+
+    const parse_cache::cacheEntry* cached = testCache.find(key);
+    ASSERT_NE(nullptr, cached);
+    EXPECT_EQ(2, cached->returnValue);
+    ASSERT_EQ(1U, cached->args.size());
+    EXPECT_EQ(2, *cached->args[0].value.getValue<int>());
+
+    EXPECT_EQ(1U, testCache.getStats().hits);
+    EXPECT_EQ(1U, testCache.getStats().misses);
+    EXPECT_EQ(0U, testCache.getStats().evictions);
+}
+
+TEST(parse_cache, leastRecentlyUsedEviction)
+{
+    parse_cache testCache(2);
+
+    char progname[] = "prog";
+    char optA[] = "a";
+    char optB[] = "b";
+    char optC[] = "c";
+    char* argvA[] = {progname, optA};
+    char* argvB[] = {progname, optB};
+    char* argvC[] = {progname, optC};
+
+    parse_cache::cacheEntry entryA = makeEntry(testCache, 2, argvA, 1);
+    parse_cache::cacheEntry entryB = makeEntry(testCache, 2, argvB, 2);
+    parse_cache::cacheEntry entryC = makeEntry(testCache, 2, argvC, 3);
+    std::string keyA = entryA.key;
+    std::string keyB = entryB.key;
+    std::string keyC = entryC.key;
+
+    testCache.insert(std::move(entryA));
+    testCache.insert(std::move(entryB));
+
+    // Touch A so B is the least recently used entry
+    EXPECT_NE(nullptr, testCache.find(keyA));
+    testCache.insert(std::move(entryC));
+
+    EXPECT_EQ(2U, testCache.size());
+    EXPECT_EQ(1U, testCache.getStats().evictions);
+    EXPECT_NE(nullptr, testCache.find(keyA));
+    EXPECT_EQ(nullptr, testCache.find(keyB));
+    EXPECT_NE(nullptr, testCache.find(keyC));
+}
+
+TEST(parse_cache, schemaVersionChange)
+{
+    parse_cache testCache(4, 1);
+
+    char progname[] = "prog";
+    char* argv[] = {progname};
+    parse_cache::cacheEntry newEntry = makeEntry(testCache, 1, argv, 1);
+    testCache.insert(std::move(newEntry));
+
+    testCache.setSchemaVersion(1);
+    EXPECT_EQ(1U, testCache.size());
+    testCache.setSchemaVersion(2);
+    EXPECT_EQ(0U, testCache.size());
+
+    testCache.insert(makeEntry(testCache, 1, argv, 1));
+    testCache.setDefaults({{argValueStore::create<int>(0), false}});
+    EXPECT_EQ(0U, testCache.size());
+    EXPECT_EQ(1U, testCache.getDefaults().size());
+}
+
+TEST(parse_cache, zeroEntryLimit)
+{
+    parse_cache testCache(0);
+
+    char progname[] = "prog";
+    char* argv[] = {progname};
+    testCache.insert(makeEntry(testCache, 1, argv, 1));
+    EXPECT_EQ(0U, testCache.size());
+}
+
+/** @} */
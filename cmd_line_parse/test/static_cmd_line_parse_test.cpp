@@ -0,0 +1,211 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file static_cmd_line_parse_test.cpp
+ * @ingroup libcmd_line_parser_unittest
+ * @{
+ */
+
+// Includes
+#include <sstream>
+#include <string>
+#include "varg.h"
+#include "listvarg.h"
+#include "vargview.h"
+#include "static_cmd_line_parse.h"
+#include <gtest/gtest.h>
+
+using namespace argparser;
+
+//======================================================================================
+// Public Interface testing
+//======================================================================================
+
+TEST(static_cmd_line_parse, parseKeyAndPositional)
+{
+    static_cmd_line_parse<6> testvar("testprog [options] file", "Description of the test program");
+    varg<int>          countArg(0);
+    inlinelistvarg<int> listArg;
+    varg<bool>         verboseArg(false, true);
+    varg<bool>         quietArg(false, true);
+    vargview           fileArg;
+    EXPECT_EQ(eAddArgSuccess, testvar.addKeyArgument(&countArg, "count", "-c,--count", "This is the test count argument"));
+    EXPECT_EQ(eAddArgSuccess, testvar.addKeyArgument(&listArg, "list", "-l, --list", "This is the test list argument", -10));
+    EXPECT_EQ(eAddArgSuccess, testvar.addFlagArgument(&verboseArg, "verbose", "-v", "This is the test verbose flag"));
+    EXPECT_EQ(eAddArgSuccess, testvar.addFlagArgument(&quietArg, "quiet", "-q", "This is the test quiet flag"));
+    EXPECT_EQ(eAddArgSuccess, testvar.addPositionalArgument(&fileArg, "file", "This is the test file argument", 1, true));
+    EXPECT_EQ(6U, testvar.getArgCount());
+    EXPECT_EQ(9U, testvar.getKeyCount());
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--count=5";
+    parserchar opt2[] = "--list";
+    parserchar opt3[] = "1,2";
+    parserchar opt4[] = "3";
+    parserchar opt5[] = "-vq";
+    parserchar opt6[] = "input.txt";
+    parserchar* argv[] = {progname, opt1, opt2, opt3, opt4, opt5, opt6};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    EXPECT_EQ(argc, testvar.parse(argc, argv));
+    EXPECT_EQ(0U, testvar.getErrorCount());
+    EXPECT_EQ(5, countArg.value);
+    ASSERT_EQ(3U, listArg.value.size());
+    EXPECT_EQ(1, listArg.value[0]);
+    EXPECT_EQ(3, listArg.value[2]);
+    EXPECT_TRUE(verboseArg.value);
+    EXPECT_TRUE(quietArg.value);
+    EXPECT_EQ("input.txt", fileArg.value);
+    EXPECT_EQ(opt6, fileArg.value.data());
+    EXPECT_FALSE(testvar.isHelpFlagSet());
+
+    // Positional value after the key value list ends at the next key
+    parserchar opt7[] = "-c";
+    parserchar opt8[] = "7";
+    parserchar* argv2[] = {progname, opt7, opt8, opt6};
+    EXPECT_EQ(4, testvar.parse(4, argv2));
+    EXPECT_EQ(7, countArg.value);
+}
+
+TEST(static_cmd_line_parse, parseErrors)
+{
+    static_cmd_line_parse<4, 8, 3> testvar("testprog [options]", "", false, true);
+    varg<int>          countArg(0, -10, 10);
+    listvarg<int>      pairArg;
+    varg<bool>         flagArg(false, true);
+    EXPECT_EQ(eAddArgSuccess, testvar.addKeyArgument(&countArg, "count", "-c,--count", "This is the test count argument", 1, true));
+    EXPECT_EQ(eAddArgSuccess, testvar.addKeyArgument(&pairArg, "pair", "-p", "This is the test pair argument", 2));
+    EXPECT_EQ(eAddArgSuccess, testvar.addFlagArgument(&flagArg, "flag", "-f", "This is the test flag"));
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "-p";
+    parserchar opt2[] = "1";
+    parserchar opt3[] = "--count=99";
+    parserchar opt4[] = "-f=yes";
+    parserchar opt5[] = "--other";
+    parserchar opt6[] = "--unknown";
+    parserchar* argv[] = {progname, opt1, opt2, opt3, opt4, opt5, opt6};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+
+    // Errors beyond the record capacity are only counted
+    EXPECT_EQ(-1, testvar.parse(argc, argv));
+    ASSERT_EQ(3U, testvar.getErrorCount());
+    EXPECT_EQ(2U, testvar.getDroppedErrorCount());
+
+    const staticParseError& tooFew = testvar.getError(0);
+    EXPECT_EQ(STATIC_ERROR_TOO_FEW_e, tooFew.error);
+    EXPECT_EQ(1, tooFew.argvIndex);
+    EXPECT_EQ("-p", tooFew.text);
+    EXPECT_EQ(1U, tooFew.found);
+
+    const staticParseError& failed = testvar.getError(1);
+    EXPECT_EQ(STATIC_ERROR_ASSIGN_FAILED_e, failed.error);
+    EXPECT_EQ(3, failed.argvIndex);
+    EXPECT_EQ("--count", failed.text);
+    EXPECT_EQ("99", failed.value);
+
+    EXPECT_EQ(STATIC_ERROR_FLAG_VALUE_e, testvar.getError(2).error);
+
+    std::ostringstream errorText;
+    testvar.displayErrors(errorText);
+    EXPECT_NE(std::string::npos, errorText.str().find("--count"));
+    EXPECT_NE(std::string::npos, errorText.str().find("99"));
+
+    // Missing required argument and a failed list element
+    parserchar opt7[] = "-p=1,x";
+    parserchar* argv2[] = {progname, opt7};
+    EXPECT_EQ(-1, testvar.parse(2, argv2));
+    ASSERT_EQ(1U, testvar.getErrorCount());
+    EXPECT_EQ(STATIC_ERROR_ASSIGN_FAILED_e, testvar.getError(0).error);
+    EXPECT_EQ("x", testvar.getError(0).value);
+
+    parserchar* argv3[] = {progname};
+    EXPECT_EQ(-1, testvar.parse(1, argv3));
+    ASSERT_EQ(1U, testvar.getErrorCount());
+    EXPECT_EQ(STATIC_ERROR_MISSING_e, testvar.getError(0).error);
+    EXPECT_EQ("count", testvar.getError(0).text);
+    EXPECT_EQ(0U, testvar.getDroppedErrorCount());
+}
+
+TEST(static_cmd_line_parse, registrationCapacity)
+{
+    static_cmd_line_parse<2, 3> testvar("testprog [options]", "", false, true);
+    varg<int>     firstArg(0);
+    varg<int>     secondArg(0);
+    varg<int>     thirdArg(0);
+    EXPECT_EQ(eAddArgSuccess, testvar.addKeyArgument(&firstArg, "first", "-f,--first", "This is the first argument"));
+
+    // Key table overflow leaves both tables unchanged
+    EXPECT_EQ(eAddArgTableFull, testvar.addKeyArgument(&secondArg, "second", "-s,--second", "This is the second argument"));
+    EXPECT_EQ(1U, testvar.getArgCount());
+    EXPECT_EQ(2U, testvar.getKeyCount());
+    EXPECT_EQ(1U, testvar.getRegistrationErrorCount());
+    EXPECT_EQ(STATIC_ERROR_TABLE_FULL_e, testvar.getRegistrationError().error);
+    EXPECT_EQ("second", testvar.getRegistrationError().text);
+    EXPECT_EQ(3, testvar.getRegistrationError().expected);
+
+    EXPECT_EQ(eAddArgNotList, testvar.addPositionalArgument(&secondArg, "second", "This is the second argument", 2));
+    EXPECT_EQ(eAddArgSuccess, testvar.addPositionalArgument(&secondArg, "second", "This is the second argument"));
+    EXPECT_EQ(eAddArgTableFull, testvar.addPositionalArgument(&thirdArg, "third", "This is the third argument"));
+    EXPECT_EQ(3U, testvar.getRegistrationErrorCount());
+    EXPECT_EQ("second", testvar.getRegistrationError().text);
+
+    // Every parse fails once an add failed
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "-f=1";
+    parserchar* argv[] = {progname, opt1};
+    EXPECT_EQ(-1, testvar.parse(2, argv));
+    EXPECT_EQ(0, firstArg.value);
+
+    std::ostringstream errorText;
+    testvar.displayErrors(errorText);
+    EXPECT_NE(std::string::npos, errorText.str().find("second"));
+}
+
+TEST(static_cmd_line_parse, helpFlag)
+{
+    static_cmd_line_parse<3> testvar("testprog [options] file", "Description of the test program");
+    varg<int>   countArg(0);
+    vargview    fileArg;
+    testvar.addKeyArgument(&countArg, "count", "-c,--count", "This is the test count argument");
+    testvar.addPositionalArgument(&fileArg, "file", "This is the test file argument");
+
+    parserchar progname[] = "runprog";
+    parserchar opt1[] = "--help";
+    parserchar* argv[] = {progname, opt1};
+    EXPECT_EQ(2, testvar.parse(2, argv));
+    EXPECT_TRUE(testvar.isHelpFlagSet());
+
+    std::ostringstream helpText;
+    testvar.displayHelp(helpText);
+    EXPECT_NE(std::string::npos, helpText.str().find("testprog [options] file"));
+    EXPECT_NE(std::string::npos, helpText.str().find(" -h,--help,-?"));
+    EXPECT_NE(std::string::npos, helpText.str().find(" -c,--count=count This is the test count argument"));
+    EXPECT_NE(std::string::npos, helpText.str().find(" file"));
+
+    parserchar* argv2[] = {progname};
+    EXPECT_EQ(1, testvar.parse(1, argv2));
+    EXPECT_FALSE(testvar.isHelpFlagSet());
+}
+
+/** @} */
@@ -31,6 +31,7 @@
 #include <stdio.h>
 #include <string>
 #include <list>
+#include <memory>
 #include <iostream>
 #include "varg_intf.h"
 #include "parser_base.h"
@@ -56,6 +57,14 @@ class envparser : public parser_base
          */
         envparser(bool abortOnError = false, int debugLevel = 0);
 
+        /**
+         * @brief Copy and move, a move transfers the argument list and pools without copying them
+         */
+        envparser(const envparser& other) = default;
+        envparser(envparser&& other) = default;
+        envparser& operator=(const envparser& other) = default;
+        envparser& operator=(envparser&& other) = default;
+
         /**
          * @brief Destructor
          */
@@ -78,6 +87,24 @@ class envparser : public parser_base
          */
         void addArgument(varg_intf* arg, const char* argKey, const char* helpText, int nargs = 1, bool required = false);
 
+        /**
+         * @brief Add a new key based environment argument owned by the parser
+         *
+         * @param arg      - Argument object to take ownership of
+         * @param argKey   - Pointer to a character buffer containing the ket string to match when parsing the environment data
+         * @param helpText - Help text to be printed in the help message
+         * @param nargs    - Number of argument values that follow, see addArgument()
+         * @param required - True if argument is required, false if arguemnt is optional
+         *
+         * @return T* - Pointer to the owned argument object, valid while a parser using it exists
+         */
+        template <typename T> T* addArgument(std::unique_ptr<T> arg, const char* argKey, const char* helpText, int nargs = 1, bool required = false)
+        {
+            T* ownedArg = arg.get();
+            addArgument(adoptArgument(std::move(arg)), argKey, helpText, nargs, required);
+            return ownedArg;
+        }
+
         /**
          * @brief Parse the environment for matching entries 
          * 
@@ -30,6 +30,7 @@
 #include <stdlib.h>
 #include <cstring>
 #include <string>
+#include <string_view>
 #include "varg_intf.h"
 #include "varg.h"
 #include "envparse.h"
@@ -94,12 +95,12 @@ void envparser::addArgument(varg_intf* arg, const char* argKey, const char* help
     {
         // Add the keys to the argument
         ArgEntry newKeyArg = {};
-        std::string keyString = argKey;
+        std::string_view keyString = parser_base::storeSchemaString(argKey);
         newKeyArg.keyList.push_back(keyString);
 
         // Setup the key argument parameters
-        newKeyArg.name = argKey;
-        newKeyArg.help = helpText;
+        newKeyArg.name = keyString;
+        newKeyArg.help = parser_base::storeSchemaString(helpText);
         newKeyArg.argData = arg;
         newKeyArg.nargs = nargs;
         newKeyArg.position = 0;
@@ -122,7 +123,7 @@ void envparser::addArgument(varg_intf* arg, const char* argKey, const char* help
             parser_base::resizeMaxOptionLength(optionString.size());
         }
 
-        newKeyArg.optionString = optionString;
+        newKeyArg.optionString = parser_base::storeSchemaString(optionString);
 
         // Add the new argument to the list
         parser_base::addKeyArgListEntry(newKeyArg);
@@ -138,15 +139,16 @@ void envparser::addArgument(varg_intf* arg, const char* argKey, const char* help
 bool envparser::parse()
 {
     // Scan the environment
-    for (auto & currentArg : parser_base::getKeyArgList())
+    for (auto const& keyArg : parser_base::getKeyArgList())
     {
-        const char* envValue = getenv(currentArg.name.c_str());
+        const char* envValue = getenv(keyArg.name.data());
         if (NULL != envValue)
         {
-            // Process the return value string
-            std::list<std::string> assignmentValues;
-            std::string valueString = envValue;
-            size_t valueCount = parser_base::getValueList(valueString, assignmentValues);
+            ArgEntry& currentArg = parser_base::getWritableArg(keyArg);
+
+            // Process the return value string, a view of the environment value for the parse session
+            std::string_view valueString = envValue;
+            size_t valueCount = parser_base::countValueList(valueString);
             size_t requiredValueCount = static_cast<size_t>(abs(currentArg.nargs));
             if (debugMsgLevel > debugVerbosityLevel_e::veryVerboseDebug)
             {
@@ -157,10 +159,22 @@ bool envparser::parse()
 
             // Assign the values
             currentArg.isFound = true;
-            parserstr failedAssignment = valueString;
-            eAssignmentReturn status = ((valueCount > 1) ?
-                                            parser_base::assignListKeyValue(currentArg, assignmentValues, failedAssignment) :
-                                            parser_base::assignKeyValue(currentArg, valueString));
+            if (parser_base::isUtf8Validation() && !parser_base::checkUtf8Input(valueString, parserstr(currentArg.name)))
+            {
+                continue;
+            }
+            parserstr failedAssignment(valueString);
+            eAssignmentReturn status;
+            if (parser_base::isFileValueSource(currentArg, valueString))
+            {
+                status = parser_base::assignFileValues(currentArg, valueString.substr(1), valueCount, failedAssignment);
+            }
+            else
+            {
+                status = ((valueCount > 1) ?
+                              parser_base::assignDelimitedKeyValue(currentArg, valueString, valueCount, failedAssignment) :
+                              parser_base::assignKeyValue(currentArg, valueString.data()));
+            }
 
             // Check the assignment error
             switch(status)
@@ -170,26 +184,26 @@ bool envparser::parse()
 
                 case eAssignTooMany:
                     // Not enough values to meet the minimum required
-                    std::cerr << parser_base::getParserStringList()->getTooManyAssignmentMessage(currentArg.name, requiredValueCount, valueCount) << std::endl;
+                    std::cerr << parser_base::getParserStringList()->getTooManyAssignmentMessage(parserstr(currentArg.name), requiredValueCount, valueCount) << std::endl;
                     parser_base::setParsingError(true);
                     break;
 
                 case eAssignNoValue:
                     // Need at least one value
-                    std::cerr << parser_base::getParserStringList()->getMissingAssignmentMessage(currentArg.name) << std::endl;
+                    std::cerr << parser_base::getParserStringList()->getMissingAssignmentMessage(parserstr(currentArg.name)) << std::endl;
                     parser_base::setParsingError(true);
                     break;
 
                 case eAssignTooFew:
                     // More values than required
-                    std::cerr << parser_base::getParserStringList()->getMissingListAssignmentMessage(currentArg.name, requiredValueCount, valueCount) << std::endl;
+                    std::cerr << parser_base::getParserStringList()->getMissingListAssignmentMessage(parserstr(currentArg.name), requiredValueCount, valueCount) << std::endl;
                     parser_base::setParsingError(true);
                     break;
 
                 case eAssignFailed:
                 default:
                     // Failed an assignment
-                    std::cerr << parser_base::getParserStringList()->getAssignmentFailedMessage(currentArg.name, failedAssignment) << std::endl;
+                    std::cerr << parser_base::getParserStringList()->getAssignmentFailedMessage(parserstr(currentArg.name), failedAssignment) << std::endl;
                     parser_base::setParsingError(true);
                     break;
             } // end of switch status
@@ -204,7 +218,7 @@ bool envparser::parse()
         {
             if ((keyArg.isRequired) && !(keyArg.isFound))
             {
-                std::cerr << parser_base::getParserStringList()->getMissingArgumentMessage(keyArg.name) << std::endl;
+                std::cerr << parser_base::getParserStringList()->getMissingArgumentMessage(parserstr(keyArg.name)) << std::endl;
                 parser_base::setParsingError(true);
             }
         }
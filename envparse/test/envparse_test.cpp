@@ -28,6 +28,8 @@
 
 // Includes 
 #include <stdlib.h>
+#include <cstdio>
+#include <unistd.h>
 #include "varg.h"
 #include "listvarg.h"
 #include "envparse.h"
@@ -178,9 +180,8 @@ TEST(envparse, parsetestlist)
     setenv("MYENVTEST","10,21", 1);
     EXPECT_TRUE(testvar.parse());
     EXPECT_EQ(2, testlistvarg.value.size());
-    EXPECT_EQ(10, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(21, testlistvarg.value.front());
+    EXPECT_EQ(10, testlistvarg.value[0]);
+    EXPECT_EQ(21, testlistvarg.value[1]);
     unsetenv("MYENVTEST");
 } 
 
@@ -211,7 +212,6 @@ TEST(envparse, parsetestlistTooMany)
     EXPECT_EQ(0, testlistvarg.value.size());
     parserstr output = testing::internal::GetCapturedStderr();
     EXPECT_STREQ("\"MYENVTEST\" too many assignment values. Expected: 3 found: 4 arguments\n", output.c_str());
-    testing::internal::CaptureStderr();
     unsetenv("MYENVTEST");
 } 
 
@@ -225,11 +225,9 @@ TEST(envparse, parseTestAddDynamicListArg)
 
     EXPECT_TRUE(testvar.parse());
     EXPECT_EQ(3, testlistvarg.value.size());
-    EXPECT_EQ(18, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(22, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(43, testlistvarg.value.front());
+    EXPECT_EQ(18, testlistvarg.value[0]);
+    EXPECT_EQ(22, testlistvarg.value[1]);
+    EXPECT_EQ(43, testlistvarg.value[2]);
 } 
 
 TEST(envparse, parseTestAddDynamicList2Arg) 
@@ -242,9 +240,8 @@ TEST(envparse, parseTestAddDynamicList2Arg)
 
     EXPECT_TRUE(testvar.parse());
     EXPECT_EQ(2, testlistvarg.value.size());
-    EXPECT_EQ(18, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(22, testlistvarg.value.front());
+    EXPECT_EQ(18, testlistvarg.value[0]);
+    EXPECT_EQ(22, testlistvarg.value[1]);
 } 
 
 TEST(envparse, parseTestAddDynamicListIndefinite2Arg) 
@@ -257,9 +254,8 @@ TEST(envparse, parseTestAddDynamicListIndefinite2Arg)
 
     EXPECT_TRUE(testvar.parse());
     EXPECT_EQ(2, testlistvarg.value.size());
-    EXPECT_EQ(18, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(22, testlistvarg.value.front());
+    EXPECT_EQ(18, testlistvarg.value[0]);
+    EXPECT_EQ(22, testlistvarg.value[1]);
 } 
 
 TEST(envparse, parseTestAddDynamicListIndefinite6Arg) 
@@ -272,19 +268,105 @@ TEST(envparse, parseTestAddDynamicListIndefinite6Arg)
 
     EXPECT_TRUE(testvar.parse());
     EXPECT_EQ(6, testlistvarg.value.size());
-    EXPECT_EQ(18, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(22, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(13, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(12, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(11, testlistvarg.value.front());
-    testlistvarg.value.pop_front();
-    EXPECT_EQ(55, testlistvarg.value.front());
+    EXPECT_EQ(18, testlistvarg.value[0]);
+    EXPECT_EQ(22, testlistvarg.value[1]);
+    EXPECT_EQ(13, testlistvarg.value[2]);
+    EXPECT_EQ(12, testlistvarg.value[3]);
+    EXPECT_EQ(11, testlistvarg.value[4]);
+    EXPECT_EQ(55, testlistvarg.value[5]);
 } 
 
+TEST(envparse, parseTestFileValueSource) 
+{ 
+    char path[] = "/tmp/envparse_testXXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    const char fileContents[] = "18\n22,13\n";
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(fileContents) - 1), write(fd, fileContents, sizeof(fileContents) - 1));
+    close(fd);
+
+    argparser::envparser testvar(false);
+    argparser::listvarg<int> testlistvarg;
+
+    testvar.addArgument(&testlistvarg, "MYENVTEST", "My environment test var", -1);
+    setenv("MYENVTEST", (std::string("@") + path).c_str(), 1);
+
+    EXPECT_TRUE(testvar.parse());
+    ASSERT_EQ(3, testlistvarg.value.size());
+    EXPECT_EQ(18, testlistvarg.value[0]);
+    EXPECT_EQ(22, testlistvarg.value[1]);
+    EXPECT_EQ(13, testlistvarg.value[2]);
+    unsetenv("MYENVTEST");
+    remove(path);
+} 
+
+TEST(envparse, parseTestUtf8Validation) 
+{ 
+    char path[] = "/tmp/envparse_testXXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    const char fileContents[] = "caf\xC3\xA9\nna\xEF\xBF\xBD\xC0\xAFve\n";
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(fileContents) - 1), write(fd, fileContents, sizeof(fileContents) - 1));
+    close(fd);
+
+    argparser::envparser testvar(false);
+    argparser::varg<std::string> testvarg("");
+    argparser::listvarg<std::string> testlistvarg;
+    testvar.addArgument(&testvarg, "MYENVTEST", "My environment test var");
+    testvar.addArgument(&testlistvarg, "MYENVFILETEST", "My environment file test var", -10);
+    testvar.setUtf8Validation(true);
+
+    setenv("MYENVTEST", "caf\xC3\xA9", 1);
+    unsetenv("MYENVFILETEST");
+    EXPECT_TRUE(testvar.parse());
+    EXPECT_EQ("caf\xC3\xA9", testvarg.value);
+
+    setenv("MYENVTEST", "caf\xC3", 1);
+    setenv("MYENVFILETEST", (std::string("@") + path).c_str(), 1);
+    testing::internal::CaptureStderr();
+    EXPECT_FALSE(testvar.parse());
+    std::string output = testing::internal::GetCapturedStderr();
+    EXPECT_EQ(std::string("\"MYENVTEST\" invalid UTF-8 at byte 3\n"
+                          "\"") + path + ":2\" invalid UTF-8 at byte 5\n"
+                          "\"MYENVFILETEST @" + path + "\" assignment failed\n", output);
+    EXPECT_EQ("caf\xC3\xA9", testvarg.value);
+    unsetenv("MYENVTEST");
+    unsetenv("MYENVFILETEST");
+    remove(path);
+} 
+
+TEST(envparse, ownedArgumentMove) 
+{
+    argparser::envparser basevar;
+    argparser::varg<int>* ownedArg = basevar.addArgument(std::make_unique<argparser::varg<int>>(0), "MYENVTEST", "This is the test argument");
+    argparser::envparser testvar(std::move(basevar));
+
+    setenv("MYENVTEST", "10", 1);
+    EXPECT_TRUE(testvar.parse());
+    EXPECT_EQ(testValue, ownedArg->value);
+    unsetenv("MYENVTEST");
+}
+
+TEST(envparse, memoryUsage) 
+{
+    argparser::envparser testvar;
+    argparser::listvarg<int> testvarg;
+    testvar.addArgument(&testvarg, "MYENVTEST", "This is the test argument", -100);
+    argparser::memoryUsageReport before = testvar.memoryUsage();
+    EXPECT_EQ(1U, before.schema.allocations);
+    EXPECT_EQ(1U, before.keyLists.allocations);
+
+    setenv("MYENVTEST", "1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16", 1);
+    EXPECT_TRUE(testvar.parse());
+    EXPECT_GE(testvar.memoryUsage().values.bytes, before.values.bytes + (16 * sizeof(int)));
+    unsetenv("MYENVTEST");
+
+    testing::internal::CaptureStdout();
+    testvar.displayMemoryUsage(std::cout, true);
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("  MYENVTEST"));
+}
+
 //======================================================================================
 // Test functions parse
 //======================================================================================
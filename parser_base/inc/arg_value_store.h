@@ -0,0 +1,354 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file arg_value_store.h
+ * @ingroup argparser
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+#include "varg_intf.h"
+
+namespace argparser
+{
+
+/**
+ * @brief Closed set of value types supported by the argument value store.
+ *        std::monostate marks an unused store.
+ */
+using argValue_t = std::variant<std::monostate,
+                                bool, char, short int, int, long int, long long int,
+                                short unsigned, unsigned, long unsigned, long long unsigned,
+                                double, std::string,
+                                std::vector<bool>, std::vector<char>,
+                                std::vector<short int>, std::vector<int>, std::vector<long int>, std::vector<long long int>,
+                                std::vector<short unsigned>, std::vector<unsigned>, std::vector<long unsigned>, std::vector<long long unsigned>,
+                                std::vector<double>, std::vector<std::string>>;
+
+/**
+ * @brief Non-virtual argument value storage object.
+ *
+ * The value type is fixed when the store is created and the matching
+ * conversion function is selected from a jump table at that time, so an
+ * assignment is a single indirect call with no per-type fallback chain.
+ */
+class argValueStore
+{
+    public:
+        using convertFunction = valueParseStatus_e (*)(argValueStore& store, const char* newValue);
+
+    private:
+        /**
+         * @brief Value limits, only the member matching the value type is used
+         */
+        union valueBounds_u
+        {
+            struct
+            {
+                long long int       minValue;       ///< Minimum allowed signed value
+                long long int       maxValue;       ///< Maximum allowed signed value
+            } signedBounds;
+
+            struct
+            {
+                long long unsigned  minValue;       ///< Minimum allowed unsigned value
+                long long unsigned  maxValue;       ///< Maximum allowed unsigned value
+            } unsignedBounds;
+
+            struct
+            {
+                double              minValue;       ///< Minimum allowed absolute floating point value
+                double              maxValue;       ///< Maximum allowed absolute floating point value
+            } doubleBounds;
+        };
+
+        argValue_t          value;                  ///< Current value
+        valueBounds_u       bounds;                 ///< Value limits
+        convertFunction     convert;                ///< Conversion function for the value type
+        bool                flagSetValue;           ///< Value to set when a boolean flag key is found
+
+        /**
+         * @brief Select the conversion function for the current value type
+         */
+        void selectConverter();
+
+        /**
+         * @brief Set the default value limits for the element type T
+         */
+        template <typename T> void setDefaultBounds()
+        {
+            if constexpr (std::is_same_v<T, double>)
+            {
+                bounds.doubleBounds.minValue = std::numeric_limits<double>::min();
+                bounds.doubleBounds.maxValue = std::numeric_limits<double>::max();
+            }
+            else if constexpr (std::is_integral_v<T> && std::is_signed_v<T> && !std::is_same_v<T, char>)
+            {
+                bounds.signedBounds.minValue = std::numeric_limits<T>::min();
+                bounds.signedBounds.maxValue = std::numeric_limits<T>::max();
+            }
+            else if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T> && !std::is_same_v<T, bool>)
+            {
+                bounds.unsignedBounds.minValue = std::numeric_limits<T>::min();
+                bounds.unsignedBounds.maxValue = std::numeric_limits<T>::max();
+            }
+            else
+            {
+                bounds.unsignedBounds.minValue = 0;
+                bounds.unsignedBounds.maxValue = 0;
+            }
+        }
+
+    public:
+        /**
+         * @brief Convert a single element string to a T using the store limits
+         *
+         * @param newValue - Input element string
+         * @param element  - Converted element value
+         *
+         * @return valueParseStatus_e - Conversion status
+         */
+        template <typename T> valueParseStatus_e convertElement(const char* newValue, T& element) const
+        {
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                return varg_intf::getBoolValue(newValue, element);
+            }
+            else if constexpr (std::is_same_v<T, char>)
+            {
+                return varg_intf::getCharValue(newValue, element);
+            }
+            else if constexpr (std::is_same_v<T, std::string>)
+            {
+                element = newValue;
+                return valueParseStatus_e::PARSE_SUCCESS_e;
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                return varg_intf::parseDoubleValue(newValue, element, bounds.doubleBounds.minValue, bounds.doubleBounds.maxValue);
+            }
+            else if constexpr (std::is_signed_v<T>)
+            {
+                long long int tempValue;
+                valueParseStatus_e status = varg_intf::parseSignedValue(newValue, tempValue, bounds.signedBounds.minValue, bounds.signedBounds.maxValue);
+                if (status == valueParseStatus_e::PARSE_SUCCESS_e)
+                {
+                    element = static_cast<T>(tempValue);
+                }
+                return status;
+            }
+            else
+            {
+                long long unsigned tempValue;
+                valueParseStatus_e status = varg_intf::parseUnsignedValue(newValue, tempValue, bounds.unsignedBounds.minValue, bounds.unsignedBounds.maxValue);
+                if (status == valueParseStatus_e::PARSE_SUCCESS_e)
+                {
+                    element = static_cast<T>(tempValue);
+                }
+                return status;
+            }
+        }
+
+        /**
+         * @brief Get the mutable value variant, used by the conversion functions
+         *
+         * @return argValue_t& - Value variant
+         */
+        argValue_t& getVariant()                                    {return value;}
+
+        /**
+         * @brief Construct an unused value store
+         */
+        argValueStore() : value(), bounds(), convert(nullptr), flagSetValue(true) {}
+
+        /**
+         * @brief Create a single value or list value store
+         *
+         * @tparam T           - Value type, one of the argValue_t alternatives.  Use std::vector<E> for a list.
+         * @param defaultValue - Initial value
+         *
+         * @return argValueStore - New value store
+         */
+        template <typename T> static argValueStore create(T defaultValue)
+        {
+            argValueStore newStore;
+            newStore.value.template emplace<T>(std::move(defaultValue));
+            if constexpr (std::is_arithmetic_v<T>)
+            {
+                newStore.setDefaultBounds<T>();
+            }
+            else if constexpr (!std::is_same_v<T, std::string>)
+            {
+                newStore.setDefaultBounds<typename T::value_type>();
+            }
+            newStore.selectConverter();
+            return newStore;
+        }
+
+        /**
+         * @brief Create a bounded numeric single value store
+         *
+         * @param defaultValue - Initial value
+         * @param minValue     - Minimum allowed value
+         * @param maxValue     - Maximum allowed value
+         *
+         * @return argValueStore - New value store
+         */
+        template <typename T> static argValueStore create(T defaultValue, T minValue, T maxValue)
+        {
+            static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>, "Only numeric types have limits");
+            argValueStore newStore = create<T>(defaultValue);
+            newStore.setMinMax<T>(minValue, maxValue);
+            return newStore;
+        }
+
+        /**
+         * @brief Create a boolean flag value store
+         *
+         * @param defaultValue - Initial value, the flag key sets the inverse value
+         *
+         * @return argValueStore - New value store
+         */
+        static argValueStore createFlag(bool defaultValue = false)
+        {
+            argValueStore newStore = create<bool>(defaultValue);
+            newStore.flagSetValue = !defaultValue;
+            return newStore;
+        }
+
+        /**
+         * @brief Set the numeric value limits
+         *
+         * @param minValue - Minimum allowed value
+         * @param maxValue - Maximum allowed value
+         */
+        template <typename T> void setMinMax(T minValue, T maxValue)
+        {
+            if constexpr (std::is_same_v<T, double>)
+            {
+                bounds.doubleBounds.minValue = minValue;
+                bounds.doubleBounds.maxValue = maxValue;
+            }
+            else if constexpr (std::is_signed_v<T>)
+            {
+                bounds.signedBounds.minValue = minValue;
+                bounds.signedBounds.maxValue = maxValue;
+            }
+            else
+            {
+                bounds.unsignedBounds.minValue = minValue;
+                bounds.unsignedBounds.maxValue = maxValue;
+            }
+        }
+
+        /**
+         * @brief Check if the store holds a value type
+         *
+         * @return true  - Store was created with a value type
+         * @return false - Store is unused
+         */
+        bool isValid() const                                        {return (convert != nullptr);}
+
+        /**
+         * @brief Check if the store holds a list value type
+         *
+         * @return true  - List value, multiple argument values are allowed
+         * @return false - Single value type
+         */
+        bool isList() const;
+
+        /**
+         * @brief Check if a list store has no values
+         *
+         * @return true  - List is empty or the store is unused
+         * @return false - Store has a value
+         */
+        bool isEmpty() const;
+
+        /**
+         * @brief Convert the input string and set or append the value
+         *
+         * @param newValue - Input character string
+         *
+         * @return valueParseStatus_e - Conversion status
+         */
+        valueParseStatus_e setValue(const char* newValue)
+        {
+            return ((convert != nullptr) ? convert(*this, newValue) : valueParseStatus_e::PARSE_INVALID_INPUT_e);
+        }
+
+        /**
+         * @brief Set the flag value, only boolean stores support flag assignment
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if the flag value was set
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if the store is not a boolean
+         */
+        valueParseStatus_e setValue();
+
+        /**
+         * @brief Assign each value of a delimited value buffer in order
+         *
+         * @param buffer      - Pointer to the delimited value buffer, does not need to be null terminated
+         * @param length      - Length of the value buffer in characters
+         * @param delimiter   - Value list delimiter character
+         * @param failedIndex - Set to the index of the element that failed if the return is not PARSE_SUCCESS_e
+         *
+         * @return valueParseStatus_e - Status of the first failed element or PARSE_SUCCESS_e
+         */
+        valueParseStatus_e setValueBuffer(const char* buffer, size_t length, char delimiter, size_t& failedIndex);
+
+        /**
+         * @brief Reserve room for additional list values
+         *
+         * @param additionalCount - Number of values about to be added
+         */
+        void reserveValues(size_t additionalCount);
+
+        /**
+         * @brief Get a pointer to the stored value
+         *
+         * @tparam T - Requested value type
+         *
+         * @return const T* - Pointer to the value or nullptr if the store does not hold a T
+         */
+        template <typename T> const T* getValue() const             {return std::get_if<T>(&value);}
+
+        /**
+         * @brief Get the heap memory held by the string and list values
+         *
+         * @return heapUsage - Heap bytes and blocks held by the value
+         */
+        heapUsage getHeapUsage() const;
+};
+
+}; // end of namespace argparser
+
+/** @} */
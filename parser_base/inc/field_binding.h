@@ -0,0 +1,364 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file field_binding.h
+ * @ingroup argparser
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "heap_usage.h"
+#include "varg_intf.h"
+
+namespace argparser
+{
+
+/**
+ * @brief Enum field value name.  The name is a view of the parser schema pool.
+ */
+struct enumFieldName
+{
+    std::string_view    name;           ///< Value name
+    long long int       value;          ///< Enum value as a long long integer
+};
+
+using enumFieldNameList = std::vector<enumFieldName>;
+
+/**
+ * @brief Type trait to identify the std::vector fields that take a value list
+ */
+template <typename T> struct isFieldList : std::false_type {};
+template <typename E> struct isFieldList<std::vector<E>> : std::true_type {};
+
+/**
+ * @brief Argument storage that converts straight into a field of a user structure.
+ *
+ * The conversion functions for the field type are generated at compile time and
+ * selected when the field is bound, so a bound argument needs no varg_intf object
+ * and the value does not have to be copied out of the parser after parsing.
+ */
+class fieldBinding
+{
+    public:
+        /**
+         * @brief Conversion functions of one field type
+         */
+        struct fieldOps
+        {
+            valueParseStatus_e (*setValue)(const fieldBinding& binding, const char* newValue);     ///< Convert and set or append one value
+            void (*reserveValues)(const fieldBinding& binding, size_t additionalCount);             ///< Reserve room for list values
+            bool isList;                                                                            ///< True if the field is a std::vector
+        };
+
+    private:
+        void*               field;                          ///< Bound field, nullptr if the argument is not bound
+        const fieldOps*     ops;                            ///< Conversion functions of the field type
+        std::shared_ptr<const enumFieldNameList> enumNames; ///< Enum value names sorted by name, enum fields only
+        bool                flagSetValue;                   ///< Value to set when a boolean flag key is found
+
+        /**
+         * @brief Find the value of an enum name
+         *
+         * @param searchName - Name to find
+         *
+         * @return const long long int* - Pointer to the value or nullptr if the name is not known
+         */
+        const long long int* findEnumValue(std::string_view searchName) const
+        {
+            if (enumNames == nullptr)
+            {
+                return nullptr;
+            }
+
+            auto entry = std::lower_bound(enumNames->begin(), enumNames->end(), searchName,
+                                          [](const enumFieldName& currentEntry, std::string_view key) {return (currentEntry.name < key);});
+            return (((entry != enumNames->end()) && (entry->name == searchName)) ? &entry->value : nullptr);
+        }
+
+        /**
+         * @brief Convert a single element string to a T
+         *
+         * @param newValue - Input element string
+         * @param element  - Converted element value
+         *
+         * @return valueParseStatus_e - Conversion status
+         */
+        template <typename T> valueParseStatus_e convertElement(const char* newValue, T& element) const
+        {
+            if constexpr (std::is_enum_v<T>)
+            {
+                const long long int* enumValue = findEnumValue(newValue);
+                if (enumValue == nullptr)
+                {
+                    return valueParseStatus_e::PARSE_INVALID_INPUT_e;
+                }
+                element = static_cast<T>(*enumValue);
+                return valueParseStatus_e::PARSE_SUCCESS_e;
+            }
+            else if constexpr (std::is_same_v<T, bool>)
+            {
+                return varg_intf::getBoolValue(newValue, element);
+            }
+            else if constexpr (std::is_same_v<T, char>)
+            {
+                return varg_intf::getCharValue(newValue, element);
+            }
+            else if constexpr (std::is_same_v<T, std::string>)
+            {
+                element = newValue;
+                return valueParseStatus_e::PARSE_SUCCESS_e;
+            }
+            else if constexpr (std::is_floating_point_v<T>)
+            {
+                double tempValue;
+                valueParseStatus_e status = varg_intf::parseDoubleValue(newValue, tempValue, std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+                if (status == valueParseStatus_e::PARSE_SUCCESS_e)
+                {
+                    element = static_cast<T>(tempValue);
+                }
+                return status;
+            }
+            else if constexpr (std::is_signed_v<T>)
+            {
+                long long int tempValue;
+                valueParseStatus_e status = varg_intf::parseSignedValue(newValue, tempValue, std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+                if (status == valueParseStatus_e::PARSE_SUCCESS_e)
+                {
+                    element = static_cast<T>(tempValue);
+                }
+                return status;
+            }
+            else
+            {
+                static_assert(std::is_integral_v<T>, "Bound fields must be numeric, char, bool, std::string, enum or a std::vector of one of them");
+                long long unsigned tempValue;
+                valueParseStatus_e status = varg_intf::parseUnsignedValue(newValue, tempValue, std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+                if (status == valueParseStatus_e::PARSE_SUCCESS_e)
+                {
+                    element = static_cast<T>(tempValue);
+                }
+                return status;
+            }
+        }
+
+        /**
+         * @brief Field type T conversion function, appends to list fields
+         */
+        template <typename T> static valueParseStatus_e setFieldValue(const fieldBinding& binding, const char* newValue)
+        {
+            T& fieldValue = *static_cast<T*>(binding.field);
+            if constexpr (isFieldList<T>::value)
+            {
+                typename T::value_type element{};
+                valueParseStatus_e status = binding.convertElement(newValue, element);
+                if (status == valueParseStatus_e::PARSE_SUCCESS_e)
+                {
+                    fieldValue.push_back(std::move(element));
+                }
+                return status;
+            }
+            else
+            {
+                T element{};
+                valueParseStatus_e status = binding.convertElement(newValue, element);
+                if (status == valueParseStatus_e::PARSE_SUCCESS_e)
+                {
+                    fieldValue = std::move(element);
+                }
+                return status;
+            }
+        }
+
+        /**
+         * @brief Field type T list reservation function
+         */
+        template <typename T> static void reserveFieldValues(const fieldBinding& binding, size_t additionalCount)
+        {
+            if constexpr (isFieldList<T>::value)
+            {
+                reserveAdditional(*static_cast<T*>(binding.field), additionalCount);
+            }
+        }
+
+        template <typename T> static constexpr fieldOps fieldTypeOps = {&setFieldValue<T>, &reserveFieldValues<T>, isFieldList<T>::value};
+
+    public:
+        /**
+         * @brief Construct an unbound field binding
+         */
+        fieldBinding() : field(nullptr), ops(nullptr), enumNames(), flagSetValue(true) {}
+
+        /**
+         * @brief Bind a field
+         *
+         * @tparam T         - Field type: numeric, char, bool, std::string, enum or a std::vector of one of them
+         * @param fieldValue - Field to convert the argument values into.  A bool field is set to the
+         *                     inverse of its value at bind time when its flag key is found.
+         *
+         * @return fieldBinding - New field binding
+         */
+        template <typename T> static fieldBinding create(T& fieldValue)
+        {
+            fieldBinding newBinding;
+            newBinding.field = &fieldValue;
+            newBinding.ops = &fieldTypeOps<T>;
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                newBinding.flagSetValue = !fieldValue;
+            }
+            return newBinding;
+        }
+
+        /**
+         * @brief Set the enum value names of an enum field
+         *
+         * @param nameList - Value names, the first value of a repeated name is kept
+         */
+        void setEnumNames(enumFieldNameList nameList)
+        {
+            std::stable_sort(nameList.begin(), nameList.end(), [](const enumFieldName& leftEntry, const enumFieldName& rightEntry) {return (leftEntry.name < rightEntry.name);});
+            nameList.erase(std::unique(nameList.begin(), nameList.end(), [](const enumFieldName& leftEntry, const enumFieldName& rightEntry) {return (leftEntry.name == rightEntry.name);}),
+                           nameList.end());
+            enumNames = std::make_shared<const enumFieldNameList>(std::move(nameList));
+        }
+
+        /**
+         * @brief Check if a field is bound
+         *
+         * @return true  - Argument values are converted into a bound field
+         * @return false - Binding is unused
+         */
+        bool isBound() const                                        {return (ops != nullptr);}
+
+        /**
+         * @brief Check if the bound field is a std::vector
+         *
+         * @return true  - List field, multiple argument values are allowed
+         * @return false - Single value field or unbound
+         */
+        bool isList() const                                         {return ((ops != nullptr) && ops->isList);}
+
+        /**
+         * @brief Convert the input string and set or append the field value
+         *
+         * @param newValue - Input character string
+         *
+         * @return valueParseStatus_e - Conversion status
+         */
+        valueParseStatus_e setValue(const char* newValue) const
+        {
+            return ((ops != nullptr) ? ops->setValue(*this, newValue) : valueParseStatus_e::PARSE_INVALID_INPUT_e);
+        }
+
+        /**
+         * @brief Set a bool field to its flag value
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if the flag value was set
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if the field is not a bool
+         */
+        valueParseStatus_e setValue() const
+        {
+            if (ops != &fieldTypeOps<bool>)
+            {
+                return valueParseStatus_e::PARSE_INVALID_INPUT_e;
+            }
+
+            *static_cast<bool*>(field) = flagSetValue;
+            return valueParseStatus_e::PARSE_SUCCESS_e;
+        }
+
+        /**
+         * @brief Assign each value of a delimited value buffer in order
+         *
+         * @param buffer      - Pointer to the delimited value buffer, does not need to be null terminated
+         * @param length      - Length of the value buffer in characters
+         * @param delimiter   - Value list delimiter character
+         * @param failedIndex - Set to the index of the element that failed if the return is not PARSE_SUCCESS_e
+         *
+         * @return valueParseStatus_e - Status of the first failed element or PARSE_SUCCESS_e
+         */
+        valueParseStatus_e setValueBuffer(const char* buffer, size_t length, char delimiter, size_t& failedIndex) const
+        {
+            std::string element;
+            size_t      elementIndex = 0;
+            size_t      startPos     = 0;
+
+            while (startPos < length)
+            {
+                const char* delimiterPtr = static_cast<const char*>(memchr(buffer + startPos, delimiter, length - startPos));
+                size_t      endPos       = ((delimiterPtr != nullptr) ? static_cast<size_t>(delimiterPtr - buffer) : length);
+
+                element.assign(buffer + startPos, endPos - startPos);
+                valueParseStatus_e status = setValue(element.c_str());
+                if (status != valueParseStatus_e::PARSE_SUCCESS_e)
+                {
+                    failedIndex = elementIndex;
+                    return status;
+                }
+
+                elementIndex++;
+                startPos = endPos + 1;
+            }
+
+            return valueParseStatus_e::PARSE_SUCCESS_e;
+        }
+
+        /**
+         * @brief Reserve room for additional list values
+         *
+         * @param additionalCount - Number of values about to be added
+         */
+        void reserveValues(size_t additionalCount) const
+        {
+            if (ops != nullptr)
+            {
+                ops->reserveValues(*this, additionalCount);
+            }
+        }
+
+        /**
+         * @brief Get the heap memory held by the enum name table, the bound field belongs to the caller
+         *
+         * @return heapUsage - Heap bytes and blocks held by the binding
+         */
+        heapUsage getHeapUsage() const
+        {
+            return ((enumNames != nullptr) ? heapUsage{sizeof(*enumNames) + (enumNames->capacity() * sizeof(enumFieldName)), 2} : heapUsage{0, 0});
+        }
+};
+
+}; // end of namespace argparser
+
+/** @} */
@@ -0,0 +1,116 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file mapped_file.h
+ * @ingroup argparser
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstddef>
+#include <functional>
+
+namespace argparser
+{
+
+/**
+ * @brief Read only argument value source file.  Regular files are memory
+ *        mapped, standard input ("-") and files that can not be mapped are
+ *        read in fixed size blocks so the file size does not change the
+ *        memory used to process it.
+ */
+class mapped_file
+{
+    public:
+        /**
+         * @brief Line callback, return false to stop the scan
+         *
+         * @param line   - Pointer to the line, not null terminated, line end characters removed
+         * @param length - Length of the line in characters
+         */
+        using lineFunction = std::function<bool(const char* line, size_t length)>;
+
+    private:
+        int             fileDescriptor;     ///< Open file descriptor or -1
+        bool            ownDescriptor;      ///< True if the descriptor must be closed, false for standard input
+        const char*     mappedData;         ///< Mapped file data or nullptr if the file is read in blocks
+        size_t          mappedSize;         ///< Size of the mapped file data
+
+    public:
+        static constexpr size_t readBlockSize = 64 * 1024;     ///< Block size used when the file can not be mapped
+
+        /**
+         * @brief Construct a closed mapped_file object
+         */
+        mapped_file() : fileDescriptor(-1), ownDescriptor(false), mappedData(nullptr), mappedSize(0) {}
+        mapped_file(const mapped_file& other) = delete;
+        mapped_file& operator=(const mapped_file& other) = delete;
+
+        /**
+         * @brief Unmap and close the file
+         */
+        ~mapped_file()                                              {close();}
+
+        /**
+         * @brief Open and map a file
+         *
+         * @param path - File path, "-" selects standard input
+         *
+         * @return true  - File is open
+         * @return false - File could not be opened
+         */
+        bool open(const char* path);
+
+        /**
+         * @brief Unmap and close the file
+         */
+        void close();
+
+        /**
+         * @brief Check if the file data is memory mapped
+         *
+         * @return true  - data() and size() give the whole file
+         * @return false - File is read in blocks by forEachLine()
+         */
+        bool isMapped() const                                       {return (mappedData != nullptr);}
+
+        const char* data() const                                    {return mappedData;}    ///< @brief Mapped file data
+        size_t      size() const                                    {return mappedSize;}    ///< @brief Mapped file size
+
+        /**
+         * @brief Call a function for each line of the file, lines may end in "\n" or "\r\n"
+         *
+         * @param function - Line callback
+         *
+         * @return true  - All lines were processed
+         * @return false - The callback stopped the scan or a read failed
+         */
+        bool forEachLine(const lineFunction& function);
+};
+
+}; // end of namespace argparser
+
+/** @} */
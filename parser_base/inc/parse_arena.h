@@ -0,0 +1,141 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file parse_arena.h
+ * @ingroup argparser
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include "heap_usage.h"
+
+namespace argparser
+{
+
+/**
+ * @brief Parse session memory arena.
+ *
+ * A monotonic arena for the short lived data of one parse run.  The first
+ * initialBufferSize bytes come from a buffer inside the object, larger
+ * sessions take blocks from the upstream resource.  Deallocation is a no-op
+ * and reset() releases everything at once, so a typical command line parse
+ * makes no heap allocations for its transient data.
+ */
+class parse_arena : public std::pmr::memory_resource
+{
+    public:
+        static constexpr size_t initialBufferSize = 1024;      ///< Size of the buffer used before any upstream block
+
+    private:
+        /**
+         * @brief Upstream resource adapter that counts the blocks the arena holds
+         */
+        class blockCounter : public std::pmr::memory_resource
+        {
+            public:
+                std::pmr::memory_resource*  upstream;       ///< Resource the blocks come from
+                heapUsage                   usage;          ///< Blocks currently held
+
+                explicit blockCounter(std::pmr::memory_resource* upstreamResource) : upstream(upstreamResource), usage{0, 0} {}
+
+            private:
+                void* do_allocate(size_t bytes, size_t alignment) override
+                {
+                    void* block = upstream->allocate(bytes, alignment);
+                    usage += heapUsage{bytes, 1};
+                    return block;
+                }
+
+                void do_deallocate(void* block, size_t bytes, size_t alignment) override
+                {
+                    upstream->deallocate(block, bytes, alignment);
+                    usage.bytes -= bytes;
+                    usage.allocations--;
+                }
+
+                bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {return (this == &other);}
+        };
+
+        alignas(std::max_align_t) std::byte                 initialBuffer[initialBufferSize];   ///< First arena block
+        std::pmr::memory_resource*                          upstream;           ///< Resource for blocks after the first, used from the next reset()
+        blockCounter                                        upstreamBlocks;     ///< Counts the upstream blocks of the current arena
+        std::optional<std::pmr::monotonic_buffer_resource>  arena;              ///< Current session arena
+        size_t                                              allocatedBytes;     ///< Bytes allocated since the last reset()
+
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void  do_deallocate(void* /* block */, size_t /* bytes */, size_t /* alignment */) override {}
+        bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override {return (this == &other);}
+
+    public:
+        /**
+         * @brief Construct an empty arena
+         *
+         * @param upstreamResource - Resource for blocks after the first, default is the process default resource
+         */
+        explicit parse_arena(std::pmr::memory_resource* upstreamResource = std::pmr::get_default_resource());
+        parse_arena(const parse_arena& other) = delete;
+        parse_arena& operator=(const parse_arena& other) = delete;
+
+        /**
+         * @brief Release all of the session memory.  Everything allocated from the
+         *        arena must be out of use.
+         */
+        void reset();
+
+        /**
+         * @brief Set the resource the arena takes its blocks from, used from the next reset()
+         *
+         * @param upstreamResource - Upstream memory resource
+         */
+        void setUpstream(std::pmr::memory_resource* upstreamResource)   {upstream = upstreamResource;}
+
+        /**
+         * @brief Get the resource the arena takes its blocks from
+         *
+         * @return std::pmr::memory_resource* - Upstream memory resource
+         */
+        std::pmr::memory_resource* getUpstream() const                  {return upstream;}
+
+        /**
+         * @brief Get the number of bytes allocated since the last reset()
+         *
+         * @return size_t - Allocated byte count
+         */
+        size_t getAllocatedBytes() const                                {return allocatedBytes;}
+
+        /**
+         * @brief Get the upstream blocks the arena currently holds, the built in buffer is not included
+         *
+         * @return heapUsage - Upstream bytes and blocks held until the next reset()
+         */
+        heapUsage getHeapUsage() const                                  {return upstreamBlocks.usage;}
+};
+
+}; // end of namespace argparser
+
+/** @} */
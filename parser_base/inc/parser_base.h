@@ -32,10 +32,22 @@
 // Includes 
 #include <cstdlib>
 #include <cstdio>
+#include <functional>
+#include <iterator>
 #include <string>
+#include <string_view>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include <iostream>
 #include "varg_intf.h"
+#include "arg_value_store.h"
+#include "field_binding.h"
+#include "parse_arena.h"
+#include "path_glob.h"
+#include "schema_pool.h"
+#include "string_pool.h"
 #include "parser_string_list.h"
 
 //#define DYNAMIC_INTERNATIONALIZATION
@@ -58,22 +70,185 @@ enum eAddStatusReturn
     eAddArgSuccess = 0,             ///< Argument add passed
     eAddArgFailed,                  ///< Argument add failed
     eAddArgNotList,                 ///< Argument is not a list so arg count > 1 is not allowed
+    eAddArgTableFull,               ///< Fixed capacity argument or key table is full
 };
 
+constexpr size_t validatorBatchSize = 32;       ///< Number of values each validator job checks
+
 /**
- * @brief Positional argument list entry data structure
+ * @brief Argument value validator, called after parsing with each value assigned to the
+ *        argument.  Validators may run concurrently on several threads.
+ *
+ * @param value - Value string, not null terminated
+ *
+ * @return bool - True if the value is valid
+ */
+using argValidator = std::function<bool(std::string_view value)>;
+
+/**
+ * @brief Positional argument list entry data structure.  The name, help, option
+ *        and key strings are views of the parser schema pool.
  */
 struct ArgEntry
 {
-    parserstr   name;                                   ///< Argument name
-    parserstr   help;                                   ///< Help description string
-    parserstr   optionString;                           ///< Help option string
-    varg_intf*  argData;                                ///< Argument data and storage object
+    std::string_view    name;                           ///< Argument name
+    std::string_view    help;                           ///< Help description string
+    std::string_view    optionString;                   ///< Help option string
+    varg_intf*  argData;                                ///< Argument data and storage object, nullptr if the binding or valueStore is used
     int         nargs;                                  ///< Number of argument data values expected
     int         position;                               ///< Argument position index, 0 == any
     bool        isRequired;                             ///< True if this is a required argument, else false if it is optional
     bool        isFound;                                ///< True if the argument key was found during parsing, else false if it was not
-    std::list<parserstr>  keyList;                      ///< List of keys associated with the argument
+    std::vector<std::string_view> keyList;              ///< List of keys associated with the argument, not null terminated
+    argValueStore         valueStore;                   ///< Built in value storage, used when argData == nullptr and no field is bound
+    fieldBinding          binding;                      ///< Bound structure field, used when argData == nullptr
+    argValidator          validator;                    ///< Optional value validator, run after parsing
+    globMode_e            globMode;                     ///< Positional value glob expansion mode
+    size_t                schemaIndex;                  ///< Registration index, set when the entry is added to a parser
+};
+
+/**
+ * @brief Argument entries shared by a parser and its copies.  The schema is never
+ *        changed once it is shared, a parser that changes a shared entry works on
+ *        a private copy of that entry.
+ */
+struct argSchema
+{
+    std::list<ArgEntry>     keyArgList;                 ///< Key based arguments
+    std::list<ArgEntry>     positionalArgList;          ///< Positional arguments
+    size_t                  entryCount;                 ///< Number of key and positional entries, the schema index limit
+};
+
+/**
+ * @brief Read only view of one parser argument list, the shared schema entries followed
+ *        by the entries added to the parser.  A shared entry the parser has changed
+ *        resolves to the parser's private copy.
+ */
+class argEntryRange
+{
+    public:
+        using entryList = std::list<ArgEntry>;
+        using copyList  = std::vector<std::unique_ptr<ArgEntry>>;
+
+        class iterator
+        {
+            private:
+                entryList::const_iterator   current;        ///< Current entry
+                entryList::const_iterator   sharedEnd;      ///< End of the shared entries
+                entryList::const_iterator   ownBegin;       ///< First entry added to the parser
+                const copyList*             sharedCopies;   ///< Private copies of the shared entries, by schema index
+                bool                        inShared;       ///< True while current is a shared entry
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type        = ArgEntry;
+                using difference_type   = std::ptrdiff_t;
+                using pointer           = const ArgEntry*;
+                using reference         = const ArgEntry&;
+
+                iterator(entryList::const_iterator position, entryList::const_iterator sharedEnd, entryList::const_iterator ownBegin,
+                         const copyList* sharedCopies, bool inShared) :
+                    current(position), sharedEnd(sharedEnd), ownBegin(ownBegin), sharedCopies(sharedCopies), inShared(inShared) {}
+
+                reference operator*() const
+                {
+                    if (inShared && (current->schemaIndex < sharedCopies->size()) && ((*sharedCopies)[current->schemaIndex] != nullptr))
+                    {
+                        return *(*sharedCopies)[current->schemaIndex];
+                    }
+                    return *current;
+                }
+
+                pointer operator->() const                              {return &(**this);}
+
+                iterator& operator++()
+                {
+                    ++current;
+                    if (inShared && (current == sharedEnd))
+                    {
+                        current = ownBegin;
+                        inShared = false;
+                    }
+                    return *this;
+                }
+
+                iterator operator++(int)                                {iterator previous = *this; ++(*this); return previous;}
+                bool operator==(const iterator& other) const            {return ((inShared == other.inShared) && (current == other.current));}
+                bool operator!=(const iterator& other) const            {return !(*this == other);}
+        };
+
+        /**
+         * @brief Constructor
+         *
+         * @param shared       - Shared schema entries, nullptr if the parser has no shared schema
+         * @param own          - Entries added to the parser
+         * @param sharedCopies - Private copies of the shared entries, by schema index
+         */
+        argEntryRange(const entryList* shared, const entryList& own, const copyList& sharedCopies) :
+            shared(shared), own(own), sharedCopies(sharedCopies) {}
+
+        iterator begin() const
+        {
+            if ((shared != nullptr) && !shared->empty())
+            {
+                return iterator(shared->begin(), shared->end(), own.begin(), &sharedCopies, true);
+            }
+            return iterator(own.begin(), own.begin(), own.begin(), &sharedCopies, false);
+        }
+
+        iterator end() const                    {return iterator(own.end(), own.end(), own.begin(), &sharedCopies, false);}
+        size_t size() const                     {return (((shared != nullptr) ? shared->size() : 0) + own.size());}
+        bool empty() const                      {return (size() == 0);}
+
+    private:
+        const entryList*    shared;             ///< Shared schema entries or nullptr
+        const entryList&    own;                ///< Entries added to the parser
+        const copyList&     sharedCopies;       ///< Private copies of the shared entries
+};
+
+/**
+ * @brief Parser heap memory by category, see parser_base::memoryUsage().
+ *        The parser object itself is not included.
+ */
+struct memoryUsageReport
+{
+    heapUsage   schema;             ///< Argument entry list nodes and parser owned help text
+    heapUsage   sharedSchema;       ///< Argument entries shared with parser copies, counted by every parser that uses them
+    heapUsage   keyLists;           ///< Argument key list arrays
+    heapUsage   schemaStrings;      ///< Registration strings copied into the schema pool
+    heapUsage   stringList;         ///< Message string list object
+    heapUsage   values;             ///< Argument values, varg objects and built in value storage
+    heapUsage   valueStrings;       ///< Value strings interned in the parser string pool
+    heapUsage   parseBuffers;       ///< Parse session arena blocks, validation queue and parse result cache
+
+    /**
+     * @brief Get the sum of all of the categories
+     *
+     * @return heapUsage - Total heap bytes and blocks
+     */
+    heapUsage getTotal() const
+    {
+        heapUsage total = schema;
+        total += sharedSchema;
+        total += keyLists;
+        total += schemaStrings;
+        total += stringList;
+        total += values;
+        total += valueStrings;
+        total += parseBuffers;
+        return total;
+    }
+};
+
+/**
+ * @brief Deferred argument value validation
+ */
+struct validationItem
+{
+    const ArgEntry*     arg;            ///< Argument the value was assigned to
+    std::string_view    value;          ///< Value string
+    int                 argvIndex;      ///< argv index the value came from
+    bool                valid;          ///< Validation result
 };
 
 /**
@@ -86,7 +261,13 @@ class parser_base
     private:
         // Argument lists
         ArgEntry                nullEntry;                      ///< Return entry if argument key list is not found
-        std::list<ArgEntry>     keyArgList;                     ///< List of key based arguments
+        std::shared_ptr<const argSchema> sharedSchema;          ///< Entries shared with the parser this one was copied from, nullptr if none
+        std::vector<std::unique_ptr<ArgEntry>> sharedArgCopies; ///< Private copies of the shared entries this parser changed, by schema index
+        std::list<ArgEntry>     keyArgList;                     ///< Key based arguments added to this parser
+        std::list<ArgEntry>     positionalArgList;              ///< Positional arguments added to this parser
+        size_t                  nextSchemaIndex;                ///< Schema index of the next added argument
+        mutable std::shared_ptr<const argSchema> copySchema;    ///< Schema handed to copies of this parser, rebuilt after a change
+        mutable std::mutex      copySchemaLock;                 ///< Serializes building copySchema, copies may be made on several threads
 
         // Help page text enhancements
         size_t                  maxColumnWidth;                 ///< Maximum help message column width
@@ -100,12 +281,19 @@ class parser_base
         // Parsing behavior control
         bool                    errorAbort;                     ///< True = Stop parsing if an error is found, False = accumulate errors until parsing complete
         int                     debugMsgLevel;                  ///< Current debug message level, default = 0 : None
+        bool                    utf8Validation;                 ///< True = check that argument text is valid UTF-8, default = false
 
         // Parse tracking data
         bool                    parsingError;                   ///< Set to true if any parsing error was detected.
         BaseParserStringList*   parserStringList;               ///< Parser string list
+        std::shared_ptr<string_pool> stringPool;                ///< Interned argument value strings, created on first use
+        std::shared_ptr<schema_pool> schemaPool;                ///< Argument registration strings, created on first use
+        std::vector<std::shared_ptr<varg_intf>> ownedArgs;      ///< Argument objects owned by the parser, shared by parser copies
+        parse_arena             sessionArena;                   ///< Parse session memory, released at the start of each parse
 
     protected:
+        static constexpr parserchar fileSourcePrefix = '@';     ///< Value string prefix that selects a value source file
+
         parserchar getKeyListDelimeter()                {return keyListDelimeter;}
         BaseParserStringList* getParserStringList()     {return parserStringList;}
 
@@ -117,13 +305,196 @@ class parser_base
         void clearParsingError()                        {parsingError = false;}
         bool isParserAbort()                            {return (!(parsingError && errorAbort));}
 
+        std::pmr::memory_resource* getParseResource()   {return &sessionArena;}
+        void resetParseArena()                          {sessionArena.reset();}
+
+        /**
+         * @brief Copy a string into the parse session memory
+         *
+         * @param value - String to copy
+         *
+         * @return std::string_view - Null terminated copy, valid until the next parse
+         */
+        std::string_view storeParseString(std::string_view value);
+        bool isUtf8Validation() const                   {return utf8Validation;}
+
+        /**
+         * @brief Print the invalid UTF-8 error message
+         *
+         * @param sourceName - Name of the text source, argv index, environment variable or file
+         * @param offset     - Byte offset of the invalid sequence in the source text
+         */
+        void reportInvalidUtf8(const parserstr& sourceName, size_t offset) const;
+
+        /**
+         * @brief Check that an input string is valid UTF-8, report and flag a parsing error if it is not
+         *
+         * @param text       - Input text
+         * @param sourceName - Name of the text source used in the error message
+         *
+         * @return bool - True if the text is valid
+         */
+        bool checkUtf8Input(std::string_view text, const parserstr& sourceName);
+
+        /**
+         * @brief Store an argument registration string in the schema pool.  Copies of
+         *        the parser share the pool so the views stay valid in every copy.
+         *
+         * @param text - Name, key list, help or option text
+         *
+         * @return std::string_view - Null terminated view of the stored text
+         */
+        std::string_view storeSchemaString(std::string_view text);
+
+        /**
+         * @brief Take ownership of an argument object.  Copies of the parser share
+         *        the object, it is destroyed with the last parser that uses it.
+         *
+         * @param arg - Argument object
+         *
+         * @return varg_intf* - Pointer to the owned argument object
+         */
+        varg_intf* adoptArgument(std::unique_ptr<varg_intf> arg);
+
+        /**
+         * @brief Get the schema handed to copies of the parser, built from the current
+         *        entries on the first copy after a change.  One parser may be copied
+         *        from several threads at once.
+         *
+         * @return std::shared_ptr<const argSchema> - Shared schema, nullptr if the parser has no arguments
+         */
+        std::shared_ptr<const argSchema> getCopySchema() const;
+
         void resizeMaxOptionLength(size_t newsize)                  {if (newsize > maxOptionLength) maxOptionLength = newsize;}
         const size_t getOptionKeyWidth()                            {return std::min(maxOptionLength, maxColumnWidth/2);}
         const size_t getHelpKeyWidth(const size_t optionKeyWidth)   {return (maxColumnWidth - optionKeyWidth - 1);}
         
-        void addKeyArgListEntry(ArgEntry entry)         {keyArgList.push_back(entry);}
-        std::list<ArgEntry>& getKeyArgList()            {return keyArgList;}
-        bool isKeyArgListEmpty()                        {return keyArgList.empty();}
+        void addKeyArgListEntry(ArgEntry entry);
+        void addPositionalArgListEntry(ArgEntry entry);
+        argEntryRange getKeyArgList() const
+        {
+            return argEntryRange((sharedSchema != nullptr) ? &sharedSchema->keyArgList : nullptr, keyArgList, sharedArgCopies);
+        }
+        argEntryRange getPositionalArgList() const
+        {
+            return argEntryRange((sharedSchema != nullptr) ? &sharedSchema->positionalArgList : nullptr, positionalArgList, sharedArgCopies);
+        }
+        bool isKeyArgListEmpty() const                  {return getKeyArgList().empty();}
+        bool isPositionalArgListEmpty() const           {return getPositionalArgList().empty();}
+
+        /**
+         * @brief Check if an argument entry is an unchanged entry of the shared schema
+         *
+         * @param arg - Entry from getKeyArgList() or getPositionalArgList()
+         *
+         * @return true  - Entry is shared with other parsers
+         * @return false - Entry belongs to this parser
+         */
+        bool isSharedArg(const ArgEntry& arg) const
+        {
+            return ((sharedSchema != nullptr) && (arg.schemaIndex < sharedSchema->entryCount) &&
+                    ((arg.schemaIndex >= sharedArgCopies.size()) || (sharedArgCopies[arg.schemaIndex] == nullptr)));
+        }
+
+        /**
+         * @brief Get an argument entry that can be changed.  A shared schema entry is
+         *        copied into the parser on the first change.
+         *
+         * @param arg - Entry from getKeyArgList() or getPositionalArgList()
+         *
+         * @return ArgEntry& - Entry owned by this parser
+         */
+        ArgEntry& getWritableArg(const ArgEntry& arg);
+
+        /**
+         * @brief Argument storage dispatch, use the varg_intf adapter if one was
+         *        supplied, else the bound field, else the built in value store
+         */
+        static valueParseStatus_e setArgValue(ArgEntry& currentArg, const char* newValue)
+        {
+            if (currentArg.argData != nullptr)
+            {
+                return currentArg.argData->setValue(newValue);
+            }
+            return (currentArg.binding.isBound() ? currentArg.binding.setValue(newValue) : currentArg.valueStore.setValue(newValue));
+        }
+
+        static valueParseStatus_e setArgFlagValue(ArgEntry& currentArg)
+        {
+            if (currentArg.argData != nullptr)
+            {
+                return currentArg.argData->setValue();
+            }
+            return (currentArg.binding.isBound() ? currentArg.binding.setValue() : currentArg.valueStore.setValue());
+        }
+
+        static valueParseStatus_e setArgValueBuffer(ArgEntry& currentArg, const char* buffer, size_t length, char delimiter, size_t& failedIndex)
+        {
+            if (currentArg.argData != nullptr)
+            {
+                return currentArg.argData->setValueBuffer(buffer, length, delimiter, failedIndex);
+            }
+            return (currentArg.binding.isBound() ? currentArg.binding.setValueBuffer(buffer, length, delimiter, failedIndex) :
+                                                   currentArg.valueStore.setValueBuffer(buffer, length, delimiter, failedIndex));
+        }
+
+        static void reserveArgValues(ArgEntry& currentArg, size_t additionalCount)
+        {
+            if (currentArg.argData != nullptr)
+            {
+                currentArg.argData->reserveValues(additionalCount);
+            }
+            else if (currentArg.binding.isBound())
+            {
+                currentArg.binding.reserveValues(additionalCount);
+            }
+            else
+            {
+                currentArg.valueStore.reserveValues(additionalCount);
+            }
+        }
+
+        static bool isArgList(const ArgEntry& currentArg)
+        {
+            if (currentArg.argData != nullptr)
+            {
+                return currentArg.argData->isList();
+            }
+            return (currentArg.binding.isBound() ? currentArg.binding.isList() : currentArg.valueStore.isList());
+        }
+
+        /**
+         * @brief Check the number of assignment values against the argument nargs value
+         *
+         * @param currentArg - Argument to check
+         * @param valueCount - Number of assignment values
+         *
+         * @return eAssignmentReturn - eAssignSuccess if the count is acceptable, else the count error
+         */
+        static eAssignmentReturn checkValueCount(const ArgEntry& currentArg, size_t valueCount);
+
+        /**
+         * @brief Assign each value of the list to the argument storage object, no count checks.
+         *
+         * @param currentArg       - Pointer to the argument to set
+         * @param assignmentValues - List of assignment value strings
+         * @param failedValue      - Value string that failed assignment in the list
+         *
+         * @return eAssignmentReturn - Assignment return status
+         */
+        static eAssignmentReturn assignValueList(ArgEntry& currentArg, std::list<parserstr>& assignmentValues, parserstr& failedValue);
+
+        /**
+         * @brief Assign the values of a delimited value list string, no count checks.
+         *
+         * @param currentArg  - Pointer to the argument to set
+         * @param valueString - Delimited value list string, leading assignment delimiter already stripped.
+         *                      Borrowing argument types keep slices of this buffer.
+         * @param failedValue - Value string that failed assignment in the list
+         *
+         * @return eAssignmentReturn - Assignment return status
+         */
+        eAssignmentReturn assignDelimitedValues(ArgEntry& currentArg, std::string_view valueString, parserstr& failedValue) const;
 
         // Unit test helpers
         bool   getErrorAbortFlag()                      {return errorAbort;}
@@ -189,6 +560,71 @@ class parser_base
          */
         void setDebugLevel(int debugLevel)                              {debugMsgLevel = debugLevel;}
 
+        /**
+         * @brief Enable or disable the UTF-8 check of the argument text.  When enabled
+         *        each argv string, environment value and value source file is checked
+         *        once before it is assigned and invalid text is a parsing error.
+         *
+         * @param enable - True to check the argument text, default = false
+         */
+        void setUtf8Validation(bool enable)                             {utf8Validation = enable;}
+
+        /**
+         * @brief Set the memory resource the parse session arena takes its blocks from
+         *        once its built in buffer is used, takes effect at the next parse
+         *
+         * @param resource - Upstream memory resource, default = std::pmr::get_default_resource()
+         */
+        void setMemoryResource(std::pmr::memory_resource* resource)    {sessionArena.setUpstream(resource);}
+
+        /**
+         * @brief Get the number of bytes the current parse session allocated from its arena
+         *
+         * @return size_t - Allocated byte count
+         */
+        size_t getParseArenaBytes() const                               {return sessionArena.getAllocatedBytes();}
+
+        /**
+         * @brief Get the parser string pool, used by internlistvarg arguments to
+         *        deduplicate repeated values.  Copies of the parser share the pool so
+         *        values interned through either copy stay valid.
+         *
+         * @return string_pool& - Parser string pool
+         */
+        string_pool& getStringPool();
+
+        /**
+         * @brief Get the parser string pool deduplication counters
+         *
+         * @return stringPoolStats - Intern count, distinct count and byte totals, all zero if the pool is unused
+         */
+        stringPoolStats getStringPoolStats() const;
+
+        /**
+         * @brief Get the schema pool counters
+         *
+         * @return schemaPoolStats - In place and copied registration string counters, all zero if the pool is unused
+         */
+        schemaPoolStats getSchemaPoolStats() const;
+
+        /**
+         * @brief Get the heap memory held by the parser by category.  Container
+         *        overhead is estimated from the element counts and capacities.  The
+         *        string and schema pools are shared by parser copies and are reported
+         *        in full by every copy.
+         *
+         * @return memoryUsageReport - Heap bytes and blocks per category
+         */
+        memoryUsageReport memoryUsage() const;
+
+        /**
+         * @brief Print the memory usage report
+         *
+         * @param outStream   - Output stream for the report.  Default is the standard error stream
+         * @param perArgument - True to add a line for each argument
+         */
+        void displayMemoryUsage(std::ostream &outStream = std::cerr, bool perArgument = false) const;
+
         /**
          * @brief Format the input string to the required width.  Break the string 
          *        if longer than maxWidth at the nearest break parsercharater.  Pad any
@@ -210,11 +646,12 @@ class parser_base
          * the input varg
          * 
          * @param arg          - Pointer to the argument to add the key values list
-         * @param inputKeyList - Delimited list of argument data
+         * @param inputKeyList - Delimited list of argument data, stored in the schema pool.
+         *                       The keys are views of the stored list.
          * 
          * @return size_t - number of arguments added to the arg
          */
-        size_t addArgKeyList(ArgEntry& arg, parserstr inputKeyList) const;
+        size_t addArgKeyList(ArgEntry& arg, std::string_view inputKeyList);
 
         //=================================================================================================
         //======================= Argument parsing helper interface methods ===============================
@@ -229,6 +666,27 @@ class parser_base
          */
         size_t getValueList(parserstr& valueString, std::list<parserstr>& valueList) const;
 
+        /**
+         * @brief Count the elements of a delimited value list without splitting it.
+         *        Strips the leading assignment delimiter if present.
+         *
+         * @param valueString - delimited list of value data
+         *
+         * @return size_t - number of elements in the list
+         */
+        size_t countValueList(parserstr& valueString) const;
+        size_t countValueList(std::string_view& valueString) const;
+
+        /**
+         * @brief Count the elements of a delimited value list as is, a leading
+         *        assignment delimiter is part of the first element
+         *
+         * @param valueString - delimited list of value data
+         *
+         * @return size_t - number of elements in the list
+         */
+        size_t countDelimitedValues(std::string_view valueString) const;
+
         /**
          * @brief Find the argument object that matches the input string
          * 
@@ -237,7 +695,7 @@ class parser_base
          * 
          * @return ArgEntry - Reference to the ArgEntry from the list that matched if found == true
          */
-        ArgEntry& findMatchingArg(const parserstr& checkString, bool& found);
+        ArgEntry& findMatchingArg(std::string_view checkString, bool& found);
 
         /**
          * @brief Assign the flag value to the key argument
@@ -258,6 +716,18 @@ class parser_base
          */
         static eAssignmentReturn assignKeyValue(ArgEntry& currentArg, parserstr& assignmentValue);
 
+        /**
+         * @brief Assign a single value to an argument storage object from a null terminated
+         *        value buffer.  Borrowing argument types keep a view of the buffer, so it must
+         *        stay valid for the parse session.
+         *
+         * @param currentArg      - Pointer to the argument to set
+         * @param assignmentValue - Null terminated value string
+         *
+         * @return eAssignmentReturn - Assignment return status
+         */
+        static eAssignmentReturn assignKeyValue(ArgEntry& currentArg, const char* assignmentValue);
+
         /**
          * @brief Assign multiple values to a list argument storage object.  
          * 
@@ -269,6 +739,77 @@ class parser_base
          */
         static eAssignmentReturn assignListKeyValue(ArgEntry& currentArg, std::list<parserstr>& assignmentValues, parserstr& failedValue);
 
+        /**
+         * @brief Assign all of the values of a delimited value list to a list argument storage
+         *        object without splitting the list into seperate strings.  Large lists may
+         *        be converted in parallel by the argument storage object.
+         *
+         * @param currentArg  - Pointer to the argument to set
+         * @param valueString - Delimited value list string, leading assignment delimiter already stripped
+         * @param valueCount  - Number of elements to check and reserve storage for
+         * @param failedValue - Value string that failed assignment in the list
+         *
+         * @return eAssignmentReturn - Assignment return status
+         */
+        eAssignmentReturn assignDelimitedKeyValue(ArgEntry& currentArg, std::string_view valueString, size_t valueCount, parserstr& failedValue) const;
+
+        /**
+         * @brief Check if a value string names a value source file, "@path" or "@-" for
+         *        standard input.  Only list arguments accept a value source file.
+         *
+         * @param currentArg  - Argument being assigned
+         * @param valueString - Value string, leading assignment delimiter already stripped
+         *
+         * @return true  - Value string is a value source file reference
+         * @return false - Value string is a value list
+         */
+        static bool isFileValueSource(const ArgEntry& currentArg, std::string_view valueString)
+        {
+            return ((valueString.size() > 1) && (valueString[0] == fileSourcePrefix) && isArgList(currentArg));
+        }
+
+        /**
+         * @brief Assign the values of a value source file to a list argument storage object.
+         *        The file is memory mapped and each line is split on the list delimiter and
+         *        converted in place, no intermediate value string list is built.
+         *
+         * @param currentArg  - Pointer to the argument to set
+         * @param sourcePath  - Value source file path, "-" for standard input
+         * @param valueCount  - Number of values read from the file
+         * @param failedValue - Value string that failed assignment, or "@path" if the file could not be opened
+         * @param lineAction  - Optional action called with each assigned line, the line view is only
+         *                      valid during the call
+         *
+         * @return eAssignmentReturn - Assignment return status
+         */
+        eAssignmentReturn assignFileValues(ArgEntry& currentArg, std::string_view sourcePath, size_t& valueCount, parserstr& failedValue,
+                                           const std::function<void(std::string_view)>& lineAction = nullptr) const;
+
+        //=================================================================================================
+        //======================= Argument validation helper interface methods ============================
+        //=================================================================================================
+        /**
+         * @brief Run the argument validator for each item.  The items are checked in batches of
+         *        validatorBatchSize on a pool of worker threads.
+         *
+         * @param itemList    - Values to validate, the valid flag of each item is set
+         * @param threadCount - Maximum number of threads to use, 0 = hardware concurrency
+         *
+         * @return size_t - Number of items that failed validation
+         */
+        static size_t runValidators(std::vector<validationItem>& itemList, unsigned threadCount);
+
+        /**
+         * @brief Built in path validator, checks that the path exists and is readable by the
+         *        effective user.  The access check is left to the kernel, faccessat().
+         *
+         * @param path - File or directory path
+         *
+         * @return true  - Path exists and is readable
+         * @return false - Path is missing, too long or not readable
+         */
+        static bool isReadablePath(std::string_view path);
+
         //=================================================================================================
         //======================= Help display helper interface methods ===================================
         //=================================================================================================
@@ -283,7 +824,43 @@ class parser_base
          * @param optionWidth     - Maximum width of an option text display before it wraps
          * @param helpWidth       - Maximum width of an help text display before it wraps
          */
-        void displayArgHelpBlock(std::ostream &outStream, parserstr baseOptionText, parserstr baseHelpText, const size_t optionWidth, const size_t helpWidth);
+        void displayArgHelpBlock(std::ostream &outStream, std::string_view baseOptionText, std::string_view baseHelpText, const size_t optionWidth, const size_t helpWidth);
+
+        //=================================================================================================
+        //======================= Memory usage helper interface methods ===================================
+        //=================================================================================================
+        /**
+         * @brief Add the list node, key list and value memory of an argument to a report
+         *
+         * @param arg    - Argument entry
+         * @param report - Report to update
+         */
+        static void addArgMemoryUsage(const ArgEntry& arg, memoryUsageReport& report);
+
+        /**
+         * @brief Get the heap memory held by a shared schema
+         *
+         * @param schema - Shared schema, may be nullptr
+         *
+         * @return heapUsage - Heap bytes and blocks of the schema entries, key lists and values
+         */
+        static heapUsage getSchemaHeapUsage(const argSchema* schema);
+
+        /**
+         * @brief Print the memory usage report category table
+         *
+         * @param outStream - Output stream for the report
+         * @param report    - Report to print
+         */
+        static void displayMemoryUsageReport(std::ostream &outStream, const memoryUsageReport& report);
+
+        /**
+         * @brief Print the key list and value memory of one argument
+         *
+         * @param outStream - Output stream for the report
+         * @param arg       - Argument entry
+         */
+        static void displayArgMemoryUsage(std::ostream &outStream, const ArgEntry& arg);
 };
 
 }; // end of namespace argparser
@@ -132,6 +132,8 @@ class BaseParserStringList
         virtual parserstr getTooManyAssignmentMessage(const parserstr keyString, size_t expected, size_t found) = 0;
         virtual parserstr getMissingArgumentMessage(const parserstr keyString) = 0;
         virtual parserstr getArgumentCreationError(parserstr keyString) = 0;
+        virtual parserstr getValidationFailedMessage(const parserstr keyString, parserstr valueString, int argvIndex) = 0;
+        virtual parserstr getInvalidUtf8Message(const parserstr sourceString, size_t offset) = 0;
 
         // Command line parser specific strings
         [[nodiscard]] virtual parserstr getUsageMessage() const = 0;
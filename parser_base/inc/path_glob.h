@@ -0,0 +1,190 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file path_glob.h
+ * @ingroup argparser
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "pattern_matcher.h"
+
+namespace argparser
+{
+
+/**
+ * @brief Positional argument glob expansion modes
+ */
+enum globMode_e : uint8_t
+{
+    GLOB_DISABLED_e,                    ///< Values are assigned as given
+    GLOB_SORTED_e,                      ///< Expand patterns, matches of each directory in name order
+    GLOB_UNORDERED_e,                   ///< Expand patterns, matches of each directory in directory read order
+};
+
+/**
+ * @brief File path glob pattern expander.
+ *
+ * Each '/' separated pattern component is compiled once with pattern_matcher,
+ * components without glob characters are used as is and a "**" component
+ * matches zero or more directory levels.  Wildcard components do not match
+ * names that start with '.' unless the component does, and "**" does not
+ * descend into hidden directories or follow directory symbolic links.
+ *
+ * The directory tree is walked one level at a time.  The directories of a
+ * level are read in parallel with openat() and getdents64(), then the matches
+ * are passed to the caller level by level, in the order the directories were
+ * found.  The result order only depends on the directory contents, it is the
+ * same for any worker thread count.  Only the entries of a single directory
+ * are ever sorted.
+ */
+class path_glob
+{
+    public:
+        /**
+         * @brief Match callback, return false to stop the expansion
+         *
+         * @param path - Matching path, only valid during the call
+         */
+        using matchFunction = std::function<bool(std::string_view path)>;
+
+    private:
+        /**
+         * @brief Compiled pattern component
+         */
+        struct globSegment
+        {
+            std::string         text;           ///< Component text, escapes removed for literal components
+            pattern_matcher     matcher;        ///< Compiled wildcard component
+            bool                isLiteral;      ///< Component has no glob characters
+            bool                isAnyDepth;     ///< Component is "**"
+            bool                matchHidden;    ///< Component may match names that start with '.'
+        };
+
+        /**
+         * @brief Directory walk work item, a directory and the component to match in it
+         */
+        struct walkNode
+        {
+            std::string         path;           ///< Directory path, empty for the current directory
+            size_t              segmentIndex;   ///< Index of the component to match
+        };
+
+        /**
+         * @brief Result of processing one walk node
+         */
+        struct walkResult
+        {
+            std::vector<std::string>    matches;    ///< Matching paths
+            std::vector<walkNode>       children;   ///< Directories to process in the next level
+        };
+
+        std::string                 rootPath;       ///< Starting directory, empty or "/"
+        std::vector<globSegment>    segmentList;    ///< Compiled pattern components
+        size_t                      anyDepthCount;  ///< Number of "**" components
+        bool                        valid;          ///< Pattern compiled
+
+        /**
+         * @brief Process one directory of the walk
+         *
+         * @param node        - Directory and component to match
+         * @param sortEntries - Sort the directory entries by name
+         * @param result      - Returned matches and next level directories
+         */
+        void processNode(const walkNode& node, bool sortEntries, walkResult& result) const;
+
+        /**
+         * @brief Match one directory entry against a wildcard or literal component
+         *
+         * @param node         - Directory being processed
+         * @param segmentIndex - Index of the component to match
+         * @param name         - Entry name
+         * @param isDirectory  - Entry is, or links to, a directory
+         * @param result       - Returned matches and next level directories
+         */
+        void matchEntry(const walkNode& node, size_t segmentIndex, const std::string& name, bool isDirectory, walkResult& result) const;
+
+    public:
+        /**
+         * @brief Construct an empty pattern expander
+         */
+        path_glob() : anyDepthCount(0), valid(false) {}
+
+        /**
+         * @brief Construct and compile a pattern expander
+         *
+         * @param pattern - Glob pattern to compile
+         */
+        explicit path_glob(std::string_view pattern) : anyDepthCount(0), valid(false)    {compile(pattern);}
+
+        /**
+         * @brief Check if a string has any glob pattern characters
+         *
+         * @param pattern - String to check
+         *
+         * @return true  - String has an unescaped '*', '?' or '['
+         * @return false - String is a plain path
+         */
+        static bool hasGlobChars(std::string_view pattern);
+
+        /**
+         * @brief Compile a new pattern
+         *
+         * @param pattern - Glob pattern to compile
+         *
+         * @return true  - Pattern compiled
+         * @return false - A component is invalid or too long for pattern_matcher
+         */
+        bool compile(std::string_view pattern);
+
+        /**
+         * @brief Check if the last compile() succeeded
+         *
+         * @return bool - True if the pattern compiled
+         */
+        bool isValid() const                                        {return valid;}
+
+        /**
+         * @brief Expand the pattern and pass each matching path to the callback
+         *
+         * @param function    - Match callback, called on the calling thread only
+         * @param sortEntries - True to pass the matches of each directory in name order,
+         *                      false to use the directory read order
+         * @param threadCount - Maximum number of directory reader threads, 0 = hardware concurrency
+         *
+         * @return size_t - Number of matches passed to the callback
+         */
+        size_t expand(const matchFunction& function, bool sortEntries = true, unsigned threadCount = 0) const;
+};
+
+}; // end of namespace argparser
+
+/** @} */
@@ -0,0 +1,120 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file schema_pool.h
+ * @ingroup argparser
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstddef>
+#include <mutex>
+#include <string_view>
+#include "string_pool.h"
+
+namespace argparser
+{
+
+/**
+ * @brief Schema string pool counters
+ */
+struct schemaPoolStats
+{
+    size_t              referencedCount;    ///< Number of strings used in place from read only program storage
+    size_t              referencedBytes;    ///< Total length of the strings used in place
+    stringPoolStats     copied;             ///< Counters of the strings copied into the pool
+};
+
+/**
+ * @brief Storage for the argument registration strings, names, keys, help and
+ *        option text.  Null terminated text in read only program storage, string
+ *        literals, is used in place.  Any other text is copied once into an
+ *        interning string pool, so equal strings share a single copy.
+ *
+ * Text of a shared library that is unloaded while the pool is in use must
+ * not be stored, its in place views would dangle.
+ *
+ * The pool is thread safe, parser copies share one pool and may register
+ * arguments from different threads at the same time.
+ */
+class schema_pool
+{
+    private:
+        string_pool     storage;            ///< Copied strings
+        size_t          referencedCount;    ///< Number of strings used in place
+        size_t          referencedBytes;    ///< Total length of the strings used in place
+        mutable std::mutex counterLock;     ///< Serializes the in place counters, the string pool has its own lock
+
+    public:
+        /**
+         * @brief Construct an empty schema pool
+         */
+        schema_pool() : storage(), referencedCount(0), referencedBytes(0), counterLock() {}
+        schema_pool(const schema_pool& other) = delete;
+        schema_pool& operator=(const schema_pool& other) = delete;
+
+        /**
+         * @brief Get the stored view of a registration string
+         *
+         * @param text - Text to store
+         *
+         * @return std::string_view - Null terminated view of the text, valid for the lifetime of the pool
+         */
+        std::string_view store(std::string_view text);
+
+        /**
+         * @brief Get the pool counters
+         *
+         * @return schemaPoolStats - In place and copied string counters
+         */
+        schemaPoolStats getStats() const
+        {
+            std::lock_guard<std::mutex> guard(counterLock);
+            return {referencedCount, referencedBytes, storage.getStats()};
+        }
+
+        /**
+         * @brief Get the heap memory held by the copied strings, in place strings hold none
+         *
+         * @return heapUsage - Heap bytes and blocks held by the pool
+         */
+        heapUsage getHeapUsage() const          {return storage.getHeapUsage();}
+
+        /**
+         * @brief Check if a memory range lies in a read only segment of the program
+         *        or of a shared library loaded before the first call
+         *
+         * @param data   - Start of the range
+         * @param length - Length of the range in bytes
+         *
+         * @return true  - Range is read only for the life of the program
+         * @return false - Range is writable or could not be checked
+         */
+        static bool isReadOnlyData(const void* data, size_t length);
+};
+
+}; // end of namespace argparser
+
+/** @} */
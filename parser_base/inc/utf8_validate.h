@@ -0,0 +1,67 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file utf8_validate.h
+ * @ingroup argparser
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstddef>
+#include <string_view>
+
+namespace argparser
+{
+
+constexpr size_t utf8Valid = std::string_view::npos;       ///< findInvalidUtf8() return value for a valid buffer
+
+/**
+ * @brief Find the first invalid UTF-8 sequence in a buffer.
+ *
+ * Overlong encodings, surrogates, values above U+10FFFF, stray continuation
+ * bytes and truncated sequences are invalid.  On x86 processors with AVX2 the
+ * buffer is checked 32 bytes at a time with the nibble lookup table method and
+ * the scalar checker only runs to locate an error, other processors use the
+ * scalar checker with an eight byte ASCII fast path.
+ *
+ * @param buffer - Pointer to the buffer, does not need to be null terminated
+ * @param length - Length of the buffer in bytes
+ *
+ * @return size_t - Offset of the first byte of the first invalid sequence, utf8Valid if the buffer is valid
+ */
+size_t findInvalidUtf8(const char* buffer, size_t length);
+
+/**
+ * @brief Check if a string is valid UTF-8
+ *
+ * @param text - String to check
+ *
+ * @return bool - True if the whole string is valid UTF-8
+ */
+inline bool isValidUtf8(std::string_view text)                      {return (utf8Valid == findInvalidUtf8(text.data(), text.size()));}
+
+}; // end of namespace argparser
+
+/** @} */
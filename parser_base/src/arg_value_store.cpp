@@ -0,0 +1,247 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file arg_value_store.cpp
+ * @ingroup argparser
+ * @{
+ */
+
+// Includes
+#include <cstring>
+#include <array>
+#include <string>
+#include <utility>
+#include "arg_value_store.h"
+
+using namespace argparser;
+
+//============================================================================================================================
+//============================================================================================================================
+//  Private functions
+//============================================================================================================================
+//============================================================================================================================
+
+namespace
+{
+
+/**
+ * @brief Type trait to identify the list alternatives of argValue_t
+ */
+template <typename T> struct isValueList : std::false_type {};
+template <typename E> struct isValueList<std::vector<E>> : std::true_type {};
+
+/**
+ * @brief Conversion function for the argValue_t alternative at variant index I
+ *
+ * @param store    - Value store to update
+ * @param newValue - Input character string
+ *
+ * @return valueParseStatus_e - Conversion status
+ */
+template <size_t I> valueParseStatus_e convertAlternative(argValueStore& store, const char* newValue)
+{
+    using valueType = std::variant_alternative_t<I, argValue_t>;
+    valueType& value = *std::get_if<I>(&store.getVariant());
+
+    if constexpr (isValueList<valueType>::value)
+    {
+        typename valueType::value_type element{};
+        valueParseStatus_e status = store.convertElement(newValue, element);
+        if (status == valueParseStatus_e::PARSE_SUCCESS_e)
+        {
+            value.push_back(std::move(element));
+        }
+        return status;
+    }
+    else
+    {
+        valueType element{};
+        valueParseStatus_e status = store.convertElement(newValue, element);
+        if (status == valueParseStatus_e::PARSE_SUCCESS_e)
+        {
+            value = std::move(element);
+        }
+        return status;
+    }
+}
+
+/**
+ * @brief Build the conversion jump table, index 0 (std::monostate) has no conversion
+ *
+ * @return std::array - Conversion function for each variant index
+ */
+template <size_t... I> constexpr std::array<argValueStore::convertFunction, sizeof...(I) + 1> makeConvertTable(std::index_sequence<I...>)
+{
+    return {nullptr, &convertAlternative<I + 1>...};
+}
+
+constexpr auto convertTable = makeConvertTable(std::make_index_sequence<std::variant_size_v<argValue_t> - 1>{});
+
+}; // end of anonymous namespace
+
+/**
+ * @brief Select the conversion function for the current value type
+ */
+void argValueStore::selectConverter()
+{
+    convert = convertTable[value.index()];
+}
+
+//============================================================================================================================
+//============================================================================================================================
+//  Public functions
+//============================================================================================================================
+//============================================================================================================================
+
+/**
+ * @brief Check if the store holds a list value type
+ *
+ * @return true  - List value, multiple argument values are allowed
+ * @return false - Single value type
+ */
+bool argValueStore::isList() const
+{
+    return std::visit([](const auto& currentValue) {return isValueList<std::decay_t<decltype(currentValue)>>::value;}, value);
+}
+
+/**
+ * @brief Check if a list store has no values
+ *
+ * @return true  - List is empty or the store is unused
+ * @return false - Store has a value
+ */
+bool argValueStore::isEmpty() const
+{
+    return std::visit([](const auto& currentValue)
+                      {
+                          using valueType = std::decay_t<decltype(currentValue)>;
+                          if constexpr (isValueList<valueType>::value)
+                          {
+                              return currentValue.empty();
+                          }
+                          else
+                          {
+                              return std::is_same_v<valueType, std::monostate>;
+                          }
+                      }, value);
+}
+
+/**
+ * @brief Set the flag value, only boolean stores support flag assignment
+ *
+ * @return valueParseStatus_e::PARSE_SUCCESS_e       - if the flag value was set
+ * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if the store is not a boolean
+ */
+valueParseStatus_e argValueStore::setValue()
+{
+    bool* flagValue = std::get_if<bool>(&value);
+    if (flagValue == nullptr)
+    {
+        return valueParseStatus_e::PARSE_INVALID_INPUT_e;
+    }
+
+    *flagValue = flagSetValue;
+    return valueParseStatus_e::PARSE_SUCCESS_e;
+}
+
+/**
+ * @brief Assign each value of a delimited value buffer in order
+ *
+ * @param buffer      - Pointer to the delimited value buffer, does not need to be null terminated
+ * @param length      - Length of the value buffer in characters
+ * @param delimiter   - Value list delimiter character
+ * @param failedIndex - Set to the index of the element that failed if the return is not PARSE_SUCCESS_e
+ *
+ * @return valueParseStatus_e::PARSE_SUCCESS_e       - if all of the values were successsfully set
+ * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if an element string could not be translated
+ * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if an element value exceeds lower value limit
+ * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if an element value exceeds upper value limit
+ */
+valueParseStatus_e argValueStore::setValueBuffer(const char* buffer, size_t length, char delimiter, size_t& failedIndex)
+{
+    std::string element;
+    size_t      elementIndex = 0;
+    size_t      startPos     = 0;
+
+    while (startPos < length)
+    {
+        const char* delimiterPtr = static_cast<const char*>(memchr(buffer + startPos, delimiter, length - startPos));
+        size_t      endPos       = ((delimiterPtr != nullptr) ? static_cast<size_t>(delimiterPtr - buffer) : length);
+
+        element.assign(buffer + startPos, endPos - startPos);
+        valueParseStatus_e status = setValue(element.c_str());
+        if (status != valueParseStatus_e::PARSE_SUCCESS_e)
+        {
+            failedIndex = elementIndex;
+            return status;
+        }
+
+        elementIndex++;
+        startPos = endPos + 1;
+    }
+
+    return valueParseStatus_e::PARSE_SUCCESS_e;
+}
+
+/**
+ * @brief Reserve room for additional list values
+ *
+ * @param additionalCount - Number of values about to be added
+ */
+void argValueStore::reserveValues(size_t additionalCount)
+{
+    std::visit([additionalCount](auto& currentValue)
+               {
+                   if constexpr (isValueList<std::decay_t<decltype(currentValue)>>::value)
+                   {
+                       reserveAdditional(currentValue, additionalCount);
+                   }
+               }, value);
+}
+
+/**
+ * @brief Get the heap memory held by the string and list values
+ *
+ * @return heapUsage - Heap bytes and blocks held by the value
+ */
+heapUsage argValueStore::getHeapUsage() const
+{
+    return std::visit([](const auto& currentValue)
+                      {
+                          using valueType = std::decay_t<decltype(currentValue)>;
+                          if constexpr (isValueList<valueType>::value)
+                          {
+                              return getContainerHeapUsage(currentValue);
+                          }
+                          else if constexpr (std::is_same_v<valueType, std::string>)
+                          {
+                              return getStringHeapUsage(currentValue);
+                          }
+                          else
+                          {
+                              return heapUsage{0, 0};
+                          }
+                      }, value);
+}
+
+/** @} */
@@ -0,0 +1,223 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file mapped_file.cpp
+ * @ingroup argparser
+ * @{
+ */
+
+// Includes
+#include <cstring>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "mapped_file.h"
+
+using namespace argparser;
+
+//============================================================================================================================
+//============================================================================================================================
+//  Private functions
+//============================================================================================================================
+//============================================================================================================================
+
+namespace
+{
+
+/**
+ * @brief Pass one line to the callback with any trailing carriage return removed
+ *
+ * @param function - Line callback
+ * @param line     - Pointer to the line
+ * @param length   - Length of the line without the newline
+ *
+ * @return bool - Callback return value
+ */
+bool processLine(const mapped_file::lineFunction& function, const char* line, size_t length)
+{
+    if ((length != 0) && (line[length - 1] == '\r'))
+    {
+        length--;
+    }
+    return function(line, length);
+}
+
+/**
+ * @brief Pass each complete line of a buffer to the callback
+ *
+ * @param function - Line callback
+ * @param buffer   - Pointer to the buffer
+ * @param length   - Length of the buffer
+ * @param consumed - Number of buffer characters processed, the remainder is an incomplete line
+ *
+ * @return bool - False if the callback stopped the scan
+ */
+bool processLines(const mapped_file::lineFunction& function, const char* buffer, size_t length, size_t& consumed)
+{
+    consumed = 0;
+    while (consumed < length)
+    {
+        const char* lineEnd = static_cast<const char*>(memchr(buffer + consumed, '\n', length - consumed));
+        if (lineEnd == nullptr)
+        {
+            break;
+        }
+
+        if (!processLine(function, buffer + consumed, static_cast<size_t>(lineEnd - (buffer + consumed))))
+        {
+            return false;
+        }
+        consumed = static_cast<size_t>(lineEnd - buffer) + 1;
+    }
+    return true;
+}
+
+}; // end of anonymous namespace
+
+//============================================================================================================================
+//============================================================================================================================
+//  Public functions
+//============================================================================================================================
+//============================================================================================================================
+
+/**
+ * @brief Open and map a file
+ *
+ * @param path - File path, "-" selects standard input
+ *
+ * @return true  - File is open
+ * @return false - File could not be opened
+ */
+bool mapped_file::open(const char* path)
+{
+    close();
+    if (strcmp(path, "-") == 0)
+    {
+        fileDescriptor = STDIN_FILENO;
+        ownDescriptor = false;
+        return true;
+    }
+
+    fileDescriptor = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor < 0)
+    {
+        return false;
+    }
+    ownDescriptor = true;
+
+    // Map regular files, anything else is read in blocks
+    struct stat fileStatus;
+    if ((fstat(fileDescriptor, &fileStatus) == 0) && S_ISREG(fileStatus.st_mode) && (fileStatus.st_size > 0))
+    {
+        void* mapping = mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if (mapping != MAP_FAILED)
+        {
+            mappedData = static_cast<const char*>(mapping);
+            mappedSize = static_cast<size_t>(fileStatus.st_size);
+            madvise(mapping, mappedSize, MADV_SEQUENTIAL);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Unmap and close the file
+ */
+void mapped_file::close()
+{
+    if (mappedData != nullptr)
+    {
+        munmap(const_cast<char*>(mappedData), mappedSize);
+        mappedData = nullptr;
+        mappedSize = 0;
+    }
+
+    if (ownDescriptor && (fileDescriptor >= 0))
+    {
+        ::close(fileDescriptor);
+    }
+    fileDescriptor = -1;
+    ownDescriptor = false;
+}
+
+/**
+ * @brief Call a function for each line of the file, lines may end in "\n" or "\r\n"
+ *
+ * @param function - Line callback
+ *
+ * @return true  - All lines were processed
+ * @return false - The callback stopped the scan or a read failed
+ */
+bool mapped_file::forEachLine(const lineFunction& function)
+{
+    size_t consumed = 0;
+    if (mappedData != nullptr)
+    {
+        if (!processLines(function, mappedData, mappedSize, consumed))
+        {
+            return false;
+        }
+        return ((consumed == mappedSize) || processLine(function, mappedData + consumed, mappedSize - consumed));
+    }
+
+    if (fileDescriptor < 0)
+    {
+        return false;
+    }
+
+    // Read in blocks, only an incomplete line is carried over to the next block
+    std::string block;
+    size_t      blockUsed = 0;
+    while (true)
+    {
+        if (block.size() < (blockUsed + readBlockSize))
+        {
+            block.resize(blockUsed + readBlockSize);
+        }
+
+        ssize_t readCount = ::read(fileDescriptor, &block[blockUsed], readBlockSize);
+        if (readCount < 0)
+        {
+            return false;
+        }
+        if (readCount == 0)
+        {
+            break;
+        }
+
+        blockUsed += static_cast<size_t>(readCount);
+        if (!processLines(function, block.data(), blockUsed, consumed))
+        {
+            return false;
+        }
+        block.erase(0, consumed);
+        blockUsed -= consumed;
+    }
+
+    return ((blockUsed == 0) || processLine(function, block.data(), blockUsed));
+}
+
+/** @} */
@@ -0,0 +1,65 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file parse_arena.cpp
+ * @ingroup argparser
+ * @{
+ */
+
+// Includes
+#include "parse_arena.h"
+
+using namespace argparser;
+
+parse_arena::parse_arena(std::pmr::memory_resource* upstreamResource) :
+    upstream(upstreamResource), upstreamBlocks(upstreamResource), allocatedBytes(0)
+{
+    arena.emplace(initialBuffer, sizeof(initialBuffer), &upstreamBlocks);
+}
+
+/**
+ * @brief Allocate a block from the session arena
+ *
+ * @param bytes     - Block size
+ * @param alignment - Block alignment
+ *
+ * @return void* - Pointer to the block
+ */
+void* parse_arena::do_allocate(size_t bytes, size_t alignment)
+{
+    allocatedBytes += bytes;
+    return arena->allocate(bytes, alignment);
+}
+
+/**
+ * @brief Release all of the session memory
+ */
+void parse_arena::reset()
+{
+    // Return the blocks to the resource they came from before switching to a new upstream resource
+    arena->release();
+    upstreamBlocks.upstream = upstream;
+    allocatedBytes = 0;
+}
+
+/** @} */
@@ -28,12 +28,20 @@
  */
 
 // Includes
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
 #include <cstring>
+#include <iomanip>
 #include <string>
 #include "varg_intf.h"
+#include "parallel_work.h"
 #include "varg.h"
 #include "parser_base.h"
 #include "parser_string_list.h"
+#include "mapped_file.h"
+#include "utf8_validate.h"
 
 using namespace argparser;
 
@@ -45,6 +53,92 @@ constexpr size_t DefaultOptionWidth = 0;
 //  Protected functions
 //============================================================================================================================
 //============================================================================================================================
+/**
+ * @brief Check the number of assignment values against the argument nargs value
+ *
+ * @param currentArg - Argument to check
+ * @param valueCount - Number of assignment values
+ *
+ * @return eAssignmentReturn - eAssignSuccess if the count is acceptable, else the count error
+ */
+eAssignmentReturn parser_base::checkValueCount(const ArgEntry& currentArg, size_t valueCount)
+{
+    auto requiredValueCount = static_cast<size_t>(abs(currentArg.nargs));
+
+    if (valueCount == 0)
+    {
+        // Need at least one value
+        return eAssignNoValue;
+    }
+
+    // Check we got too many arguments
+    if ((valueCount > requiredValueCount) && (currentArg.nargs != -1))
+    {
+        return eAssignTooMany;
+    }
+
+    // Check we got too few arguments
+    if (static_cast<int>(valueCount) < currentArg.nargs)
+    {
+        return eAssignTooFew;
+    }
+    return eAssignSuccess;
+}
+
+/**
+ * @brief Assign each value of the list to the argument storage object, no count checks.
+ *
+ * @param currentArg       - Pointer to the argument to set
+ * @param assignmentValues - List of assignment value strings
+ * @param failedValue      - Value string that failed assignment in the list
+ *
+ * @return eAssignmentReturn - Assignment return status
+ */
+eAssignmentReturn parser_base::assignValueList(ArgEntry& currentArg, std::list<parserstr>& assignmentValues, parserstr& failedValue)
+{
+    for (auto const& valueStr : assignmentValues)
+    {
+        if(valueParseStatus_e::PARSE_SUCCESS_e != setArgValue(currentArg, valueStr.c_str()))
+        {
+            failedValue = valueStr;
+            return eAssignFailed;
+        }
+    }
+    return eAssignSuccess;
+}
+
+/**
+ * @brief Assign the values of a delimited value list string, no count checks.
+ *
+ * @param currentArg  - Pointer to the argument to set
+ * @param valueString - Delimited value list string, leading assignment delimiter already stripped
+ * @param failedValue - Value string that failed assignment in the list
+ *
+ * @return eAssignmentReturn - Assignment return status
+ */
+eAssignmentReturn parser_base::assignDelimitedValues(ArgEntry& currentArg, std::string_view valueString, parserstr& failedValue) const
+{
+    size_t failedIndex = 0;
+    if (valueParseStatus_e::PARSE_SUCCESS_e == setArgValueBuffer(currentArg, valueString.data(), valueString.size(), assignmentListDelimeter, failedIndex))
+    {
+        return eAssignSuccess;
+    }
+
+    // Extract the failed element string
+    size_t startPos = 0;
+    for (size_t index = 0; (index < failedIndex) && (startPos != std::string_view::npos); index++)
+    {
+        startPos = valueString.find(assignmentListDelimeter, startPos);
+        startPos = ((startPos != std::string_view::npos) ? startPos + 1 : startPos);
+    }
+
+    if (startPos != std::string_view::npos)
+    {
+        size_t endPos = valueString.find(assignmentListDelimeter, startPos);
+        failedValue = parserstr(valueString.substr(startPos, (endPos != std::string_view::npos) ? (endPos - startPos) : std::string_view::npos));
+    }
+    return eAssignFailed;
+}
 
 
 //============================================================================================================================
@@ -53,9 +147,9 @@ constexpr size_t DefaultOptionWidth = 0;
 //============================================================================================================================
 //============================================================================================================================
 parser_base::parser_base(bool abortOnError, int debugLevel) : 
-    maxColumnWidth(DefaultColumnWidth), maxOptionLength(DefaultOptionWidth),
+    nextSchemaIndex(0), maxColumnWidth(DefaultColumnWidth), maxOptionLength(DefaultOptionWidth),
     keyListDelimeter(','), assignmentDelimeter('='), assignmentListDelimeter(','),
-    errorAbort(abortOnError), debugMsgLevel(debugLevel), parsingError(false),
+    errorAbort(abortOnError), debugMsgLevel(debugLevel), utf8Validation(false), parsingError(false),
     parserStringList(BaseParserStringList::getInternationalizedClass())
 {
     keyArgList.clear();
@@ -63,20 +157,31 @@ parser_base::parser_base(bool abortOnError, int debugLevel) :
 }
 
 parser_base::parser_base(const parser_base& other) :
+    nullEntry(other.nullEntry), sharedSchema(other.getCopySchema()), nextSchemaIndex((sharedSchema != nullptr) ? sharedSchema->entryCount : 0),
     maxColumnWidth(other.assignmentDelimeter), maxOptionLength(other.maxOptionLength),
     keyListDelimeter(other.keyListDelimeter), assignmentDelimeter(other.assignmentDelimeter), assignmentListDelimeter(other.assignmentListDelimeter),
-    errorAbort(other.errorAbort), debugMsgLevel(other.debugMsgLevel), parsingError(false),
-    keyArgList(other.keyArgList), nullEntry(other.nullEntry), parserStringList(other.parserStringList)
+    errorAbort(other.errorAbort), debugMsgLevel(other.debugMsgLevel), utf8Validation(other.utf8Validation), parsingError(false),
+    parserStringList(other.parserStringList),
+    stringPool(other.stringPool), schemaPool(other.schemaPool), ownedArgs(other.ownedArgs),
+    sessionArena(other.sessionArena.getUpstream())
 {
 }
 
 parser_base::parser_base(parser_base&& other) :
+    nullEntry(other.nullEntry), sharedSchema(std::move(other.sharedSchema)), sharedArgCopies(std::move(other.sharedArgCopies)),
+    keyArgList(std::move(other.keyArgList)), positionalArgList(std::move(other.positionalArgList)),
+    nextSchemaIndex(other.nextSchemaIndex), copySchema(std::move(other.copySchema)),
     maxColumnWidth(other.assignmentDelimeter), maxOptionLength(other.maxOptionLength),
     keyListDelimeter(other.keyListDelimeter), assignmentDelimeter(other.assignmentDelimeter), assignmentListDelimeter(other.assignmentListDelimeter),
-    errorAbort(other.errorAbort), debugMsgLevel(other.debugMsgLevel), parsingError(false),
-    keyArgList(other.keyArgList), nullEntry(other.nullEntry), parserStringList(other.parserStringList)
+    errorAbort(other.errorAbort), debugMsgLevel(other.debugMsgLevel), utf8Validation(other.utf8Validation), parsingError(false),
+    parserStringList(other.parserStringList),
+    stringPool(std::move(other.stringPool)), schemaPool(std::move(other.schemaPool)), ownedArgs(std::move(other.ownedArgs)),
+    sessionArena(other.sessionArena.getUpstream())
 {
+    other.sharedArgCopies.clear();
     other.keyArgList.clear();
+    other.positionalArgList.clear();
+    other.nextSchemaIndex = 0;
 }
 
 parser_base& parser_base::operator=(const parser_base& other)
@@ -90,10 +195,20 @@ parser_base& parser_base::operator=(const parser_base& other)
         assignmentListDelimeter = other.assignmentListDelimeter;
         errorAbort              = other.errorAbort;
         debugMsgLevel           = other.debugMsgLevel;
+        utf8Validation          = other.utf8Validation;
         parsingError            = false;
-        keyArgList              = other.keyArgList;
+        sharedSchema            = other.getCopySchema();
+        sharedArgCopies.clear();
+        keyArgList.clear();
+        positionalArgList.clear();
+        nextSchemaIndex         = ((sharedSchema != nullptr) ? sharedSchema->entryCount : 0);
+        copySchema.reset();
         nullEntry               = {};
         parserStringList        = other.parserStringList;
+        stringPool              = other.stringPool;
+        schemaPool              = other.schemaPool;
+        ownedArgs               = other.ownedArgs;
+        sessionArena.setUpstream(other.sessionArena.getUpstream());
     }
     return *this;
 }
@@ -109,12 +224,25 @@ parser_base& parser_base::operator=(parser_base&& other)
         assignmentListDelimeter = other.assignmentListDelimeter;
         errorAbort              = other.errorAbort;
         debugMsgLevel           = other.debugMsgLevel;
+        utf8Validation          = other.utf8Validation;
         parsingError            = false;
-        keyArgList              = other.keyArgList;
+        sharedSchema            = std::move(other.sharedSchema);
+        sharedArgCopies         = std::move(other.sharedArgCopies);
+        keyArgList              = std::move(other.keyArgList);
+        positionalArgList       = std::move(other.positionalArgList);
+        nextSchemaIndex         = other.nextSchemaIndex;
+        copySchema              = std::move(other.copySchema);
         nullEntry               = {};
         parserStringList        = other.parserStringList;
+        stringPool              = std::move(other.stringPool);
+        schemaPool              = std::move(other.schemaPool);
+        ownedArgs               = std::move(other.ownedArgs);
+        sessionArena.setUpstream(other.sessionArena.getUpstream());
 
+        other.sharedArgCopies.clear();
         other.keyArgList.clear();
+        other.positionalArgList.clear();
+        other.nextSchemaIndex = 0;
     }
     return *this;
 }
@@ -130,6 +258,288 @@ parser_base::~parser_base()
 //============================================================================================================================
 //============================================================================================================================
 
+/**
+ * @brief Get the parser string pool, created on the first call
+ *
+ * @return string_pool& - Parser string pool
+ */
+string_pool& parser_base::getStringPool()
+{
+    if (stringPool == nullptr)
+    {
+        stringPool = std::make_shared<string_pool>();
+    }
+    return *stringPool;
+}
+
+/**
+ * @brief Get the parser string pool deduplication counters
+ *
+ * @return stringPoolStats - Intern count, distinct count and byte totals, all zero if the pool is unused
+ */
+stringPoolStats parser_base::getStringPoolStats() const
+{
+    return ((stringPool != nullptr) ? stringPool->getStats() : stringPoolStats{0, 0, 0, 0});
+}
+
+/**
+ * @brief Get the schema pool counters
+ *
+ * @return schemaPoolStats - In place and copied registration string counters, all zero if the pool is unused
+ */
+schemaPoolStats parser_base::getSchemaPoolStats() const
+{
+    return ((schemaPool != nullptr) ? schemaPool->getStats() : schemaPoolStats{0, 0, {0, 0, 0, 0}});
+}
+
+/**
+ * @brief Get the heap memory held by the parser by category
+ *
+ * @return memoryUsageReport - Heap bytes and blocks per category
+ */
+memoryUsageReport parser_base::memoryUsage() const
+{
+    memoryUsageReport report{};
+    for (const ArgEntry& argument : keyArgList)
+    {
+        addArgMemoryUsage(argument, report);
+    }
+    for (const ArgEntry& argument : positionalArgList)
+    {
+        addArgMemoryUsage(argument, report);
+    }
+
+    // Private copies of changed shared entries, single allocations rather than list nodes
+    report.schema += getContainerHeapUsage(sharedArgCopies);
+    for (const auto& argCopy : sharedArgCopies)
+    {
+        if (argCopy != nullptr)
+        {
+            addArgMemoryUsage(*argCopy, report);
+            report.schema.bytes -= (2 * sizeof(void*));
+        }
+    }
+
+    // Shared schema, and the schema built for copies if this parser changed since it was shared
+    report.sharedSchema = getSchemaHeapUsage(sharedSchema.get());
+    {
+        std::lock_guard<std::mutex> guard(copySchemaLock);
+        if (copySchema != sharedSchema)
+        {
+            report.sharedSchema += getSchemaHeapUsage(copySchema.get());
+        }
+    }
+
+    if (parserStringList != nullptr)
+    {
+        report.stringList = {sizeof(*parserStringList), 1};
+    }
+    if (schemaPool != nullptr)
+    {
+        report.schemaStrings = {sizeof(schema_pool), 1};
+        report.schemaStrings += schemaPool->getHeapUsage();
+    }
+    if (stringPool != nullptr)
+    {
+        report.valueStrings = {sizeof(string_pool), 1};
+        report.valueStrings += stringPool->getHeapUsage();
+    }
+    report.values += getContainerHeapUsage(ownedArgs);
+    report.parseBuffers = sessionArena.getHeapUsage();
+    return report;
+}
+
+/**
+ * @brief Print the memory usage report
+ *
+ * @param outStream   - Output stream for the report
+ * @param perArgument - True to add a line for each argument
+ */
+void parser_base::displayMemoryUsage(std::ostream &outStream, bool perArgument) const
+{
+    displayMemoryUsageReport(outStream, memoryUsage());
+    if (perArgument)
+    {
+        for (const ArgEntry& argument : getKeyArgList())
+        {
+            displayArgMemoryUsage(outStream, argument);
+        }
+        for (const ArgEntry& argument : getPositionalArgList())
+        {
+            displayArgMemoryUsage(outStream, argument);
+        }
+    }
+}
+
+/**
+ * @brief Store an argument registration string in the schema pool, created on the first call
+ *
+ * @param text - Name, key list, help or option text
+ *
+ * @return std::string_view - Null terminated view of the stored text
+ */
+std::string_view parser_base::storeSchemaString(std::string_view text)
+{
+    if (schemaPool == nullptr)
+    {
+        schemaPool = std::make_shared<schema_pool>();
+    }
+    return schemaPool->store(text);
+}
+
+/**
+ * @brief Copy a string into the parse session memory
+ *
+ * @param value - String to copy
+ *
+ * @return std::string_view - Null terminated copy, valid until the next parse
+ */
+std::string_view parser_base::storeParseString(std::string_view value)
+{
+    auto* storage = static_cast<parserchar*>(sessionArena.allocate(value.size() + 1, alignof(parserchar)));
+    memcpy(storage, value.data(), value.size());
+    storage[value.size()] = '\0';
+    return std::string_view(storage, value.size());
+}
+
+/**
+ * @brief Take ownership of an argument object
+ *
+ * @param arg - Argument object
+ *
+ * @return varg_intf* - Pointer to the owned argument object
+ */
+varg_intf* parser_base::adoptArgument(std::unique_ptr<varg_intf> arg)
+{
+    ownedArgs.push_back(std::move(arg));
+    return ownedArgs.back().get();
+}
+
+/**
+ * @brief Add a key argument entry to the arguments owned by this parser
+ *
+ * @param entry - Completed key argument entry
+ */
+void parser_base::addKeyArgListEntry(ArgEntry entry)
+{
+    entry.schemaIndex = nextSchemaIndex++;
+    keyArgList.push_back(std::move(entry));
+    copySchema.reset();
+}
+
+/**
+ * @brief Add a positional argument entry to the arguments owned by this parser
+ *
+ * @param entry - Completed positional argument entry
+ */
+void parser_base::addPositionalArgListEntry(ArgEntry entry)
+{
+    entry.schemaIndex = nextSchemaIndex++;
+    positionalArgList.push_back(std::move(entry));
+    copySchema.reset();
+}
+
+/**
+ * @brief Get an argument entry that can be changed.  A shared schema entry is
+ *        copied into the parser on the first change.
+ *
+ * @param arg - Entry from getKeyArgList() or getPositionalArgList()
+ *
+ * @return ArgEntry& - Entry owned by this parser
+ */
+ArgEntry& parser_base::getWritableArg(const ArgEntry& arg)
+{
+    copySchema.reset();
+    if ((sharedSchema == nullptr) || (arg.schemaIndex >= sharedSchema->entryCount))
+    {
+        // Entries added to this parser are owned by the parser
+        return const_cast<ArgEntry&>(arg);
+    }
+
+    if (sharedArgCopies.empty())
+    {
+        sharedArgCopies.resize(sharedSchema->entryCount);
+    }
+
+    std::unique_ptr<ArgEntry>& argCopy = sharedArgCopies[arg.schemaIndex];
+    if (argCopy == nullptr)
+    {
+        argCopy = std::make_unique<ArgEntry>(arg);
+    }
+    return *argCopy;
+}
+
+/**
+ * @brief Get the schema handed to copies of the parser, built from the current
+ *        entries on the first copy after a change
+ *
+ * @return std::shared_ptr<const argSchema> - Shared schema, nullptr if the parser has no arguments
+ */
+std::shared_ptr<const argSchema> parser_base::getCopySchema() const
+{
+    std::lock_guard<std::mutex> guard(copySchemaLock);
+    if (copySchema != nullptr)
+    {
+        return copySchema;
+    }
+
+    // An unchanged copy hands on the schema it shares
+    if (sharedArgCopies.empty() && keyArgList.empty() && positionalArgList.empty())
+    {
+        copySchema = sharedSchema;
+        return copySchema;
+    }
+
+    auto newSchema = std::make_shared<argSchema>();
+    newSchema->entryCount = 0;
+    for (const ArgEntry& keyArg : getKeyArgList())
+    {
+        newSchema->keyArgList.push_back(keyArg);
+        newSchema->keyArgList.back().schemaIndex = newSchema->entryCount++;
+    }
+
+    for (const ArgEntry& positionalArg : getPositionalArgList())
+    {
+        newSchema->positionalArgList.push_back(positionalArg);
+        newSchema->positionalArgList.back().schemaIndex = newSchema->entryCount++;
+    }
+
+    copySchema = std::move(newSchema);
+    return copySchema;
+}
+
+/**
+ * @brief Print the invalid UTF-8 error message
+ *
+ * @param sourceName - Name of the text source, argv index, environment variable or file
+ * @param offset     - Byte offset of the invalid sequence in the source text
+ */
+void parser_base::reportInvalidUtf8(const parserstr& sourceName, size_t offset) const
+{
+    std::cerr << parserStringList->getInvalidUtf8Message(sourceName, offset) << std::endl;
+}
+
+/**
+ * @brief Check that an input string is valid UTF-8, report and flag a parsing error if it is not
+ *
+ * @param text       - Input text
+ * @param sourceName - Name of the text source used in the error message
+ *
+ * @return bool - True if the text is valid
+ */
+bool parser_base::checkUtf8Input(std::string_view text, const parserstr& sourceName)
+{
+    size_t errorPos = findInvalidUtf8(text.data(), text.size());
+    if (errorPos == utf8Valid)
+    {
+        return true;
+    }
+
+    reportInvalidUtf8(sourceName, errorPos);
+    setParsingError(true);
+    return false;
+}
+
 //=================================================================================================
 //======================= Argument add helper interface methods ===================================
 //=================================================================================================
@@ -141,48 +551,32 @@ parser_base::~parser_base()
  * 
  * @return size_t - number of elements in the list
  */
-size_t parser_base::addArgKeyList(ArgEntry& arg, parserstr inputKeyList) const
+size_t parser_base::addArgKeyList(ArgEntry& arg, std::string_view inputKeyList)
 {
-    size_t pos = 0;
-    parserstr inputString = inputKeyList;
-    parserstr token;
-
-    // Erase any leading spaces
-    while (' ' == inputString.front())
-    {
-        inputString.erase(0, 1);
-    }
+    std::string_view inputString = storeSchemaString(inputKeyList);
 
-    // Tokenize based on the delimeter
-    while ((pos = inputString.find(keyListDelimeter)) != parserstr::npos) 
+    // Tokenize based on the delimeter, the keys are views of the stored list
+    while (!inputString.empty())
     {
-        token = inputString.substr(0, pos);
+        size_t pos = inputString.find(keyListDelimeter);
+        std::string_view token = inputString.substr(0, pos);
 
-        // Erase any trailing spaces preceeding the delimeter
-        while (' ' == token.back())
+        // Erase any leading and trailing spaces around the key
+        while (!token.empty() && (' ' == token.front()))
         {
-            token.pop_back();
+            token.remove_prefix(1);
         }
-
-        arg.keyList.push_back(token);
-        inputString.erase(0, pos + 1);
-
-        // Erase any spaces following the delimeter
-        while (' ' == inputString.front())
+        while (!token.empty() && (' ' == token.back()))
         {
-            inputString.erase(0, 1);
+            token.remove_suffix(1);
         }
-    }   
 
-    // Add the last one
-    if (inputString.length() != 0)
-    {
-        // Erase any trailing spaces preceeding the delimeter
-        while (' ' == inputString.back())
+        if ((pos != std::string_view::npos) || !token.empty())
         {
-            inputString.pop_back();
+            arg.keyList.push_back(token);
         }
-        arg.keyList.push_back(inputString);
+
+        inputString.remove_prefix((pos != std::string_view::npos) ? (pos + 1) : inputString.size());
     }
     return arg.keyList.size();
 }
@@ -232,6 +626,65 @@ size_t parser_base::getValueList(parserstr& valueString, std::list<parserstr>& v
     return addedCount;
 }
 
+/**
+ * @brief Count the elements of a delimited value list without splitting it
+ * 
+ * @param valueString - delimited list of value data, leading assignment delimiter is stripped
+ * 
+ * @return size_t - number of elements in the list
+ */
+size_t parser_base::countValueList(parserstr& valueString) const
+{
+    std::string_view valueView(valueString);
+    size_t elementCount = countValueList(valueView);
+    if (valueView.size() != valueString.size())
+    {
+        valueString.erase(0,1);
+    }
+    return elementCount;
+}
+
+/**
+ * @brief Count the elements of a delimited value list view without splitting it
+ * 
+ * @param valueString - delimited list of value data, leading assignment delimiter is stripped
+ * 
+ * @return size_t - number of elements in the list
+ */
+size_t parser_base::countValueList(std::string_view& valueString) const
+{
+    // Strip beginning assignment delimeter if it's present
+    if (!valueString.empty() && (valueString[0] == assignmentDelimeter))
+    {
+        valueString.remove_prefix(1);
+    }
+    return countDelimitedValues(valueString);
+}
+
+/**
+ * @brief Count the elements of a delimited value list as is, a leading
+ *        assignment delimiter is part of the first element
+ * 
+ * @param valueString - delimited list of value data
+ * 
+ * @return size_t - number of elements in the list
+ */
+size_t parser_base::countDelimitedValues(std::string_view valueString) const
+{
+    // Count the delimited elements, a trailing delimiter does not start a new element
+    size_t elementCount = 0;
+    for (size_t pos = 0; pos < valueString.length(); pos++)
+    {
+        pos = valueString.find(assignmentListDelimeter, pos);
+        elementCount++;
+        if (pos == std::string_view::npos)
+        {
+            break;
+        }
+    }
+    return elementCount;
+}
+
 /**
  * @brief Find the argument object that matches the input string
  * 
@@ -240,38 +693,38 @@ size_t parser_base::getValueList(parserstr& valueString, std::list<parserstr>& v
  * 
  * @return ArgEntry - Reference to the ArgEntry from the ArgEntry if match was found. Or nullptr if not.
  */
-ArgEntry& parser_base::findMatchingArg(const parserstr& checkString, bool& found)
+ArgEntry& parser_base::findMatchingArg(std::string_view checkString, bool& found)
 {
     found = false;
 
     if(debugMsgLevel > 4)
     {
-        std::cerr << "keyArgList size: " << keyArgList.size() << std::endl;
+        std::cerr << "keyArgList size: " << getKeyArgList().size() << std::endl;
     }
 
     // Iterate through the key argument list for a match
-    for (auto & argument : keyArgList)
+    for (auto const& argument : getKeyArgList())
     {
         // Check input key string for a match in the argument key string list
-        parserstr testKey = checkString;
         for (auto const& argumentKey : argument.keyList)
         {
             // Check if the input key string matches this argument key list entry
             if(debugMsgLevel > 4)
             {
-                std::cerr << "Testing var: " << argument.name << " test key: " << argumentKey << " input key: " << testKey << std::endl;
-                std::cerr << "Test key size: " << argumentKey.size() << " input key size: " << testKey.size() << std::endl;
+                std::cerr << "Testing var: " << argument.name << " test key: " << argumentKey << " input key: " << checkString << std::endl;
+                std::cerr << "Test key size: " << argumentKey.size() << " input key size: " << checkString.size() << std::endl;
             }
-            if (argumentKey == testKey)
+            if (argumentKey == checkString)
             {
                 // Found a match
                 if(debugMsgLevel > 3) 
                 {
                     std::cerr << "Found match var: " << argument.name << " key: " << argumentKey << std::endl;
                 }
-                argument.isFound = true;
+                ArgEntry& matchingArg = getWritableArg(argument);
+                matchingArg.isFound = true;
                 found = true;
-                return (argument);
+                return (matchingArg);
             }
         }
     }
@@ -288,7 +741,7 @@ ArgEntry& parser_base::findMatchingArg(const parserstr& checkString, bool& found
  */
 eAssignmentReturn parser_base::assignKeyFlagValue(ArgEntry& currentArg)
 {
-    return ((valueParseStatus_e::PARSE_SUCCESS_e == currentArg.argData->setValue()) ? eAssignSuccess : eAssignFailed);
+    return ((valueParseStatus_e::PARSE_SUCCESS_e == setArgFlagValue(currentArg)) ? eAssignSuccess : eAssignFailed);
 }
 
 /**
@@ -301,8 +754,21 @@ eAssignmentReturn parser_base::assignKeyFlagValue(ArgEntry& currentArg)
  */
 eAssignmentReturn parser_base::assignKeyValue(ArgEntry& currentArg, parserstr& assignmentValue)
 {
-    return ((assignmentValue.empty()) ? eAssignNoValue : 
-                ((valueParseStatus_e::PARSE_SUCCESS_e == currentArg.argData->setValue(assignmentValue.c_str())) ? eAssignSuccess : eAssignFailed));
+    return assignKeyValue(currentArg, assignmentValue.c_str());
+}
+
+/**
+ * @brief Assign single value to an argument storage object from a null terminated value buffer
+ * 
+ * @param currentArg      - Pointer to the argument to set
+ * @param assignmentValue - Null terminated value string, must stay valid for the parse session
+ * 
+ * @return eAssignmentReturn - Assignment return status
+ */
+eAssignmentReturn parser_base::assignKeyValue(ArgEntry& currentArg, const char* assignmentValue)
+{
+    return ((assignmentValue[0] == '\0') ? eAssignNoValue : 
+                ((valueParseStatus_e::PARSE_SUCCESS_e == setArgValue(currentArg, assignmentValue)) ? eAssignSuccess : eAssignFailed));
 }
 
 /**
@@ -316,37 +782,200 @@ eAssignmentReturn parser_base::assignKeyValue(ArgEntry& currentArg, parserstr& a
  */
 eAssignmentReturn parser_base::assignListKeyValue(ArgEntry& currentArg, std::list<parserstr>& assignmentValues, parserstr& failedValue)
 {
-    auto requiredValueCount = abs(currentArg.nargs);
-
-    if (assignmentValues.empty())
+    eAssignmentReturn status = checkValueCount(currentArg, assignmentValues.size());
+    if (eAssignSuccess == status)
     {
-        // Need at least one value
-        return eAssignNoValue;
+        reserveArgValues(currentArg, assignmentValues.size());
+        status = assignValueList(currentArg, assignmentValues, failedValue);
     }
+    return status;
+}
 
-    // Check we got too many arguments
-    if ((assignmentValues.size() > requiredValueCount) && (currentArg.nargs != -1))
+/**
+ * @brief Assign all of the values of a delimited value list to a list argument storage
+ *        object without splitting the list into seperate strings.
+ * 
+ * @param currentArg  - Pointer to the argument to set
+ * @param valueString - Delimited value list string, leading assignment delimiter already stripped
+ * @param valueCount  - Number of elements to check and reserve storage for
+ * @param failedValue - Value string that failed assignment in the list
+ * 
+ * @return eAssignmentReturn - Assignment return status
+ */
+eAssignmentReturn parser_base::assignDelimitedKeyValue(ArgEntry& currentArg, std::string_view valueString, size_t valueCount, parserstr& failedValue) const
+{
+    eAssignmentReturn status = checkValueCount(currentArg, valueCount);
+    if (eAssignSuccess == status)
     {
-        return eAssignTooMany;
+        reserveArgValues(currentArg, valueCount);
+        status = assignDelimitedValues(currentArg, valueString, failedValue);
     }
+    return status;
+}
 
-    // Check we got too few arguments
-    if (static_cast<int>(assignmentValues.size()) < currentArg.nargs)
+/**
+ * @brief Assign the values of a value source file to a list argument storage object.
+ *        The file is memory mapped and each line is split on the list delimiter and
+ *        converted in place, no intermediate value string list is built.
+ * 
+ * @param currentArg  - Pointer to the argument to set
+ * @param sourcePath  - Value source file path, "-" for standard input
+ * @param valueCount  - Number of values read from the file
+ * @param failedValue - Value string that failed assignment, or "@path" if the file could not be opened
+ * @param lineAction  - Optional action called with each assigned line, the line view is only
+ *                      valid during the call
+ * 
+ * @return eAssignmentReturn - Assignment return status
+ */
+eAssignmentReturn parser_base::assignFileValues(ArgEntry& currentArg, std::string_view sourcePath, size_t& valueCount, parserstr& failedValue,
+                                                const std::function<void(std::string_view)>& lineAction) const
+{
+    mapped_file sourceFile;
+    parserstr   sourcePathString(sourcePath);
+    valueCount = 0;
+    if (!sourceFile.open(sourcePathString.c_str()))
     {
-        return eAssignTooFew;
+        failedValue = fileSourcePrefix + sourcePathString;
+        return eAssignFailed;
     }
 
-    // Assign the values
-    for (auto const& valueStr : assignmentValues)
+    // A mapped file is checked in one pass, a file read in blocks one line at a time
+    size_t lineNumber = 0;
+    bool   lineUtf8Check = (utf8Validation && !sourceFile.isMapped());
+    if (utf8Validation && sourceFile.isMapped())
     {
-        if(valueParseStatus_e::PARSE_SUCCESS_e != currentArg.argData->setValue(valueStr.c_str()))
+        size_t errorPos = findInvalidUtf8(sourceFile.data(), sourceFile.size());
+        if (errorPos != utf8Valid)
         {
-            failedValue = valueStr;
+            std::string_view validData(sourceFile.data(), errorPos);
+            size_t lineStart = validData.rfind('\n');
+            lineStart = ((lineStart != std::string_view::npos) ? (lineStart + 1) : 0);
+            lineNumber = 1 + static_cast<size_t>(std::count(validData.begin(), validData.end(), '\n'));
+            reportInvalidUtf8(sourcePathString + ":" + std::to_string(lineNumber), errorPos - lineStart);
+            failedValue = fileSourcePrefix + sourcePathString;
             return eAssignFailed;
         }
     }
 
-    return eAssignSuccess;
+    // Count the values before any assignment so a bad value count leaves the argument
+    // unchanged.  Streamed input can only be read once, keep its lines for the assignment pass.
+    const bool streamed = !sourceFile.isMapped();
+    parserstr  streamLines;
+    eAssignmentReturn status = eAssignSuccess;
+    bool readComplete = sourceFile.forEachLine([&](const char* line, size_t length)
+                                               {
+                                                   lineNumber++;
+                                                   size_t errorPos = (lineUtf8Check ? findInvalidUtf8(line, length) : utf8Valid);
+                                                   if (errorPos != utf8Valid)
+                                                   {
+                                                       reportInvalidUtf8(sourcePathString + ":" + std::to_string(lineNumber), errorPos);
+                                                       failedValue = fileSourcePrefix + sourcePathString;
+                                                       status = eAssignFailed;
+                                                       return false;
+                                                   }
+                                                   valueCount += countDelimitedValues(std::string_view(line, length));
+                                                   if (streamed)
+                                                   {
+                                                       streamLines.append(line, length);
+                                                       streamLines.push_back('\n');
+                                                   }
+                                                   return true;
+                                               });
+
+    if ((eAssignSuccess == status) && !readComplete)
+    {
+        failedValue = fileSourcePrefix + sourcePathString;
+        status = eAssignFailed;
+    }
+    if (eAssignSuccess == status)
+    {
+        status = checkValueCount(currentArg, valueCount);
+    }
+    if (eAssignSuccess != status)
+    {
+        return status;
+    }
+
+    // Assign each line in order
+    reserveArgValues(currentArg, valueCount);
+    auto assignLine = [&](const char* line, size_t length)
+                      {
+                          if (length != 0)
+                          {
+                              status = assignDelimitedValues(currentArg, std::string_view(line, length), failedValue);
+                              if ((eAssignSuccess == status) && lineAction)
+                              {
+                                  lineAction(std::string_view(line, length));
+                              }
+                          }
+                          return (eAssignSuccess == status);
+                      };
+
+    if (streamed)
+    {
+        size_t lineStart = 0;
+        while ((lineStart < streamLines.size()) && (eAssignSuccess == status))
+        {
+            size_t lineEnd = streamLines.find('\n', lineStart);
+            assignLine(streamLines.data() + lineStart, lineEnd - lineStart);
+            lineStart = lineEnd + 1;
+        }
+    }
+    else
+    {
+        sourceFile.forEachLine(assignLine);
+    }
+    return status;
+}
+
+//=================================================================================================
+//======================= Argument validation helper interface methods ============================
+//=================================================================================================
+/**
+ * @brief Run the argument validator for each item in batches on a pool of worker threads
+ *
+ * @param itemList    - Values to validate, the valid flag of each item is set
+ * @param threadCount - Maximum number of threads to use, 0 = hardware concurrency
+ *
+ * @return size_t - Number of items that failed validation
+ */
+size_t parser_base::runValidators(std::vector<validationItem>& itemList, unsigned threadCount)
+{
+    const size_t batchCount = (itemList.size() + validatorBatchSize - 1) / validatorBatchSize;
+    runParallel(batchCount, threadCount, [&itemList](size_t batchIndex)
+                {
+                    const size_t endIndex = std::min(itemList.size(), (batchIndex + 1) * validatorBatchSize);
+                    for (size_t itemIndex = batchIndex * validatorBatchSize; itemIndex < endIndex; itemIndex++)
+                    {
+                        validationItem& currentItem = itemList[itemIndex];
+                        currentItem.valid = currentItem.arg->validator(currentItem.value);
+                    }
+                });
+
+    return static_cast<size_t>(std::count_if(itemList.begin(), itemList.end(), [](const validationItem& currentItem) {return !currentItem.valid;}));
+}
+
+/**
+ * @brief Built in path validator, checks that the path exists and is readable
+ *
+ * @param path - File or directory path
+ *
+ * @return true  - Path exists and is readable
+ * @return false - Path is missing, too long or not readable
+ */
+bool parser_base::isReadablePath(std::string_view path)
+{
+    constexpr size_t maxPathLength = 4096;
+    char pathBuffer[maxPathLength];
+    if (path.empty() || (path.size() >= maxPathLength))
+    {
+        return false;
+    }
+    memcpy(pathBuffer, path.data(), path.size());
+    pathBuffer[path.size()] = '\0';
+
+    // The kernel decides, it applies ACLs, capabilities and root squashing of network mounts
+    return (0 == faccessat(AT_FDCWD, pathBuffer, R_OK, AT_EACCESS));
 }
 
 //=================================================================================================
@@ -364,11 +993,11 @@ eAssignmentReturn parser_base::assignListKeyValue(ArgEntry& currentArg, std::lis
  * @param optionWidth     - Maximum width of an option text display before it wraps
  * @param helpWidth       - Maximum width of an help text display before it wraps
  */
-void parser_base::displayArgHelpBlock(std::ostream &outStream, parserstr baseOptionText, parserstr baseHelpText, const size_t optionWidth, const size_t helpWidth)
+void parser_base::displayArgHelpBlock(std::ostream &outStream, std::string_view baseOptionText, std::string_view baseHelpText, const size_t optionWidth, const size_t helpWidth)
 {
     // Format the columns
-    std::list<parserstr> helpTextList = parserStringList->formatStringToLength(baseHelpText, parserStringList->getDefaultBreakCharList(), helpWidth);
-    std::list<parserstr> optionTextList = parserStringList->formatStringToLength(baseOptionText, {'<',' '}, optionWidth);
+    std::list<parserstr> helpTextList = parserStringList->formatStringToLength(parserstr(baseHelpText), parserStringList->getDefaultBreakCharList(), helpWidth);
+    std::list<parserstr> optionTextList = parserStringList->formatStringToLength(parserstr(baseOptionText), {'<',' '}, optionWidth);
 
     // Output the column text
     while ((!helpTextList.empty()) || (!optionTextList.empty()))
@@ -400,4 +1029,92 @@ void parser_base::displayArgHelpBlock(std::ostream &outStream, parserstr baseOpt
     }
 }
 
+//=================================================================================================
+//======================= Memory usage helper interface methods ===================================
+//=================================================================================================
+
+/**
+ * @brief Add the list node, key list and value memory of an argument to a report
+ *
+ * @param arg    - Argument entry
+ * @param report - Report to update
+ */
+void parser_base::addArgMemoryUsage(const ArgEntry& arg, memoryUsageReport& report)
+{
+    report.schema += heapUsage{sizeof(ArgEntry) + (2 * sizeof(void*)), 1};
+    report.keyLists += getContainerHeapUsage(arg.keyList);
+    report.values += ((arg.argData != nullptr) ? arg.argData->getHeapUsage() : arg.valueStore.getHeapUsage());
+    report.values += arg.binding.getHeapUsage();
+}
+
+/**
+ * @brief Get the heap memory held by a shared schema
+ *
+ * @param schema - Shared schema, may be nullptr
+ *
+ * @return heapUsage - Heap bytes and blocks of the schema entries, key lists and values
+ */
+heapUsage parser_base::getSchemaHeapUsage(const argSchema* schema)
+{
+    if (schema == nullptr)
+    {
+        return heapUsage{0, 0};
+    }
+
+    memoryUsageReport schemaReport{};
+    schemaReport.schema = {sizeof(argSchema), 1};
+    for (const std::list<ArgEntry>* argList : {&schema->keyArgList, &schema->positionalArgList})
+    {
+        for (const ArgEntry& argument : *argList)
+        {
+            addArgMemoryUsage(argument, schemaReport);
+        }
+    }
+    return schemaReport.getTotal();
+}
+
+/**
+ * @brief Print the memory usage report category table
+ *
+ * @param outStream - Output stream for the report
+ * @param report    - Report to print
+ */
+void parser_base::displayMemoryUsageReport(std::ostream &outStream, const memoryUsageReport& report)
+{
+    const std::pair<const char*, heapUsage> categoryList[] = {{"schema", report.schema},
+                                                               {"shared schema", report.sharedSchema},
+                                                               {"key lists", report.keyLists},
+                                                               {"schema strings", report.schemaStrings},
+                                                               {"string list", report.stringList},
+                                                               {"values", report.values},
+                                                               {"value strings", report.valueStrings},
+                                                               {"parse buffers", report.parseBuffers},
+                                                               {"total", report.getTotal()}};
+
+    outStream << std::left << std::setw(20) << "category" << std::right << std::setw(12) << "bytes" << std::setw(14) << "allocations" << std::endl;
+    for (const auto& category : categoryList)
+    {
+        outStream << std::left << std::setw(20) << category.first
+                  << std::right << std::setw(12) << category.second.bytes
+                  << std::setw(14) << category.second.allocations << std::endl;
+    }
+}
+
+/**
+ * @brief Print the key list and value memory of one argument
+ *
+ * @param outStream - Output stream for the report
+ * @param arg       - Argument entry
+ */
+void parser_base::displayArgMemoryUsage(std::ostream &outStream, const ArgEntry& arg)
+{
+    const heapUsage keyUsage = getContainerHeapUsage(arg.keyList);
+    heapUsage valueUsage = ((arg.argData != nullptr) ? arg.argData->getHeapUsage() : arg.valueStore.getHeapUsage());
+    valueUsage += arg.binding.getHeapUsage();
+
+    outStream << "  " << std::left << std::setw(18) << arg.name
+              << std::right << " keys " << keyUsage.bytes << "/" << keyUsage.allocations
+              << " values " << valueUsage.bytes << "/" << valueUsage.allocations << std::endl;
+}
+
 /** @} */
@@ -79,6 +79,12 @@ class BaseParserStringListEnglish : public BaseParserStringList
         parserstr getArgumentCreationError(parserstr keyString) override
         {parser_str_stream parserstr;  parserstr << "Argument add failed: " << keyString; return parserstr.str();}
 
+        parserstr getValidationFailedMessage(const parserstr keyString, parserstr valueString, int argvIndex) override
+        {parser_str_stream parserstr;  parserstr << "argv[" << argvIndex << "] \"" << keyString << " " << valueString << "\" validation failed"; return parserstr.str();}
+
+        parserstr getInvalidUtf8Message(const parserstr sourceString, size_t offset) override
+        {parser_str_stream parserstr;  parserstr << "\"" << sourceString << "\" invalid UTF-8 at byte " << offset; return parserstr.str();}
+
         [[nodiscard]] parserstr getUsageMessage() const override
         {return "Usage:";}
 
@@ -133,6 +139,12 @@ class BaseParserStringListSpanish : public BaseParserStringList
         parserstr getArgumentCreationError(parserstr keyString) override
         {parser_str_stream parserstr;  parserstr << "No se pudo agregar el argumento: " << keyString; return parserstr.str();}
 
+        parserstr getValidationFailedMessage(const parserstr keyString, parserstr valueString, int argvIndex) override
+        {parser_str_stream parserstr;  parserstr << "argv[" << argvIndex << "] \"" << keyString << " " << valueString << "\" validación fallida"; return parserstr.str();}
+
+        parserstr getInvalidUtf8Message(const parserstr sourceString, size_t offset) override
+        {parser_str_stream parserstr;  parserstr << "\"" << sourceString << "\" UTF-8 no válido en el byte " << offset; return parserstr.str();}
+
         [[nodiscard]] parserstr getUsageMessage() const override
         {return "Uso:";}
 
@@ -187,6 +199,12 @@ class BaseParserStringListFrench : public BaseParserStringList
         parserstr getArgumentCreationError(parserstr keyString) override
         {parser_str_stream parserstr;  parserstr << "Échec de l'ajout d'arguments:" << keyString; return parserstr.str();}
 
+        parserstr getValidationFailedMessage(const parserstr keyString, parserstr valueString, int argvIndex) override
+        {parser_str_stream parserstr;  parserstr << "argv[" << argvIndex << "] \"" << keyString << " " << valueString << "\" la validation a échoué"; return parserstr.str();}
+
+        parserstr getInvalidUtf8Message(const parserstr sourceString, size_t offset) override
+        {parser_str_stream parserstr;  parserstr << "\"" << sourceString << "\" UTF-8 non valide à l'octet " << offset; return parserstr.str();}
+
         [[nodiscard]] parserstr getUsageMessage() const override
         {return "Usage:";}
 
@@ -241,6 +259,12 @@ class BaseParserStringListChineseSimplified : public BaseParserStringList
         parserstr getArgumentCreationError(parserstr keyString) override
         {parser_str_stream parserstr;  parserstr << "参数添加失败： " << keyString; return parserstr.str();}
 
+        parserstr getValidationFailedMessage(const parserstr keyString, parserstr valueString, int argvIndex) override
+        {parser_str_stream parserstr;  parserstr << "argv[" << argvIndex << "] \"" << keyString << " " << valueString << "\" 验证失败"; return parserstr.str();}
+
+        parserstr getInvalidUtf8Message(const parserstr sourceString, size_t offset) override
+        {parser_str_stream parserstr;  parserstr << "\"" << sourceString << "\" 第 " << offset << " 字节处的 UTF-8 无效"; return parserstr.str();}
+
         [[nodiscard]] parserstr getUsageMessage() const override
         {return "用法：";}
 
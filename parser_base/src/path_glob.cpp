@@ -0,0 +1,446 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file path_glob.cpp
+ * @ingroup argparser
+ * @{
+ */
+
+// Includes
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <unordered_set>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "parallel_work.h"
+#include "path_glob.h"
+
+using namespace argparser;
+
+//============================================================================================================================
+//============================================================================================================================
+//  Private functions
+//============================================================================================================================
+//============================================================================================================================
+
+namespace
+{
+
+constexpr size_t directoryBufferSize = 32 * 1024;      ///< Directory entry read buffer size
+
+/**
+ * @brief Directory entry read from a walk directory
+ */
+struct directoryEntry
+{
+    std::string     name;               ///< Entry name
+    bool            isDirectory;        ///< Entry is a directory, not a symbolic link to one
+    bool            linksToDirectory;   ///< Entry is a directory or a symbolic link to one
+};
+
+#if defined(SYS_getdents64)
+/**
+ * @brief getdents64() record layout
+ */
+struct linuxDirent64
+{
+    uint64_t        d_ino;              ///< Inode number
+    int64_t         d_off;              ///< Offset to the next record
+    unsigned short  d_reclen;           ///< Length of this record
+    unsigned char   d_type;             ///< File type
+    char            d_name[1];          ///< Null terminated file name
+};
+#endif
+
+/**
+ * @brief Append a path component to a directory path
+ *
+ * @param directory - Directory path, empty for the current directory
+ * @param name      - Component to append
+ *
+ * @return std::string - Joined path
+ */
+std::string joinPath(const std::string& directory, std::string_view name)
+{
+    std::string path;
+    path.reserve(directory.size() + name.size() + 1);
+    path = directory;
+    if (!path.empty() && (path.back() != '/'))
+    {
+        path += '/';
+    }
+    path += name;
+    return path;
+}
+
+/**
+ * @brief Classify a directory entry and add it to the entry list
+ *
+ * @param directoryFd - Open directory descriptor
+ * @param name        - Entry name
+ * @param type        - Entry d_type value
+ * @param entryList   - Entry list to update
+ */
+void addEntry(int directoryFd, const char* name, unsigned char type, std::vector<directoryEntry>& entryList)
+{
+    if ((name[0] == '.') && ((name[1] == '\0') || ((name[1] == '.') && (name[2] == '\0'))))
+    {
+        return;
+    }
+
+    bool isDirectory = (type == DT_DIR);
+    bool isLink = (type == DT_LNK);
+    struct stat entryStatus;
+    if ((type == DT_UNKNOWN) && (0 == fstatat(directoryFd, name, &entryStatus, AT_SYMLINK_NOFOLLOW)))
+    {
+        isDirectory = S_ISDIR(entryStatus.st_mode);
+        isLink = S_ISLNK(entryStatus.st_mode);
+    }
+
+    bool linksToDirectory = isDirectory;
+    if (isLink && (0 == fstatat(directoryFd, name, &entryStatus, 0)))
+    {
+        linksToDirectory = S_ISDIR(entryStatus.st_mode);
+    }
+    entryList.push_back({name, isDirectory, linksToDirectory});
+}
+
+/**
+ * @brief Read all of the entries of a directory
+ *
+ * @param path      - Directory path, empty for the current directory
+ * @param entryList - Returned entries, in directory read order
+ *
+ * @return bool - False if the directory could not be opened
+ */
+bool readDirectory(const std::string& path, std::vector<directoryEntry>& entryList)
+{
+    int directoryFd = openat(AT_FDCWD, (path.empty() ? "." : path.c_str()), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (directoryFd < 0)
+    {
+        return false;
+    }
+
+#if defined(SYS_getdents64)
+    alignas(linuxDirent64) char buffer[directoryBufferSize];
+    for (long readSize = syscall(SYS_getdents64, directoryFd, buffer, sizeof(buffer));
+         readSize > 0;
+         readSize = syscall(SYS_getdents64, directoryFd, buffer, sizeof(buffer)))
+    {
+        for (long offset = 0; offset < readSize; )
+        {
+            const auto* record = reinterpret_cast<const linuxDirent64*>(buffer + offset);
+            addEntry(directoryFd, record->d_name, record->d_type, entryList);
+            offset += record->d_reclen;
+        }
+    }
+    close(directoryFd);
+#else
+    DIR* directory = fdopendir(directoryFd);
+    if (directory == nullptr)
+    {
+        close(directoryFd);
+        return false;
+    }
+    for (struct dirent* record = readdir(directory); record != nullptr; record = readdir(directory))
+    {
+        addEntry(dirfd(directory), record->d_name, record->d_type, entryList);
+    }
+    closedir(directory);
+#endif
+    return true;
+}
+
+}; // end of anonymous namespace
+
+/**
+ * @brief Match one directory entry against a wildcard or literal component
+ *
+ * @param node         - Directory being processed
+ * @param segmentIndex - Index of the component to match
+ * @param name         - Entry name
+ * @param isDirectory  - Entry is, or links to, a directory
+ * @param result       - Returned matches and next level directories
+ */
+void path_glob::matchEntry(const walkNode& node, size_t segmentIndex, const std::string& name, bool isDirectory, walkResult& result) const
+{
+    const globSegment& segment = segmentList[segmentIndex];
+    const bool matched = (segment.isLiteral ?
+                            (name == segment.text) :
+                            ((segment.matchHidden || (name[0] != '.')) && segment.matcher.match(name)));
+    if (!matched)
+    {
+        return;
+    }
+
+    if ((segmentIndex + 1) == segmentList.size())
+    {
+        result.matches.push_back(joinPath(node.path, name));
+    }
+    else if (isDirectory)
+    {
+        result.children.push_back({joinPath(node.path, name), segmentIndex + 1});
+    }
+}
+
+/**
+ * @brief Process one directory of the walk
+ *
+ * @param node        - Directory and component to match
+ * @param sortEntries - Sort the directory entries by name
+ * @param result      - Returned matches and next level directories
+ */
+void path_glob::processNode(const walkNode& node, bool sortEntries, walkResult& result) const
+{
+    const globSegment& segment = segmentList[node.segmentIndex];
+    if (segment.isLiteral)
+    {
+        // Literal components do not need a directory read
+        std::string path = joinPath(node.path, segment.text);
+        struct stat pathStatus;
+        if ((node.segmentIndex + 1) != segmentList.size())
+        {
+            result.children.push_back({std::move(path), node.segmentIndex + 1});
+        }
+        else if (0 == fstatat(AT_FDCWD, path.c_str(), &pathStatus, 0))
+        {
+            result.matches.push_back(std::move(path));
+        }
+        return;
+    }
+
+    std::vector<directoryEntry> entryList;
+    if (!readDirectory(node.path, entryList))
+    {
+        return;
+    }
+    if (sortEntries)
+    {
+        std::sort(entryList.begin(), entryList.end(), [](const directoryEntry& left, const directoryEntry& right) {return left.name < right.name;});
+    }
+
+    for (auto const& entry : entryList)
+    {
+        if (segment.isAnyDepth)
+        {
+            // "**" matches zero levels here and descends into each visible sub directory
+            matchEntry(node, node.segmentIndex + 1, entry.name, entry.linksToDirectory, result);
+            if (entry.isDirectory && (entry.name[0] != '.'))
+            {
+                result.children.push_back({joinPath(node.path, entry.name), node.segmentIndex});
+            }
+        }
+        else
+        {
+            matchEntry(node, node.segmentIndex, entry.name, entry.linksToDirectory, result);
+        }
+    }
+}
+
+//============================================================================================================================
+//============================================================================================================================
+//  Public functions
+//============================================================================================================================
+//============================================================================================================================
+
+/**
+ * @brief Check if a string has any glob pattern characters
+ *
+ * @param pattern - String to check
+ *
+ * @return true  - String has an unescaped '*', '?' or '['
+ * @return false - String is a plain path
+ */
+bool path_glob::hasGlobChars(std::string_view pattern)
+{
+    for (size_t index = 0; index < pattern.size(); index++)
+    {
+        switch (pattern[index])
+        {
+            case '\\':
+                index++;
+                break;
+
+            case '*':
+            case '?':
+            case '[':
+                return true;
+
+            default:
+                break;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Compile a new pattern
+ *
+ * @param pattern - Glob pattern to compile
+ *
+ * @return true  - Pattern compiled
+ * @return false - A component is invalid or too long for pattern_matcher
+ */
+bool path_glob::compile(std::string_view pattern)
+{
+    valid = false;
+    anyDepthCount = 0;
+    segmentList.clear();
+    rootPath = ((!pattern.empty() && (pattern[0] == '/')) ? "/" : "");
+
+    size_t startPos = 0;
+    while (startPos < pattern.size())
+    {
+        size_t endPos = pattern.find('/', startPos);
+        if (endPos == std::string_view::npos)
+        {
+            endPos = pattern.size();
+        }
+        std::string_view component = pattern.substr(startPos, endPos - startPos);
+        startPos = endPos + 1;
+        if (component.empty())
+        {
+            continue;
+        }
+
+        globSegment newSegment = {};
+        if (component == "**")
+        {
+            // Consecutive "**" components are the same as one
+            if (!segmentList.empty() && segmentList.back().isAnyDepth)
+            {
+                continue;
+            }
+            newSegment.isAnyDepth = true;
+            anyDepthCount++;
+        }
+        else if (hasGlobChars(component))
+        {
+            if (!newSegment.matcher.compile(component, PATTERN_GLOB_e))
+            {
+                return false;
+            }
+            newSegment.matchHidden = (component[0] == '.');
+        }
+        else
+        {
+            newSegment.isLiteral = true;
+            for (size_t index = 0; index < component.size(); index++)
+            {
+                if ((component[index] == '\\') && ((index + 1) < component.size()))
+                {
+                    index++;
+                }
+                newSegment.text += component[index];
+            }
+        }
+        segmentList.push_back(std::move(newSegment));
+    }
+
+    if (segmentList.empty())
+    {
+        return false;
+    }
+
+    // A trailing "**" matches every entry below the directory
+    if (segmentList.back().isAnyDepth)
+    {
+        globSegment anySegment = {};
+        anySegment.matcher.compile("*", PATTERN_GLOB_e);
+        segmentList.push_back(std::move(anySegment));
+    }
+
+    valid = true;
+    return true;
+}
+
+/**
+ * @brief Expand the pattern and pass each matching path to the callback
+ *
+ * @param function    - Match callback, called on the calling thread only
+ * @param sortEntries - True to pass the matches of each directory in name order,
+ *                      false to use the directory read order
+ * @param threadCount - Maximum number of directory reader threads, 0 = hardware concurrency
+ *
+ * @return size_t - Number of matches passed to the callback
+ */
+size_t path_glob::expand(const matchFunction& function, bool sortEntries, unsigned threadCount) const
+{
+    size_t matchCount = 0;
+    if (!valid)
+    {
+        return matchCount;
+    }
+
+    // Every node of a level is the same depth below the root, so repeats
+    // reached through different "**" components are always in the same level
+    const bool removeRepeats = (anyDepthCount > 1);
+    std::unordered_set<std::string> levelMatches;
+    std::unordered_set<std::string> levelNodes;
+
+    std::vector<walkNode> currentLevel = {{rootPath, 0}};
+    while (!currentLevel.empty())
+    {
+        std::vector<walkResult> resultList(currentLevel.size());
+        runParallel(currentLevel.size(), threadCount, [&](size_t nodeIndex)
+                                                      {
+                                                          processNode(currentLevel[nodeIndex], sortEntries, resultList[nodeIndex]);
+                                                      });
+
+        std::vector<walkNode> nextLevel;
+        levelMatches.clear();
+        levelNodes.clear();
+        for (auto& result : resultList)
+        {
+            for (auto const& match : result.matches)
+            {
+                if (removeRepeats && !levelMatches.insert(match).second)
+                {
+                    continue;
+                }
+                matchCount++;
+                if (!function(match))
+                {
+                    return matchCount;
+                }
+            }
+
+            for (auto& child : result.children)
+            {
+                if (removeRepeats && !levelNodes.insert(child.path + '\0' + std::to_string(child.segmentIndex)).second)
+                {
+                    continue;
+                }
+                nextLevel.push_back(std::move(child));
+            }
+        }
+        currentLevel.swap(nextLevel);
+    }
+    return matchCount;
+}
+
+/** @} */
@@ -0,0 +1,153 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file schema_pool.cpp
+ * @ingroup argparser
+ * @{
+ */
+
+// Includes
+#include <cstdint>
+#include <vector>
+#include "schema_pool.h"
+
+#if defined(__linux__)
+#include <link.h>
+#endif
+
+using namespace argparser;
+
+//============================================================================================================================
+//============================================================================================================================
+//  Private functions
+//============================================================================================================================
+//============================================================================================================================
+
+namespace
+{
+
+/**
+ * @brief Address range of a read only program segment
+ */
+struct readOnlyRange
+{
+    uintptr_t   start;      ///< First address of the segment
+    uintptr_t   end;        ///< Address following the segment
+};
+
+#if defined(__linux__)
+/**
+ * @brief dl_iterate_phdr callback, add the read only loadable segments of one object
+ *
+ * @param info - Loaded object information
+ * @param size - Size of the info structure, not used
+ * @param data - std::vector<readOnlyRange> to add the segments to
+ *
+ * @return int - 0 to continue the iteration
+ */
+int addReadOnlySegments(struct dl_phdr_info* info, size_t, void* data)
+{
+    std::vector<readOnlyRange>* rangeList = static_cast<std::vector<readOnlyRange>*>(data);
+    for (size_t index = 0; index < info->dlpi_phnum; index++)
+    {
+        const ElfW(Phdr)& segment = info->dlpi_phdr[index];
+        if ((segment.p_type == PT_LOAD) && ((segment.p_flags & PF_W) == 0))
+        {
+            uintptr_t start = static_cast<uintptr_t>(info->dlpi_addr + segment.p_vaddr);
+            rangeList->push_back({start, start + static_cast<uintptr_t>(segment.p_memsz)});
+        }
+    }
+    return 0;
+}
+#endif
+
+/**
+ * @brief Get the read only segments of the objects loaded at the first call
+ *
+ * @return const std::vector<readOnlyRange>& - Read only segment list, empty if the platform has no segment query
+ */
+const std::vector<readOnlyRange>& getReadOnlyRanges()
+{
+    static const std::vector<readOnlyRange> rangeList = []()
+    {
+        std::vector<readOnlyRange> segmentList;
+#if defined(__linux__)
+        dl_iterate_phdr(addReadOnlySegments, &segmentList);
+#endif
+        return segmentList;
+    }();
+    return rangeList;
+}
+
+}; // end of anonymous namespace
+
+//============================================================================================================================
+//============================================================================================================================
+//  Public functions
+//============================================================================================================================
+//============================================================================================================================
+
+/**
+ * @brief Check if a memory range lies in a read only segment of the program
+ *        or of a shared library loaded before the first call
+ *
+ * @param data   - Start of the range
+ * @param length - Length of the range in bytes
+ *
+ * @return true  - Range is read only for the life of the program
+ * @return false - Range is writable or could not be checked
+ */
+bool schema_pool::isReadOnlyData(const void* data, size_t length)
+{
+    uintptr_t start = reinterpret_cast<uintptr_t>(data);
+    for (auto const& segment : getReadOnlyRanges())
+    {
+        if ((start >= segment.start) && (start < segment.end) && (length <= (segment.end - start)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Get the stored view of a registration string
+ *
+ * @param text - Text to store
+ *
+ * @return std::string_view - Null terminated view of the text, valid for the lifetime of the pool
+ */
+std::string_view schema_pool::store(std::string_view text)
+{
+    // Use read only text in place if the terminator is part of the same read only range
+    if ((text.data() != nullptr) && isReadOnlyData(text.data(), text.size() + 1) && (text.data()[text.size()] == '\0'))
+    {
+        std::lock_guard<std::mutex> guard(counterLock);
+        referencedCount++;
+        referencedBytes += text.size();
+        return text;
+    }
+    return storage.intern(text);
+}
+
+/** @} */
@@ -0,0 +1,351 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file utf8_validate.cpp
+ * @ingroup argparser
+ * @{
+ */
+
+// Includes
+#include <cstdint>
+#include <cstring>
+#include "utf8_validate.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define UTF8_AVX2_KERNEL
+#include <immintrin.h>
+#endif
+
+using namespace argparser;
+
+//============================================================================================================================
+//============================================================================================================================
+//  Private functions
+//============================================================================================================================
+//============================================================================================================================
+
+namespace
+{
+
+/**
+ * @brief Scalar UTF-8 check, Unicode table 3-7 well formed byte sequences
+ *
+ * @param buffer   - Pointer to the buffer
+ * @param startPos - Offset to start the check at, must be the first byte of a sequence
+ * @param length   - Length of the buffer in bytes
+ *
+ * @return size_t - Offset of the first invalid sequence or utf8Valid
+ */
+size_t findInvalidScalar(const unsigned char* buffer, size_t startPos, size_t length)
+{
+    constexpr uint64_t highBits = 0x8080808080808080ULL;
+    size_t index = startPos;
+    while (index < length)
+    {
+        // Skip ASCII eight bytes at a time
+        uint64_t word;
+        if ((index + sizeof(word)) <= length)
+        {
+            memcpy(&word, buffer + index, sizeof(word));
+            if ((word & highBits) == 0)
+            {
+                index += sizeof(word);
+                continue;
+            }
+        }
+
+        const unsigned char leadByte = buffer[index];
+        if (leadByte < 0x80)
+        {
+            index++;
+            continue;
+        }
+
+        size_t        followCount;
+        unsigned char secondMin = 0x80;
+        unsigned char secondMax = 0xBF;
+        if ((leadByte >= 0xC2) && (leadByte <= 0xDF))
+        {
+            followCount = 1;
+        }
+        else if ((leadByte >= 0xE0) && (leadByte <= 0xEF))
+        {
+            followCount = 2;
+            secondMin = ((leadByte == 0xE0) ? 0xA0 : secondMin);        // Overlong
+            secondMax = ((leadByte == 0xED) ? 0x9F : secondMax);        // Surrogate
+        }
+        else if ((leadByte >= 0xF0) && (leadByte <= 0xF4))
+        {
+            followCount = 3;
+            secondMin = ((leadByte == 0xF0) ? 0x90 : secondMin);        // Overlong
+            secondMax = ((leadByte == 0xF4) ? 0x8F : secondMax);        // Above U+10FFFF
+        }
+        else
+        {
+            return index;
+        }
+
+        if (((length - index) <= followCount) || (buffer[index + 1] < secondMin) || (buffer[index + 1] > secondMax))
+        {
+            return index;
+        }
+        for (size_t followIndex = 2; followIndex <= followCount; followIndex++)
+        {
+            if ((buffer[index + followIndex] & 0xC0) != 0x80)
+            {
+                return index;
+            }
+        }
+        index += followCount + 1;
+    }
+    return utf8Valid;
+}
+
+/**
+ * @brief Locate the error the vector kernel found in the block at blockPos.
+ *        The error may belong to a sequence that starts up to three bytes
+ *        before the block, everything before that sequence is valid.
+ *
+ * @param buffer   - Pointer to the buffer
+ * @param blockPos - Offset of the block that reported the error
+ * @param length   - Length of the buffer in bytes
+ *
+ * @return size_t - Offset of the first invalid sequence
+ */
+size_t locateError(const unsigned char* buffer, size_t blockPos, size_t length)
+{
+    size_t startPos = ((blockPos >= 3) ? (blockPos - 3) : 0);
+    while ((startPos < blockPos) && ((buffer[startPos] & 0xC0) == 0x80))
+    {
+        startPos++;
+    }
+    size_t errorPos = findInvalidScalar(buffer, startPos, length);
+    return ((errorPos != utf8Valid) ? errorPos : findInvalidScalar(buffer, 0, length));
+}
+
+#if defined(UTF8_AVX2_KERNEL)
+// Error classes of a byte pair, see "Validating UTF-8 In Less Than One Instruction Per Byte", Keiser and Lemire
+constexpr char tooShort     = 1 << 0;   ///< 11______ 0_______ or 11______ 11______
+constexpr char tooLong      = 1 << 1;   ///< 0_______ 10______
+constexpr char overlong3    = 1 << 2;   ///< 11100000 100_____
+constexpr char tooLarge     = 1 << 3;   ///< 11110100 1001____ or 11110100 101_____ or 11110101..11111111 10______
+constexpr char surrogate    = 1 << 4;   ///< 11101101 101_____
+constexpr char overlong2    = 1 << 5;   ///< 1100000_ 10______
+constexpr char tooLarge1000 = 1 << 6;   ///< 11110101..11111111 1000____
+constexpr char overlong4    = 1 << 6;   ///< 11110000 1000____
+constexpr char twoConts     = static_cast<char>(1 << 7);    ///< 10______ 10______
+constexpr char carry        = tooShort | tooLong | twoConts;
+
+/**
+ * @brief Get the input bytes shifted by N bytes, the first N bytes come from the end of the previous block
+ *
+ * @param input    - Current block
+ * @param previous - Previous block
+ *
+ * @return __m256i - Shifted block
+ */
+template <int N> __attribute__((target("avx2"))) inline __m256i previousBytes(__m256i input, __m256i previous)
+{
+    return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(previous, input, 0x21), 16 - N);
+}
+
+/**
+ * @brief Check a 32 byte block
+ *
+ * @param input    - Current block
+ * @param previous - Previous block, zero for the first block
+ *
+ * @return __m256i - Non zero if the block has an error
+ */
+__attribute__((target("avx2"))) __m256i checkBlock(__m256i input, __m256i previous)
+{
+    const __m256i byte1HighTable = _mm256_setr_epi8(
+        tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong,
+        twoConts, twoConts, twoConts, twoConts,
+        tooShort | overlong2,
+        tooShort,
+        tooShort | overlong3 | surrogate,
+        tooShort | tooLarge | tooLarge1000 | overlong4,
+        tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong,
+        twoConts, twoConts, twoConts, twoConts,
+        tooShort | overlong2,
+        tooShort,
+        tooShort | overlong3 | surrogate,
+        tooShort | tooLarge | tooLarge1000 | overlong4);
+
+    const __m256i byte1LowTable = _mm256_setr_epi8(
+        carry | overlong3 | overlong2 | overlong4,
+        carry | overlong2,
+        carry,
+        carry,
+        carry | tooLarge,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000 | surrogate,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000,
+        carry | overlong3 | overlong2 | overlong4,
+        carry | overlong2,
+        carry,
+        carry,
+        carry | tooLarge,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000 | surrogate,
+        carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000);
+
+    const __m256i byte2HighTable = _mm256_setr_epi8(
+        tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort,
+        tooLong | overlong2 | twoConts | overlong3 | tooLarge1000 | overlong4,
+        tooLong | overlong2 | twoConts | overlong3 | tooLarge,
+        tooLong | overlong2 | twoConts | surrogate | tooLarge,
+        tooLong | overlong2 | twoConts | surrogate | tooLarge,
+        tooShort, tooShort, tooShort, tooShort,
+        tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort,
+        tooLong | overlong2 | twoConts | overlong3 | tooLarge1000 | overlong4,
+        tooLong | overlong2 | twoConts | overlong3 | tooLarge,
+        tooLong | overlong2 | twoConts | surrogate | tooLarge,
+        tooLong | overlong2 | twoConts | surrogate | tooLarge,
+        tooShort, tooShort, tooShort, tooShort);
+
+    const __m256i lowNibbleMask = _mm256_set1_epi8(0x0F);
+    const __m256i prev1 = previousBytes<1>(input, previous);
+    const __m256i byte1High = _mm256_shuffle_epi8(byte1HighTable, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), lowNibbleMask));
+    const __m256i byte1Low = _mm256_shuffle_epi8(byte1LowTable, _mm256_and_si256(prev1, lowNibbleMask));
+    const __m256i byte2High = _mm256_shuffle_epi8(byte2HighTable, _mm256_and_si256(_mm256_srli_epi16(input, 4), lowNibbleMask));
+    const __m256i special = _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+
+    // Third and fourth bytes of three and four byte sequences must be continuation bytes
+    const __m256i isThirdByte = _mm256_subs_epu8(previousBytes<2>(input, previous), _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+    const __m256i isFourthByte = _mm256_subs_epu8(previousBytes<3>(input, previous), _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+    const __m256i mustBeContinuation = _mm256_and_si256(_mm256_or_si256(isThirdByte, isFourthByte), _mm256_set1_epi8(static_cast<char>(0x80)));
+    return _mm256_xor_si256(mustBeContinuation, special);
+}
+
+/**
+ * @brief Check if a block ends inside a multi byte sequence
+ *
+ * @param input - Current block
+ *
+ * @return __m256i - Non zero if the last sequence needs bytes from the next block
+ */
+__attribute__((target("avx2"))) inline __m256i isIncomplete(__m256i input)
+{
+    const __m256i maxValue = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+    return _mm256_subs_epu8(input, maxValue);
+}
+
+/**
+ * @brief AVX2 UTF-8 check
+ *
+ * @param buffer - Pointer to the buffer
+ * @param length - Length of the buffer in bytes
+ *
+ * @return size_t - Offset of the first invalid sequence or utf8Valid
+ */
+__attribute__((target("avx2"))) size_t findInvalidAvx2(const unsigned char* buffer, size_t length)
+{
+    constexpr size_t blockSize = sizeof(__m256i);
+    __m256i previous = _mm256_setzero_si256();
+    __m256i previousIncomplete = _mm256_setzero_si256();
+
+    size_t blockPos = 0;
+    for (; (blockPos + blockSize) <= length; blockPos += blockSize)
+    {
+        const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(buffer + blockPos));
+        __m256i error = previousIncomplete;
+        if (_mm256_movemask_epi8(input) != 0)
+        {
+            error = checkBlock(input, previous);
+            previousIncomplete = isIncomplete(input);
+        }
+        else
+        {
+            previousIncomplete = _mm256_setzero_si256();
+        }
+
+        if (!_mm256_testz_si256(error, error))
+        {
+            return locateError(buffer, blockPos, length);
+        }
+        previous = input;
+    }
+
+    // The zero padding of the last partial block ends any open sequence
+    __m256i error = previousIncomplete;
+    if (blockPos < length)
+    {
+        alignas(blockSize) unsigned char lastBlock[blockSize] = {};
+        memcpy(lastBlock, buffer + blockPos, length - blockPos);
+        error = checkBlock(_mm256_load_si256(reinterpret_cast<const __m256i*>(lastBlock)), previous);
+    }
+    return (_mm256_testz_si256(error, error) ? utf8Valid : locateError(buffer, blockPos, length));
+}
+#endif
+
+}; // end of anonymous namespace
+
+//============================================================================================================================
+//============================================================================================================================
+//  Public functions
+//============================================================================================================================
+//============================================================================================================================
+
+/**
+ * @brief Find the first invalid UTF-8 sequence in a buffer
+ *
+ * @param buffer - Pointer to the buffer, does not need to be null terminated
+ * @param length - Length of the buffer in bytes
+ *
+ * @return size_t - Offset of the first byte of the first invalid sequence, utf8Valid if the buffer is valid
+ */
+size_t argparser::findInvalidUtf8(const char* buffer, size_t length)
+{
+    const auto* byteBuffer = reinterpret_cast<const unsigned char*>(buffer);
+#if defined(UTF8_AVX2_KERNEL)
+    static const bool useAvx2 = __builtin_cpu_supports("avx2");
+    if (useAvx2 && (length >= 32))
+    {
+        return findInvalidAvx2(byteBuffer, length);
+    }
+#endif
+    return findInvalidScalar(byteBuffer, 0, length);
+}
+
+/** @} */
@@ -0,0 +1,167 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file arg_value_store_test.cpp
+ * @ingroup argparser_unittest
+ * @defgroup Argument value store unit test
+ * @{
+ */
+
+// Includes
+#include <cstring>
+#include "arg_value_store.h"
+#include <gtest/gtest.h>
+
+using namespace argparser;
+
+//======================================================================================
+// Public Interface testing
+//======================================================================================
+
+TEST(argValueStore, unusedStore)
+{
+    argValueStore testStore;
+    EXPECT_FALSE(testStore.isValid());
+    EXPECT_FALSE(testStore.isList());
+    EXPECT_TRUE(testStore.isEmpty());
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, testStore.setValue("1"));
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, testStore.setValue());
+    EXPECT_EQ(nullptr, testStore.getValue<int>());
+}
+
+TEST(argValueStore, signedValue)
+{
+    argValueStore testStore = argValueStore::create<int>(5);
+    EXPECT_TRUE(testStore.isValid());
+    EXPECT_FALSE(testStore.isList());
+    ASSERT_NE(nullptr, testStore.getValue<int>());
+    EXPECT_EQ(5, *testStore.getValue<int>());
+    EXPECT_EQ(nullptr, testStore.getValue<long int>());
+
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, testStore.setValue("-42"));
+    EXPECT_EQ(-42, *testStore.getValue<int>());
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, testStore.setValue("abc"));
+    EXPECT_EQ(valueParseStatus_e::PARSE_BOUNDARY_HIGH_e, testStore.setValue("2147483648"));
+    EXPECT_EQ(valueParseStatus_e::PARSE_BOUNDARY_LOW_e, testStore.setValue("-2147483649"));
+    EXPECT_EQ(-42, *testStore.getValue<int>());
+}
+
+TEST(argValueStore, boundedValue)
+{
+    argValueStore testStore = argValueStore::create<unsigned>(5, 2, 10);
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, testStore.setValue("10"));
+    EXPECT_EQ(10U, *testStore.getValue<unsigned>());
+    EXPECT_EQ(valueParseStatus_e::PARSE_BOUNDARY_HIGH_e, testStore.setValue("11"));
+    EXPECT_EQ(valueParseStatus_e::PARSE_BOUNDARY_LOW_e, testStore.setValue("1"));
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, testStore.setValue("-3"));
+    EXPECT_EQ(10U, *testStore.getValue<unsigned>());
+
+    argValueStore doubleStore = argValueStore::create<double>(1.0, 0.5, 2.5);
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, doubleStore.setValue("-2.0"));
+    EXPECT_DOUBLE_EQ(-2.0, *doubleStore.getValue<double>());
+    EXPECT_EQ(valueParseStatus_e::PARSE_BOUNDARY_HIGH_e, doubleStore.setValue("3.0"));
+    EXPECT_EQ(valueParseStatus_e::PARSE_BOUNDARY_LOW_e, doubleStore.setValue("0.25"));
+}
+
+TEST(argValueStore, charStringValue)
+{
+    argValueStore charStore = argValueStore::create<char>('a');
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, charStore.setValue("z"));
+    EXPECT_EQ('z', *charStore.getValue<char>());
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, charStore.setValue("zz"));
+
+    argValueStore stringStore = argValueStore::create<std::string>("default");
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, stringStore.setValue("new value"));
+    EXPECT_EQ("new value", *stringStore.getValue<std::string>());
+}
+
+TEST(argValueStore, flagValue)
+{
+    argValueStore flagStore = argValueStore::createFlag(false);
+    EXPECT_FALSE(*flagStore.getValue<bool>());
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, flagStore.setValue());
+    EXPECT_TRUE(*flagStore.getValue<bool>());
+
+    argValueStore invertStore = argValueStore::createFlag(true);
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, invertStore.setValue());
+    EXPECT_FALSE(*invertStore.getValue<bool>());
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, invertStore.setValue("true"));
+    EXPECT_TRUE(*invertStore.getValue<bool>());
+
+    argValueStore intStore = argValueStore::create<int>(0);
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, intStore.setValue());
+}
+
+TEST(argValueStore, listValue)
+{
+    argValueStore testStore = argValueStore::create<std::vector<short int>>({});
+    EXPECT_TRUE(testStore.isList());
+    EXPECT_TRUE(testStore.isEmpty());
+
+    testStore.reserveValues(3);
+    EXPECT_GE(testStore.getValue<std::vector<short int>>()->capacity(), 3U);
+
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, testStore.setValue("1"));
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, testStore.setValue("-2"));
+    EXPECT_EQ(valueParseStatus_e::PARSE_BOUNDARY_HIGH_e, testStore.setValue("40000"));
+    EXPECT_FALSE(testStore.isEmpty());
+
+    const std::vector<short int>* values = testStore.getValue<std::vector<short int>>();
+    ASSERT_NE(nullptr, values);
+    ASSERT_EQ(2U, values->size());
+    EXPECT_EQ(1, (*values)[0]);
+    EXPECT_EQ(-2, (*values)[1]);
+}
+
+TEST(argValueStore, listValueBuffer)
+{
+    argValueStore testStore = argValueStore::create<std::vector<std::string>>({});
+    const char* buffer = "one,two,three";
+    size_t failedIndex = 0;
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, testStore.setValueBuffer(buffer, strlen(buffer), ',', failedIndex));
+
+    const std::vector<std::string>* values = testStore.getValue<std::vector<std::string>>();
+    ASSERT_EQ(3U, values->size());
+    EXPECT_EQ("one", (*values)[0]);
+    EXPECT_EQ("three", (*values)[2]);
+
+    argValueStore intStore = argValueStore::create<std::vector<int>>({});
+    const char* badBuffer = "1,2,x,4";
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, intStore.setValueBuffer(badBuffer, strlen(badBuffer), ',', failedIndex));
+    EXPECT_EQ(2U, failedIndex);
+    EXPECT_EQ(2U, intStore.getValue<std::vector<int>>()->size());
+}
+
+TEST(argValueStore, heapUsage)
+{
+    argValueStore intStore = argValueStore::create<int>(5);
+    EXPECT_EQ(0U, intStore.getHeapUsage().allocations);
+
+    argValueStore listStore = argValueStore::create<std::vector<std::string>>({});
+    listStore.reserveValues(4);
+    EXPECT_EQ(1U, listStore.getHeapUsage().allocations);
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, listStore.setValue(std::string(100, 'x').c_str()));
+    EXPECT_EQ(2U, listStore.getHeapUsage().allocations);
+}
+
+/** @} */
@@ -0,0 +1,157 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file field_binding_test.cpp
+ * @ingroup argparser_unittest
+ * @defgroup Structure field binding unit test
+ * @{
+ */
+
+// Includes
+#include <cstring>
+#include "field_binding.h"
+#include <gtest/gtest.h>
+
+using namespace argparser;
+
+enum class testColor_e
+{
+    RED = 1,
+    GREEN = 2,
+    BLUE = 4,
+};
+
+struct testConfig
+{
+    int                         threads = 4;
+    unsigned char               level = 0;
+    double                      ratio = 1.0;
+    bool                        verbose = false;
+    std::string                 name;
+    std::vector<int>            values;
+    testColor_e                 color = testColor_e::RED;
+    std::vector<testColor_e>    colorList;
+};
+
+//======================================================================================
+// Public Interface testing
+//======================================================================================
+
+TEST(fieldBinding, unboundBinding)
+{
+    fieldBinding testBinding;
+    EXPECT_FALSE(testBinding.isBound());
+    EXPECT_FALSE(testBinding.isList());
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, testBinding.setValue("1"));
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, testBinding.setValue());
+}
+
+TEST(fieldBinding, scalarFields)
+{
+    testConfig config;
+    fieldBinding threadBinding = fieldBinding::create(config.threads);
+    EXPECT_TRUE(threadBinding.isBound());
+    EXPECT_FALSE(threadBinding.isList());
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, threadBinding.setValue("-12"));
+    EXPECT_EQ(-12, config.threads);
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, threadBinding.setValue("many"));
+    EXPECT_EQ(valueParseStatus_e::PARSE_BOUNDARY_HIGH_e, threadBinding.setValue("2147483648"));
+    EXPECT_EQ(-12, config.threads);
+
+    fieldBinding levelBinding = fieldBinding::create(config.level);
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, levelBinding.setValue("255"));
+    EXPECT_EQ(255, config.level);
+    EXPECT_EQ(valueParseStatus_e::PARSE_BOUNDARY_HIGH_e, levelBinding.setValue("256"));
+
+    fieldBinding ratioBinding = fieldBinding::create(config.ratio);
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, ratioBinding.setValue("2.5"));
+    EXPECT_DOUBLE_EQ(2.5, config.ratio);
+
+    fieldBinding nameBinding = fieldBinding::create(config.name);
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, nameBinding.setValue("george"));
+    EXPECT_EQ("george", config.name);
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, nameBinding.setValue());
+}
+
+TEST(fieldBinding, flagField)
+{
+    testConfig config;
+    fieldBinding flagBinding = fieldBinding::create(config.verbose);
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, flagBinding.setValue());
+    EXPECT_TRUE(config.verbose);
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, flagBinding.setValue("false"));
+    EXPECT_FALSE(config.verbose);
+
+    // The flag key sets the inverse of the value at bind time
+    config.verbose = true;
+    fieldBinding invertBinding = fieldBinding::create(config.verbose);
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, invertBinding.setValue());
+    EXPECT_FALSE(config.verbose);
+}
+
+TEST(fieldBinding, listField)
+{
+    testConfig config;
+    fieldBinding listBinding = fieldBinding::create(config.values);
+    EXPECT_TRUE(listBinding.isList());
+
+    listBinding.reserveValues(3);
+    EXPECT_GE(config.values.capacity(), 3U);
+
+    const char* buffer = "1,2,x,4";
+    size_t failedIndex = 0;
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, listBinding.setValueBuffer(buffer, strlen(buffer), ',', failedIndex));
+    EXPECT_EQ(2U, failedIndex);
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, listBinding.setValue("7"));
+    ASSERT_EQ(3U, config.values.size());
+    EXPECT_EQ(1, config.values[0]);
+    EXPECT_EQ(2, config.values[1]);
+    EXPECT_EQ(7, config.values[2]);
+}
+
+TEST(fieldBinding, enumField)
+{
+    testConfig config;
+    fieldBinding colorBinding = fieldBinding::create(config.color);
+    EXPECT_EQ(0U, colorBinding.getHeapUsage().allocations);
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, colorBinding.setValue("green"));
+
+    colorBinding.setEnumNames({{"red", 1}, {"green", 2}, {"blue", 4}, {"green", 4}});
+    EXPECT_NE(0U, colorBinding.getHeapUsage().allocations);
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, colorBinding.setValue("green"));
+    EXPECT_EQ(testColor_e::GREEN, config.color);
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, colorBinding.setValue("purple"));
+    EXPECT_EQ(testColor_e::GREEN, config.color);
+
+    fieldBinding colorListBinding = fieldBinding::create(config.colorList);
+    colorListBinding.setEnumNames({{"red", 1}, {"green", 2}, {"blue", 4}});
+    const char* buffer = "blue,red";
+    size_t failedIndex = 0;
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, colorListBinding.setValueBuffer(buffer, strlen(buffer), ',', failedIndex));
+    ASSERT_EQ(2U, config.colorList.size());
+    EXPECT_EQ(testColor_e::BLUE, config.colorList[0]);
+    EXPECT_EQ(testColor_e::RED, config.colorList[1]);
+}
+
+/** @} */
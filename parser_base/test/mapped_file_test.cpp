@@ -0,0 +1,149 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file mapped_file_test.cpp
+ * @ingroup argparser_unittest
+ * @defgroup Value source file unit test
+ * @{
+ */
+
+// Includes
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "mapped_file.h"
+#include <gtest/gtest.h>
+
+using namespace argparser;
+
+/**
+ * @brief Write a temporary test file
+ *
+ * @param contents - File contents
+ *
+ * @return std::string - File path
+ */
+static std::string writeTestFile(const std::string& contents)
+{
+    char path[] = "/tmp/mapped_file_testXXXXXX";
+    int fd = mkstemp(path);
+    EXPECT_GE(fd, 0);
+    EXPECT_EQ(static_cast<ssize_t>(contents.size()), write(fd, contents.data(), contents.size()));
+    close(fd);
+    return path;
+}
+
+/**
+ * @brief Collect the lines of an open mapped_file
+ *
+ * @param sourceFile - Open file
+ *
+ * @return std::vector<std::string> - File lines
+ */
+static std::vector<std::string> readLines(mapped_file& sourceFile)
+{
+    std::vector<std::string> lines;
+    EXPECT_TRUE(sourceFile.forEachLine([&lines](const char* line, size_t length) {lines.emplace_back(line, length); return true;}));
+    return lines;
+}
+
+//======================================================================================
+// Public Interface testing
+//======================================================================================
+
+TEST(mapped_file, mappedLines)
+{
+    std::string path = writeTestFile("one\r\ntwo,three\n\nfour");
+    mapped_file sourceFile;
+    ASSERT_TRUE(sourceFile.open(path.c_str()));
+    EXPECT_TRUE(sourceFile.isMapped());
+    EXPECT_EQ(20U, sourceFile.size());
+
+    std::vector<std::string> lines = readLines(sourceFile);
+    ASSERT_EQ(4U, lines.size());
+    EXPECT_EQ("one", lines[0]);
+    EXPECT_EQ("two,three", lines[1]);
+    EXPECT_EQ("", lines[2]);
+    EXPECT_EQ("four", lines[3]);
+
+    sourceFile.close();
+    EXPECT_FALSE(sourceFile.isMapped());
+    remove(path.c_str());
+}
+
+TEST(mapped_file, stopScan)
+{
+    std::string path = writeTestFile("1\n2\n3\n");
+    mapped_file sourceFile;
+    ASSERT_TRUE(sourceFile.open(path.c_str()));
+
+    size_t lineCount = 0;
+    EXPECT_FALSE(sourceFile.forEachLine([&lineCount](const char* line, size_t length) {return (++lineCount < 2);}));
+    EXPECT_EQ(2U, lineCount);
+    remove(path.c_str());
+}
+
+TEST(mapped_file, emptyAndMissingFile)
+{
+    std::string path = writeTestFile("");
+    mapped_file sourceFile;
+    ASSERT_TRUE(sourceFile.open(path.c_str()));
+    EXPECT_FALSE(sourceFile.isMapped());
+    EXPECT_TRUE(readLines(sourceFile).empty());
+    remove(path.c_str());
+
+    EXPECT_FALSE(sourceFile.open("/nonexistent/mapped_file_test"));
+}
+
+TEST(mapped_file, standardInputBlocks)
+{
+    // Feed standard input from a pipe with a line that spans read blocks
+    std::string longLine(mapped_file::readBlockSize + 10, 'x');
+    std::string contents = "first\n" + longLine + "\nlast";
+    std::string path = writeTestFile(contents);
+
+    int savedStdin = dup(STDIN_FILENO);
+    FILE* inputFile = fopen(path.c_str(), "r");
+    ASSERT_NE(nullptr, inputFile);
+    dup2(fileno(inputFile), STDIN_FILENO);
+
+    mapped_file sourceFile;
+    ASSERT_TRUE(sourceFile.open("-"));
+    EXPECT_FALSE(sourceFile.isMapped());
+    std::vector<std::string> lines = readLines(sourceFile);
+    sourceFile.close();
+
+    dup2(savedStdin, STDIN_FILENO);
+    close(savedStdin);
+    fclose(inputFile);
+    remove(path.c_str());
+
+    ASSERT_EQ(3U, lines.size());
+    EXPECT_EQ("first", lines[0]);
+    EXPECT_EQ(longLine, lines[1]);
+    EXPECT_EQ("last", lines[2]);
+}
+
+/** @} */
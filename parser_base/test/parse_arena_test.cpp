@@ -0,0 +1,138 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file parse_arena_test.cpp
+ * @ingroup argparser_unittest
+ * @defgroup Parse session arena unit test
+ * @{
+ */
+
+// Includes
+#include <memory_resource>
+#include <string>
+#include <vector>
+#include "parse_arena.h"
+#include <gtest/gtest.h>
+
+using namespace argparser;
+
+/**
+ * @brief Upstream resource that counts the blocks it hands out
+ */
+class countingResource : public std::pmr::memory_resource
+{
+    public:
+        size_t allocateCount = 0;
+        size_t deallocateCount = 0;
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            allocateCount++;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void* block, size_t bytes, size_t alignment) override
+        {
+            deallocateCount++;
+            std::pmr::new_delete_resource()->deallocate(block, bytes, alignment);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {return (this == &other);}
+};
+
+//======================================================================================
+// Public Interface testing
+//======================================================================================
+
+TEST(parse_arena, initialBuffer)
+{
+    countingResource upstream;
+    parse_arena arena(&upstream);
+    EXPECT_EQ(&upstream, arena.getUpstream());
+    EXPECT_EQ(0U, arena.getAllocatedBytes());
+
+    std::pmr::vector<std::string_view> tokenList(&arena);
+    tokenList.reserve(16);
+    std::pmr::string token("a string that is too long for the small string buffer", &arena);
+    EXPECT_GT(arena.getAllocatedBytes(), 16 * sizeof(std::string_view));
+    EXPECT_EQ(0U, upstream.allocateCount);
+}
+
+TEST(parse_arena, upstreamBlocks)
+{
+    countingResource upstream;
+    parse_arena arena(&upstream);
+    for (int index = 0; index < 8; index++)
+    {
+        EXPECT_NE(nullptr, arena.allocate(parse_arena::initialBufferSize, alignof(std::max_align_t)));
+    }
+    EXPECT_EQ(8 * parse_arena::initialBufferSize, arena.getAllocatedBytes());
+    EXPECT_GT(upstream.allocateCount, 0U);
+    EXPECT_EQ(0U, upstream.deallocateCount);
+
+    // One reset returns every block
+    arena.reset();
+    EXPECT_EQ(0U, arena.getAllocatedBytes());
+    EXPECT_EQ(upstream.allocateCount, upstream.deallocateCount);
+
+    // The built in buffer is used again after the reset
+    size_t blockCount = upstream.allocateCount;
+    EXPECT_NE(nullptr, arena.allocate(parse_arena::initialBufferSize / 2, 1));
+    EXPECT_EQ(blockCount, upstream.allocateCount);
+}
+
+TEST(parse_arena, changeUpstream)
+{
+    countingResource firstUpstream;
+    countingResource secondUpstream;
+    parse_arena arena(&firstUpstream);
+    EXPECT_NE(nullptr, arena.allocate(2 * parse_arena::initialBufferSize, 8));
+    EXPECT_EQ(1U, firstUpstream.allocateCount);
+
+    // The new resource is used after the next reset
+    arena.setUpstream(&secondUpstream);
+    EXPECT_NE(nullptr, arena.allocate(2 * parse_arena::initialBufferSize, 8));
+    EXPECT_EQ(2U, firstUpstream.allocateCount);
+    arena.reset();
+    EXPECT_EQ(2U, firstUpstream.deallocateCount);
+    EXPECT_NE(nullptr, arena.allocate(2 * parse_arena::initialBufferSize, 8));
+    EXPECT_EQ(2U, firstUpstream.allocateCount);
+    EXPECT_EQ(1U, secondUpstream.allocateCount);
+}
+
+TEST(parse_arena, heapUsage)
+{
+    countingResource upstream;
+    parse_arena arena(&upstream);
+    EXPECT_NE(nullptr, arena.allocate(parse_arena::initialBufferSize / 2, 8));
+    EXPECT_EQ(0U, arena.getHeapUsage().allocations);
+
+    // Blocks past the built in buffer are held until the reset
+    EXPECT_NE(nullptr, arena.allocate(2 * parse_arena::initialBufferSize, 8));
+    EXPECT_EQ(upstream.allocateCount, arena.getHeapUsage().allocations);
+    EXPECT_GE(arena.getHeapUsage().bytes, 2 * parse_arena::initialBufferSize);
+    arena.reset();
+    EXPECT_EQ(0U, arena.getHeapUsage().allocations);
+    EXPECT_EQ(0U, arena.getHeapUsage().bytes);
+}
+
+/** @} */
@@ -47,7 +47,11 @@ class test_parser_base : public argparser::parser_base
         ~test_parser_base() {}
 
         // Protected data accessors
-        std::list<argparser::ArgEntry> getKeyArgList()  {return argparser::parser_base::getKeyArgList();}
+        std::list<argparser::ArgEntry> getKeyArgList()
+        {
+            argparser::argEntryRange keyArgs = argparser::parser_base::getKeyArgList();
+            return std::list<argparser::ArgEntry>(keyArgs.begin(), keyArgs.end());
+        }
         parserchar getKeyListDelimiter()                {return argparser::parser_base::getKeyListDelimeter();}
         parserchar getAssignmentDelimiter()             {return argparser::parser_base::getAssignmentDelimeter();}
         parserchar getAssignmentListDelimiter()         {return argparser::parser_base::getAssignmentListDelimeter();}
@@ -129,7 +133,7 @@ TEST(parser_base, addArgKeyListSingleNospaces)
     argparser::ArgEntry testArg = {"foo", "foo input value", "", (&testvarg), 0, 0, true, false};
 
     EXPECT_EQ(1, testparser.addArgKeyList(testArg, testkeys));
-    EXPECT_STREQ("--foo", testArg.keyList.front().c_str());
+    EXPECT_EQ("--foo", testArg.keyList[0]);
 }
 
 TEST(parser_base, addArgKeyListSingleSpaces) 
@@ -140,7 +144,7 @@ TEST(parser_base, addArgKeyListSingleSpaces)
     argparser::ArgEntry testArg = {"foo", "foo input value", "", (&testvarg), 0, 0, true, false};
 
     EXPECT_EQ(1, testparser.addArgKeyList(testArg, testkeys));
-    EXPECT_STREQ("--foo", testArg.keyList.front().c_str());
+    EXPECT_EQ("--foo", testArg.keyList[0]);
 }
 
 TEST(parser_base, addArgKeyListDouble) 
@@ -151,9 +155,8 @@ TEST(parser_base, addArgKeyListDouble)
     argparser::ArgEntry testArg = {"foo", "foo input value", "", (&testvarg), 0, 0, true, false};
 
     EXPECT_EQ(2, testparser.addArgKeyList(testArg, testkeys));
-    EXPECT_STREQ("--foo", testArg.keyList.front().c_str());
-    testArg.keyList.pop_front();
-    EXPECT_STREQ("--moo", testArg.keyList.front().c_str());
+    EXPECT_EQ("--foo", testArg.keyList[0]);
+    EXPECT_EQ("--moo", testArg.keyList[1]);
 }
 
 TEST(parser_base, addArgKeyListDoubleWithSpace) 
@@ -164,9 +167,8 @@ TEST(parser_base, addArgKeyListDoubleWithSpace)
     argparser::ArgEntry testArg = {"foo", "foo input value", "", (&testvarg), 0, 0, true, false};
 
     EXPECT_EQ(2, testparser.addArgKeyList(testArg, testkeys));
-    EXPECT_STREQ("--foo", testArg.keyList.front().c_str());
-    testArg.keyList.pop_front();
-    EXPECT_STREQ("--moo", testArg.keyList.front().c_str());
+    EXPECT_EQ("--foo", testArg.keyList[0]);
+    EXPECT_EQ("--moo", testArg.keyList[1]);
 }
 
 TEST(parser_base, addArgKeyListTriple) 
@@ -177,11 +179,9 @@ TEST(parser_base, addArgKeyListTriple)
     argparser::ArgEntry testArg = {"foo", "foo input value", "", (&testvarg), 0, 0, true, false};
 
     EXPECT_EQ(3, testparser.addArgKeyList(testArg, testkeys));
-    EXPECT_STREQ("--foo", testArg.keyList.front().c_str());
-    testArg.keyList.pop_front();
-    EXPECT_STREQ("--moo", testArg.keyList.front().c_str());
-    testArg.keyList.pop_front();
-    EXPECT_STREQ("--goo", testArg.keyList.front().c_str());
+    EXPECT_EQ("--foo", testArg.keyList[0]);
+    EXPECT_EQ("--moo", testArg.keyList[1]);
+    EXPECT_EQ("--goo", testArg.keyList[2]);
 }
 
 TEST(parser_base, addArgKeyListTripleNewDelimeter) 
@@ -193,11 +193,9 @@ TEST(parser_base, addArgKeyListTripleNewDelimeter)
     testparser.setKeyListDelimiter(':');
 
     EXPECT_EQ(3, testparser.addArgKeyList(testArg, testkeys));
-    EXPECT_STREQ("--foo", testArg.keyList.front().c_str());
-    testArg.keyList.pop_front();
-    EXPECT_STREQ("--moo", testArg.keyList.front().c_str());
-    testArg.keyList.pop_front();
-    EXPECT_STREQ("--goo", testArg.keyList.front().c_str());
+    EXPECT_EQ("--foo", testArg.keyList[0]);
+    EXPECT_EQ("--moo", testArg.keyList[1]);
+    EXPECT_EQ("--goo", testArg.keyList[2]);
 }
 
 TEST(parser_base, getValueList) 
@@ -278,19 +276,19 @@ TEST(parser_base, findMatchingArg)
     bool found;
     argparser::ArgEntry& retArg = testparser.findMatchingArg("--goo", found);
     EXPECT_TRUE(found) << "did not find --goo";
-    EXPECT_STREQ("goo", retArg.name.c_str()) << "found not equal goo variable";
+    EXPECT_EQ("goo", retArg.name) << "found not equal goo variable";
 
     retArg = testparser.findMatchingArg("-g", found);
     EXPECT_TRUE(found) << "did not find -g";
-    EXPECT_STREQ("goo", retArg.name.c_str()) << "found not equal goo variable";
+    EXPECT_EQ("goo", retArg.name) << "found not equal goo variable";
 
     retArg = testparser.findMatchingArg("--foo", found);
     EXPECT_TRUE(found) << "did not find --foo";
-    EXPECT_STREQ("foo", retArg.name.c_str()) << "found not equal foo variable";
+    EXPECT_EQ("foo", retArg.name) << "found not equal foo variable";
 
     retArg = testparser.findMatchingArg("-f", found);
     EXPECT_TRUE(found) << "did not find -f";
-    EXPECT_STREQ("foo", retArg.name.c_str()) << "found not equal foo variable";
+    EXPECT_EQ("foo", retArg.name) << "found not equal foo variable";
 }
 
 TEST(parser_base, assignKeyFlagValue) 
@@ -368,11 +366,9 @@ TEST(parser_base, assignListKeyValueWithInput)
     parserstr failValue;
     EXPECT_EQ(argparser::eAssignSuccess, testparser.assignListKeyValue(testArg, returnList, failValue));
     EXPECT_EQ(3, testvarg.value.size());
-    EXPECT_EQ(21, testvarg.value.front());
-    testvarg.value.pop_front();
-    EXPECT_EQ(42, testvarg.value.front());
-    testvarg.value.pop_front();
-    EXPECT_EQ(13, testvarg.value.front());
+    EXPECT_EQ(21, testvarg.value[0]);
+    EXPECT_EQ(42, testvarg.value[1]);
+    EXPECT_EQ(13, testvarg.value[2]);
 }
 
 TEST(parser_base, assignListKeyValueWithInputAnySize) 
@@ -391,11 +387,9 @@ TEST(parser_base, assignListKeyValueWithInputAnySize)
     parserstr failValue;
     EXPECT_EQ(argparser::eAssignSuccess, testparser.assignListKeyValue(testArg, returnList, failValue));
     EXPECT_EQ(3, testvarg.value.size());
-    EXPECT_EQ(21, testvarg.value.front());
-    testvarg.value.pop_front();
-    EXPECT_EQ(42, testvarg.value.front());
-    testvarg.value.pop_front();
-    EXPECT_EQ(13, testvarg.value.front());
+    EXPECT_EQ(21, testvarg.value[0]);
+    EXPECT_EQ(42, testvarg.value[1]);
+    EXPECT_EQ(13, testvarg.value[2]);
 }
 
 TEST(parser_base, assignListKeyValueTooMany) 
@@ -450,11 +444,9 @@ TEST(parser_base, assignListKeyValueNegCnt)
     parserstr failValue;
     EXPECT_EQ(argparser::eAssignSuccess, testparser.assignListKeyValue(testArg, returnList, failValue));
     EXPECT_EQ(3, testvarg.value.size());
-    EXPECT_EQ(21, testvarg.value.front());
-    testvarg.value.pop_front();
-    EXPECT_EQ(42, testvarg.value.front());
-    testvarg.value.pop_front();
-    EXPECT_EQ(13, testvarg.value.front());
+    EXPECT_EQ(21, testvarg.value[0]);
+    EXPECT_EQ(42, testvarg.value[1]);
+    EXPECT_EQ(13, testvarg.value[2]);
 }
 
 TEST(parser_base, assignListKeyValueTooFew) 
@@ -515,6 +507,62 @@ TEST(parser_base, assignListKeyValueBadInput)
     EXPECT_STREQ("moo", failValue.c_str());
 }
 
+TEST(parser_base, countValueList) 
+{ 
+    test_parser_base testparser;
+    parserstr valueTestString = "=1,,3";
+    EXPECT_EQ(3, testparser.countValueList(valueTestString));
+    EXPECT_STREQ("1,,3", valueTestString.c_str());
+
+    parserstr trailingTestString = "1,2,";
+    EXPECT_EQ(2, testparser.countValueList(trailingTestString));
+
+    parserstr emptyTestString = "";
+    EXPECT_EQ(0, testparser.countValueList(emptyTestString));
+}
+
+TEST(parser_base, assignDelimitedKeyValueWithInput) 
+{ 
+    test_parser_base testparser;
+    argparser::listvarg<int> testvarg;
+    argparser::ArgEntry testArg = {"goo", "goo input value", "", (&testvarg), -1, 0, true, false};
+
+    parserstr valueTestString = "21,42,13";
+    size_t valueCount = testparser.countValueList(valueTestString);
+    parserstr failValue;
+    EXPECT_EQ(argparser::eAssignSuccess, testparser.assignDelimitedKeyValue(testArg, valueTestString, valueCount, failValue));
+    ASSERT_EQ(3, testvarg.value.size());
+    EXPECT_EQ(21, testvarg.value[0]);
+    EXPECT_EQ(13, testvarg.value.back());
+}
+
+TEST(parser_base, assignDelimitedKeyValueTooMany) 
+{ 
+    test_parser_base testparser;
+    argparser::listvarg<int> testvarg;
+    argparser::ArgEntry testArg = {"goo", "goo input value", "", (&testvarg), 2, 0, true, false};
+
+    parserstr valueTestString = "21,42,13";
+    size_t valueCount = testparser.countValueList(valueTestString);
+    parserstr failValue;
+    EXPECT_EQ(argparser::eAssignTooMany, testparser.assignDelimitedKeyValue(testArg, valueTestString, valueCount, failValue));
+    EXPECT_EQ(0, testvarg.value.size());
+}
+
+TEST(parser_base, assignDelimitedKeyValueBadInput) 
+{ 
+    test_parser_base testparser;
+    argparser::listvarg<int> testvarg;
+    argparser::ArgEntry testArg = {"goo", "goo input value", "", (&testvarg), 3, 0, true, false};
+
+    parserstr valueTestString = "21,13,moo";
+    size_t valueCount = testparser.countValueList(valueTestString);
+    parserstr failValue;
+    EXPECT_EQ(argparser::eAssignFailed, testparser.assignDelimitedKeyValue(testArg, valueTestString, valueCount, failValue));
+    EXPECT_EQ(2, testvarg.value.size());
+    EXPECT_STREQ("moo", failValue.c_str());
+}
+
 TEST(parser_base, displayArgHelpBlockNoWrap) 
 { 
     test_parser_base testparser;
@@ -573,4 +621,42 @@ TEST(parser_base, displayArgHelpBlockBothWrap1)
     EXPECT_STREQ("<--longkeyvalue>          Extra long key value with an  \n<--extralongkeyvalue>     extra long help text string   \n                          just to be sure               \n", output.c_str());
 }
 
+TEST(parser_base, runValidators)
+{
+    argparser::ArgEntry evenArg = {};
+    evenArg.name = "even";
+    evenArg.validator = [](std::string_view value) {return (!value.empty() && (((value.back() - '0') % 2) == 0));};
+
+    // Enough items for several batches on several threads
+    std::vector<std::string> valueList;
+    for (int valueIndex = 0; valueIndex < 200; valueIndex++)
+    {
+        valueList.push_back(std::to_string(valueIndex));
+    }
+
+    std::vector<argparser::validationItem> itemList;
+    for (size_t valueIndex = 0; valueIndex < valueList.size(); valueIndex++)
+    {
+        itemList.push_back({&evenArg, valueList[valueIndex], static_cast<int>(valueIndex), false});
+    }
+
+    EXPECT_EQ(100U, argparser::parser_base::runValidators(itemList, 4));
+    for (size_t valueIndex = 0; valueIndex < itemList.size(); valueIndex++)
+    {
+        EXPECT_EQ(((valueIndex % 2) == 0), itemList[valueIndex].valid);
+    }
+
+    std::vector<argparser::validationItem> emptyList;
+    EXPECT_EQ(0U, argparser::parser_base::runValidators(emptyList, 0));
+}
+
+TEST(parser_base, isReadablePath)
+{
+    EXPECT_TRUE(argparser::parser_base::isReadablePath("/"));
+    EXPECT_TRUE(argparser::parser_base::isReadablePath(std::string_view("/proc/self/status,other", 17)));
+    EXPECT_FALSE(argparser::parser_base::isReadablePath("/nonexistent/path"));
+    EXPECT_FALSE(argparser::parser_base::isReadablePath(""));
+    EXPECT_FALSE(argparser::parser_base::isReadablePath(std::string(5000, 'a')));
+}
+
 /** @} */
@@ -66,6 +66,22 @@ TEST(BaseParserStringList, printAssignmentFailedMessage)
     EXPECT_STREQ("\"--var 13\" assignment failed", output.c_str());
 }
 
+TEST(BaseParserStringList, printValidationFailedMessage)
+{
+    argparser::BaseParserStringList* testvar = argparser::BaseParserStringList::getInternationalizedClass();
+
+    parserstr output = testvar->getValidationFailedMessage("input", "/missing", 3);
+    EXPECT_STREQ("argv[3] \"input /missing\" validation failed", output.c_str());
+}
+
+TEST(BaseParserStringList, printInvalidUtf8Message)
+{
+    argparser::BaseParserStringList* testvar = argparser::BaseParserStringList::getInternationalizedClass();
+
+    parserstr output = testvar->getInvalidUtf8Message("argv[2]", 5);
+    EXPECT_STREQ("\"argv[2]\" invalid UTF-8 at byte 5", output.c_str());
+}
+
 TEST(BaseParserStringList, printMissingAssignmentMessage)
 {
     argparser::BaseParserStringList* testvar = argparser::BaseParserStringList::getInternationalizedClass();
@@ -0,0 +1,155 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file path_glob_test.cpp
+ * @ingroup argparser_unittest
+ * @defgroup Path glob expansion unit test
+ * @{
+ */
+
+// Includes
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "path_glob.h"
+#include <gtest/gtest.h>
+
+using namespace argparser;
+
+/**
+ * @brief Temporary directory tree
+ *
+ *   root/a.gz  root/b.txt  root/.hidden.gz
+ *   root/logs/c.gz  root/logs/old/d.gz  root/logs/old/e.txt
+ *   root/.cache/f.gz  root/link -> logs
+ */
+class pathGlobTree : public ::testing::Test
+{
+    protected:
+        std::string root;
+
+        void makeFile(const std::string& name)
+        {
+            int fd = open((root + "/" + name).c_str(), O_CREAT | O_WRONLY, 0644);
+            ASSERT_GE(fd, 0);
+            close(fd);
+        }
+
+        void SetUp() override
+        {
+            char path[] = "/tmp/path_glob_testXXXXXX";
+            ASSERT_NE(nullptr, mkdtemp(path));
+            root = path;
+            ASSERT_EQ(0, mkdir((root + "/logs").c_str(), 0755));
+            ASSERT_EQ(0, mkdir((root + "/logs/old").c_str(), 0755));
+            ASSERT_EQ(0, mkdir((root + "/.cache").c_str(), 0755));
+            ASSERT_EQ(0, symlink("logs", (root + "/link").c_str()));
+            for (const char* name : {"a.gz", "b.txt", ".hidden.gz", "logs/c.gz", "logs/old/d.gz", "logs/old/e.txt", ".cache/f.gz"})
+            {
+                makeFile(name);
+            }
+        }
+
+        void TearDown() override
+        {
+            EXPECT_EQ(0, system(("rm -rf " + root).c_str()));
+        }
+
+        std::vector<std::string> expand(const std::string& pattern, unsigned threadCount = 1)
+        {
+            std::vector<std::string> matches;
+            path_glob glob(root + "/" + pattern);
+            EXPECT_TRUE(glob.isValid());
+            size_t matchCount = glob.expand([&](std::string_view path) {matches.emplace_back(path.substr(root.size() + 1)); return true;}, true, threadCount);
+            EXPECT_EQ(matches.size(), matchCount);
+            return matches;
+        }
+};
+
+//======================================================================================
+// Public Interface testing
+//======================================================================================
+
+TEST(path_glob, hasGlobChars)
+{
+    EXPECT_FALSE(path_glob::hasGlobChars("logs/a.gz"));
+    EXPECT_FALSE(path_glob::hasGlobChars("logs/a\\*.gz"));
+    EXPECT_TRUE(path_glob::hasGlobChars("logs/*.gz"));
+    EXPECT_TRUE(path_glob::hasGlobChars("logs/?.gz"));
+    EXPECT_TRUE(path_glob::hasGlobChars("logs/[ab].gz"));
+}
+
+TEST(path_glob, compile)
+{
+    path_glob glob;
+    EXPECT_FALSE(glob.isValid());
+    EXPECT_EQ(0U, glob.expand([](std::string_view path) {return true;}));
+    EXPECT_TRUE(glob.compile("logs/**/*.gz"));
+    EXPECT_FALSE(glob.compile("logs/[a.gz"));
+    EXPECT_FALSE(glob.isValid());
+    EXPECT_FALSE(glob.compile("//"));
+}
+
+TEST_F(pathGlobTree, singleDirectory)
+{
+    EXPECT_EQ((std::vector<std::string>{"a.gz"}), expand("*.gz"));
+    EXPECT_EQ((std::vector<std::string>{".hidden.gz"}), expand(".*.gz"));
+    EXPECT_EQ((std::vector<std::string>{"a.gz", "b.txt"}), expand("?.*"));
+    EXPECT_EQ((std::vector<std::string>{"logs/c.gz", "logs/old"}), expand("logs/*"));
+    EXPECT_EQ((std::vector<std::string>{"link/c.gz"}), expand("l*k/*.gz"));
+    EXPECT_EQ((std::vector<std::string>{"b.txt"}), expand("b.txt"));
+    EXPECT_TRUE(expand("*.zip").empty());
+    EXPECT_TRUE(expand("missing/*.gz").empty());
+}
+
+TEST_F(pathGlobTree, anyDepth)
+{
+    // Level order, name order within each directory, no hidden or linked directories
+    std::vector<std::string> expected = {"a.gz", "logs/c.gz", "logs/old/d.gz"};
+    EXPECT_EQ(expected, expand("**/*.gz"));
+    EXPECT_EQ(expected, expand("**/*.gz", 4));
+    EXPECT_EQ(expected, expand("**/**/*.gz"));
+    EXPECT_EQ((std::vector<std::string>{"logs/old/d.gz"}), expand("**/old/*.gz"));
+    EXPECT_EQ((std::vector<std::string>{"logs/c.gz", "logs/old", "logs/old/d.gz", "logs/old/e.txt"}), expand("logs/**"));
+}
+
+TEST_F(pathGlobTree, repeatedAnyDepth)
+{
+    ASSERT_EQ(0, mkdir((root + "/logs/logs").c_str(), 0755));
+    makeFile("logs/logs/g.gz");
+    EXPECT_EQ((std::vector<std::string>{"logs/c.gz", "logs/logs/g.gz", "logs/old/d.gz"}), expand("**/logs/**/*.gz"));
+}
+
+TEST_F(pathGlobTree, stopExpansion)
+{
+    path_glob glob(root + "/**/*");
+    size_t callCount = 0;
+    EXPECT_EQ(2U, glob.expand([&](std::string_view path) {return (++callCount < 2);}, false, 2));
+    EXPECT_EQ(2U, callCount);
+}
+
+/** @} */
@@ -0,0 +1,132 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file schema_pool_test.cpp
+ * @ingroup argparser_unittest
+ * @defgroup Schema string pool unit test
+ * @{
+ */
+
+// Includes
+#include <string>
+#include <thread>
+#include "schema_pool.h"
+#include <gtest/gtest.h>
+
+using namespace argparser;
+
+//======================================================================================
+// Public Interface testing
+//======================================================================================
+
+static char writableText[] = "--writable";     ///< Writable static text, must be copied
+
+TEST(schemaPool, literalUsedInPlace)
+{
+    schema_pool testPool;
+    const char* literalText = "--schema-literal";
+
+    std::string_view stored = testPool.store(literalText);
+    EXPECT_EQ(literalText, stored.data());
+    EXPECT_EQ("--schema-literal", stored);
+
+    schemaPoolStats stats = testPool.getStats();
+    EXPECT_EQ(1U, stats.referencedCount);
+    EXPECT_EQ(16U, stats.referencedBytes);
+    EXPECT_EQ(0U, stats.copied.internCount);
+}
+
+TEST(schemaPool, dynamicTextCopied)
+{
+    schema_pool testPool;
+    std::string dynamicText = "--dynamic";
+
+    std::string_view stored = testPool.store(dynamicText);
+    EXPECT_NE(dynamicText.data(), stored.data());
+    EXPECT_EQ('\0', stored.data()[stored.size()]);
+    dynamicText = "--changed";
+    EXPECT_EQ("--dynamic", stored);
+
+    // Equal text shares the first copy
+    std::string sameText = "--dynamic";
+    EXPECT_EQ(stored.data(), testPool.store(sameText).data());
+
+    schemaPoolStats stats = testPool.getStats();
+    EXPECT_EQ(0U, stats.referencedCount);
+    EXPECT_EQ(2U, stats.copied.internCount);
+    EXPECT_EQ(1U, stats.copied.uniqueCount);
+}
+
+TEST(schemaPool, writableAndUnterminatedTextCopied)
+{
+    schema_pool testPool;
+
+    std::string_view stored = testPool.store(writableText);
+    EXPECT_NE(writableText, stored.data());
+    EXPECT_EQ("--writable", stored);
+
+    // A slice of a literal is not null terminated
+    std::string_view slice = std::string_view("--sliced,-s").substr(0, 8);
+    std::string_view storedSlice = testPool.store(slice);
+    EXPECT_NE(slice.data(), storedSlice.data());
+    EXPECT_EQ("--sliced", storedSlice);
+    EXPECT_EQ('\0', storedSlice.data()[storedSlice.size()]);
+
+    EXPECT_EQ(0U, testPool.getStats().referencedCount);
+    EXPECT_EQ(2U, testPool.getStats().copied.uniqueCount);
+}
+
+TEST(schemaPool, concurrentStore)
+{
+    schema_pool testPool;
+    auto worker = [&testPool](int threadIndex)
+    {
+        for (int index = 0; index < 500; index++)
+        {
+            testPool.store("--literal");
+            testPool.store("--shared" + std::to_string(index));
+            testPool.store("--thread" + std::to_string(threadIndex) + "_" + std::to_string(index));
+        }
+    };
+
+    std::thread firstThread(worker, 0);
+    std::thread secondThread(worker, 1);
+    firstThread.join();
+    secondThread.join();
+
+    schemaPoolStats stats = testPool.getStats();
+    EXPECT_EQ(1000U, stats.referencedCount);
+    EXPECT_EQ(2000U, stats.copied.internCount);
+    EXPECT_EQ(1500U, stats.copied.uniqueCount);
+}
+
+TEST(schemaPool, readOnlyData)
+{
+    char stackText[] = "stack";
+    EXPECT_TRUE(schema_pool::isReadOnlyData("read only", 10));
+    EXPECT_FALSE(schema_pool::isReadOnlyData(stackText, sizeof(stackText)));
+    EXPECT_FALSE(schema_pool::isReadOnlyData(writableText, sizeof(writableText)));
+    EXPECT_FALSE(schema_pool::isReadOnlyData(nullptr, 1));
+}
+
+/** @} */
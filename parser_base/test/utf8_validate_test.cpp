@@ -0,0 +1,159 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file utf8_validate_test.cpp
+ * @ingroup argparser_unittest
+ * @defgroup UTF-8 validation unit test
+ * @{
+ */
+
+// Includes
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "utf8_validate.h"
+#include <gtest/gtest.h>
+
+using namespace argparser;
+
+/**
+ * @brief Reference UTF-8 check, decodes each sequence and checks the code point
+ *
+ * @param text - String to check
+ *
+ * @return size_t - Offset of the first invalid sequence or utf8Valid
+ */
+static size_t referenceFindInvalid(const std::string& text)
+{
+    size_t index = 0;
+    while (index < text.size())
+    {
+        const auto leadByte = static_cast<unsigned char>(text[index]);
+        size_t sequenceLength = ((leadByte < 0x80) ? 1 : (leadByte >> 5) == 0x06 ? 2 : (leadByte >> 4) == 0x0E ? 3 : (leadByte >> 3) == 0x1E ? 4 : 0);
+        if ((sequenceLength == 0) || ((index + sequenceLength) > text.size()))
+        {
+            return index;
+        }
+
+        uint32_t codePoint = ((sequenceLength == 1) ? leadByte : (leadByte & (0x7F >> sequenceLength)));
+        for (size_t followIndex = 1; followIndex < sequenceLength; followIndex++)
+        {
+            const auto followByte = static_cast<unsigned char>(text[index + followIndex]);
+            if ((followByte & 0xC0) != 0x80)
+            {
+                return index;
+            }
+            codePoint = (codePoint << 6) | (followByte & 0x3F);
+        }
+
+        const uint32_t minCodePoint[] = {0, 0, 0x80, 0x800, 0x10000};
+        if ((codePoint < minCodePoint[sequenceLength]) || (codePoint > 0x10FFFF) || ((codePoint >= 0xD800) && (codePoint <= 0xDFFF)))
+        {
+            return index;
+        }
+        index += sequenceLength;
+    }
+    return utf8Valid;
+}
+
+//======================================================================================
+// Public Interface testing
+//======================================================================================
+
+TEST(utf8_validate, validText)
+{
+    EXPECT_TRUE(isValidUtf8(""));
+    EXPECT_TRUE(isValidUtf8("plain ascii --key=value"));
+    EXPECT_TRUE(isValidUtf8("caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 \xF4\x8F\xBF\xBF \xED\x9F\xBF"));
+
+    // Every block boundary split of a multi byte sequence
+    std::string multiByte;
+    for (int index = 0; index < 40; index++)
+    {
+        multiByte += "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+    }
+    for (size_t padLength = 0; padLength < 32; padLength++)
+    {
+        std::string text = std::string(padLength, 'x') + multiByte;
+        EXPECT_EQ(utf8Valid, findInvalidUtf8(text.data(), text.size())) << padLength;
+    }
+}
+
+TEST(utf8_validate, invalidSequences)
+{
+    const std::vector<std::string> invalidList = {
+        "\x80",                 // Stray continuation
+        "\xC0\xAF",             // Overlong two byte
+        "\xC1\xBF",
+        "\xE0\x9F\xBF",         // Overlong three byte
+        "\xED\xA0\x80",         // Surrogate
+        "\xF0\x8F\xBF\xBF",     // Overlong four byte
+        "\xF4\x90\x80\x80",     // Above U+10FFFF
+        "\xF5\x80\x80\x80",
+        "\xFF",
+        "\xC3",                 // Truncated
+        "\xE2\x82",
+        "\xF0\x9F\x98",
+        "\xC3\x28",             // Missing continuation
+        "\xE2\x28\xA1",
+        "\xE2\x82\x28",
+        "\xF0\x9F\x98\x28",
+    };
+
+    // Each sequence at every position of a mixed ASCII and multi byte background
+    for (auto const& invalid : invalidList)
+    {
+        for (size_t errorPos = 0; errorPos < 100; errorPos++)
+        {
+            std::string text(errorPos, 'x');
+            for (size_t index = 0; (index + 2) < errorPos; index += 7)
+            {
+                text.replace(index, 2, "\xC3\xA9");
+            }
+            text += invalid;
+            text += std::string(errorPos % 37, 'y');
+            EXPECT_EQ(errorPos, findInvalidUtf8(text.data(), text.size())) << errorPos;
+            EXPECT_EQ(referenceFindInvalid(text), findInvalidUtf8(text.data(), text.size())) << errorPos;
+        }
+    }
+}
+
+TEST(utf8_validate, randomText)
+{
+    const std::vector<std::string> pieceList = {"a", "bc", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\xED\x9F\xBF", "\x80", "\xC3", "\xED\xA0\x80", "\xF4\x90\x80\x80"};
+    srand(1234);
+    for (int testIndex = 0; testIndex < 2000; testIndex++)
+    {
+        std::string text;
+        const size_t pieceCount = static_cast<size_t>(rand() % 80);
+        for (size_t index = 0; index < pieceCount; index++)
+        {
+            // Mostly valid pieces
+            size_t pieceIndex = static_cast<size_t>(rand() % 64);
+            text += pieceList[(pieceIndex < 6) ? pieceIndex : ((pieceIndex < 60) ? 0 : (pieceIndex - 54))];
+        }
+        EXPECT_EQ(referenceFindInvalid(text), findInvalidUtf8(text.data(), text.size())) << testIndex;
+    }
+}
+
+/** @} */
@@ -288,7 +288,6 @@ TEST(sample3, example6)
     expectedStr += " -h,--help,-?           show this help message and exit      \n";
     expectedStr += " -V,--version           Example of a simple true/false flag  \n";
     expectedStr += "                        argument                             \n";
-    expectedStr += " -h,--help,-?           show this help message and exit      \n";
     expectedStr += " -o, --output=argString Example of a switched string argument\n\n";
     expectedStr += "Positional Arguments:\n";
     expectedStr += " subcommand             Example of a positional argument as  \n";
@@ -0,0 +1,152 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file enum_name_table.h
+ * @ingroup libvarg
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace argparser
+{
+
+/**
+ * @brief Enum name to value lookup table.  Names are held in a contiguous
+ *        vector that is sorted once after registration, lookups are a binary
+ *        search of a string_view and do not allocate.
+ */
+template <typename T> class enumNameTable
+{
+    private:
+        using tableEntry = std::pair<std::string, T>;
+
+        std::vector<tableEntry>     nameTable;      ///< Enum name to value table, sorted by name before the first lookup
+        bool                        ignoreCase;     ///< True if the name matching is case insensitive
+        bool                        tableSorted;    ///< True if nameTable is sorted and has no duplicate names
+
+        /**
+         * @brief Compare two enum names using the selected case matching
+         *
+         * @param leftName  - First name to compare
+         * @param rightName - Second name to compare
+         *
+         * @return int - <0 if leftName sorts first, 0 if the names match, >0 if rightName sorts first
+         */
+        int compareNames(std::string_view leftName, std::string_view rightName) const
+        {
+            if (!ignoreCase)
+            {
+                return leftName.compare(rightName);
+            }
+
+            const size_t compareLength = std::min(leftName.size(), rightName.size());
+            for (size_t index = 0; index < compareLength; index++)
+            {
+                const int leftChar  = tolower(static_cast<unsigned char>(leftName[index]));
+                const int rightChar = tolower(static_cast<unsigned char>(rightName[index]));
+                if (leftChar != rightChar)
+                {
+                    return leftChar - rightChar;
+                }
+            }
+            return ((leftName.size() < rightName.size()) ? -1 : ((leftName.size() > rightName.size()) ? 1 : 0));
+        }
+
+    public:
+        /**
+         * @brief Construct an empty name table
+         *
+         * @param caseInsensitive - True to match the enum names without regard to case
+         */
+        enumNameTable(bool caseInsensitive = false) : nameTable(), ignoreCase(caseInsensitive), tableSorted(true) {}
+
+        /**
+         * @brief Add a name to the table.  If the name is already assigned the first value is kept.
+         *
+         * @param entryName - Name of the enum value
+         * @param enumValue - Value to assign for the name
+         */
+        void addName(const char* entryName, T enumValue)
+        {
+            nameTable.emplace_back(entryName, enumValue);
+            tableSorted = false;
+        }
+
+        /**
+         * @brief Sort the name table and remove duplicate names.  Called automatically
+         *        by the first find() after an addName() call.
+         */
+        void build()
+        {
+            std::stable_sort(nameTable.begin(), nameTable.end(),
+                             [this](const tableEntry& leftEntry, const tableEntry& rightEntry)
+                             {return (compareNames(leftEntry.first, rightEntry.first) < 0);});
+            auto newEnd = std::unique(nameTable.begin(), nameTable.end(),
+                                      [this](const tableEntry& leftEntry, const tableEntry& rightEntry)
+                                      {return (compareNames(leftEntry.first, rightEntry.first) == 0);});
+            nameTable.erase(newEnd, nameTable.end());
+            nameTable.shrink_to_fit();
+            tableSorted = true;
+        }
+
+        /**
+         * @brief Find the value for a name
+         *
+         * @param searchName - Name to find, does not need to be null terminated
+         *
+         * @return const T* - Pointer to the value or nullptr if the name is not in the table
+         */
+        const T* find(std::string_view searchName)
+        {
+            if (!tableSorted)
+            {
+                build();
+            }
+
+            auto entry = std::lower_bound(nameTable.begin(), nameTable.end(), searchName,
+                                          [this](const tableEntry& currentEntry, std::string_view key)
+                                          {return (compareNames(currentEntry.first, key) < 0);});
+            return (((entry != nameTable.end()) && (compareNames(entry->first, searchName) == 0)) ? &entry->second : nullptr);
+        }
+
+        /**
+         * @brief Get the number of names in the table
+         *
+         * @return size_t - Number of names, including duplicates not yet removed by build()
+         */
+        size_t size() const                                 {return nameTable.size();}
+};
+
+}; // end of namespace argparser
+
+/** @} */
@@ -0,0 +1,190 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file flat_string_map.h
+ * @ingroup libvarg
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace argparser
+{
+
+/**
+ * @brief String keyed open addressing hash map.  Entries are held in one
+ *        contiguous slot vector with linear probing, lookups hash a string_view
+ *        and do not allocate.
+ *
+ * Only the insert, lookup and iteration operations used by the argument value
+ * types are provided, entries are never erased individually.
+ */
+template <typename V> class flat_string_map
+{
+    private:
+        /**
+         * @brief Hash table slot
+         */
+        struct mapSlot
+        {
+            std::string     key;        ///< Entry key
+            V               value;      ///< Entry value
+            bool            used;       ///< True if the slot holds an entry
+        };
+
+        std::vector<mapSlot>    slots;          ///< Slot table, size is zero or a power of two
+        size_t                  entryCount;     ///< Number of used slots
+
+        /**
+         * @brief Find the slot for a key
+         *
+         * @param key - Key to find
+         *
+         * @return size_t - Index of the slot holding the key or of the empty slot where it belongs
+         */
+        size_t findSlot(std::string_view key) const
+        {
+            const size_t mask = slots.size() - 1;
+            size_t index = std::hash<std::string_view>{}(key) & mask;
+            while (slots[index].used && (slots[index].key != key))
+            {
+                index = (index + 1) & mask;
+            }
+            return index;
+        }
+
+        /**
+         * @brief Move the entries to a larger slot table
+         *
+         * @param newSlotCount - New slot table size, a power of two
+         */
+        void rehash(size_t newSlotCount)
+        {
+            std::vector<mapSlot> oldSlots(newSlotCount);
+            oldSlots.swap(slots);
+            for (auto& oldSlot : oldSlots)
+            {
+                if (oldSlot.used)
+                {
+                    slots[findSlot(oldSlot.key)] = std::move(oldSlot);
+                }
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct an empty map, no slot table is allocated until the first insert
+         */
+        flat_string_map() : slots(), entryCount(0) {}
+
+        /**
+         * @brief Insert a new entry or find the existing entry for a key
+         *
+         * @param key   - Entry key
+         * @param value - Value to store if the key is new
+         *
+         * @return std::pair<V*, bool> - Pointer to the entry value and true if the entry was inserted,
+         *                               false if the key was already present
+         */
+        std::pair<V*, bool> insert(std::string_view key, V value)
+        {
+            // Keep the load factor at or below 3/4
+            if (((entryCount + 1) * 4) > (slots.size() * 3))
+            {
+                rehash((slots.empty()) ? 8 : (slots.size() * 2));
+            }
+
+            mapSlot& slot = slots[findSlot(key)];
+            if (slot.used)
+            {
+                return {&slot.value, false};
+            }
+
+            slot.key   = key;
+            slot.value = std::move(value);
+            slot.used  = true;
+            entryCount++;
+            return {&slot.value, true};
+        }
+
+        /**
+         * @brief Find the value for a key
+         *
+         * @param key - Key to find
+         *
+         * @return const V* - Pointer to the value or nullptr if the key is not present
+         */
+        const V* find(std::string_view key) const
+        {
+            if (slots.empty())
+            {
+                return nullptr;
+            }
+
+            const mapSlot& slot = slots[findSlot(key)];
+            return ((slot.used) ? &slot.value : nullptr);
+        }
+
+        /**
+         * @brief Call a function for each entry, in slot order
+         *
+         * @param function - Callable taking (const std::string& key, const V& value)
+         */
+        template <typename Function> void forEach(Function function) const
+        {
+            for (auto const& slot : slots)
+            {
+                if (slot.used)
+                {
+                    function(slot.key, slot.value);
+                }
+            }
+        }
+
+        // Capacity
+        bool    empty() const                               {return (entryCount == 0);}
+        size_t  size() const                                {return entryCount;}
+
+        /**
+         * @brief Remove all entries and release the slot table
+         */
+        void clear()
+        {
+            slots.clear();
+            slots.shrink_to_fit();
+            entryCount = 0;
+        }
+};
+
+}; // end of namespace argparser
+
+/** @} */
@@ -0,0 +1,127 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file heap_usage.h
+ * @ingroup libvarg
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace argparser
+{
+
+/**
+ * @brief Heap memory held by an object, the object itself is not included
+ */
+struct heapUsage
+{
+    size_t      bytes;              ///< Number of heap bytes held
+    size_t      allocations;        ///< Number of heap blocks held
+
+    /**
+     * @brief Add the usage of another object
+     *
+     * @param other - Usage to add
+     *
+     * @return heapUsage& - This object
+     */
+    heapUsage& operator+=(const heapUsage& other)   {bytes += other.bytes; allocations += other.allocations; return *this;}
+};
+
+/**
+ * @brief Get the heap memory held by a string, short strings are kept inside the string object
+ *
+ * @param text - String to measure
+ *
+ * @return heapUsage - String storage block, if any
+ */
+inline heapUsage getStringHeapUsage(const std::string& text)
+{
+    return ((text.capacity() > std::string().capacity()) ? heapUsage{text.capacity() + 1, 1} : heapUsage{0, 0});
+}
+
+/**
+ * @brief Container trait, true if the container elements are contiguous and it reports a capacity
+ */
+template <typename Container, typename = void> struct heapUsageIsContiguous : std::false_type {};
+template <typename Container> struct heapUsageIsContiguous<Container, std::void_t<decltype(std::declval<const Container&>().data()),
+                                                                                  decltype(std::declval<const Container&>().capacity())>> : std::true_type {};
+
+/**
+ * @brief Get the heap memory held by a value container and its string elements.
+ *        Contiguous storage that points inside the container object, such as an
+ *        inline_vector within its inline capacity, holds no heap memory.  Node
+ *        based storage is counted as one block per element.
+ *
+ * @param container - Container to measure
+ *
+ * @return heapUsage - Estimated container storage
+ */
+template <typename Container> heapUsage getContainerHeapUsage(const Container& container)
+{
+    using elementType = typename Container::value_type;
+    heapUsage usage{0, 0};
+
+    if constexpr (std::is_same_v<Container, std::vector<bool>>)
+    {
+        if (container.capacity() != 0)
+        {
+            usage = {(container.capacity() + 7) / 8, 1};
+        }
+    }
+    else if constexpr (heapUsageIsContiguous<Container>::value)
+    {
+        const char* objectStart = reinterpret_cast<const char*>(&container);
+        const char* dataStart = reinterpret_cast<const char*>(container.data());
+        const bool  isInline = ((dataStart >= objectStart) && (dataStart < (objectStart + sizeof(Container))));
+        if ((container.capacity() != 0) && !isInline)
+        {
+            usage = {container.capacity() * sizeof(elementType), 1};
+        }
+    }
+    else
+    {
+        usage = {container.size() * sizeof(elementType), container.size()};
+    }
+
+    if constexpr (std::is_same_v<elementType, std::string>)
+    {
+        for (const std::string& element : container)
+        {
+            usage += getStringHeapUsage(element);
+        }
+    }
+    return usage;
+}
+
+}; // end of namespace argparser
+
+/** @} */
@@ -0,0 +1,310 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file inline_vector.h
+ * @ingroup libvarg
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace argparser
+{
+
+/**
+ * @brief Contiguous vector container that keeps the first N elements in an
+ *        inline buffer and only allocates heap storage when it grows past N.
+ *
+ * Only the subset of the std::vector interface used by the list argument
+ * storage policies is provided.
+ */
+template <typename T, size_t N> class inline_vector
+{
+    static_assert(N > 0, "inline_vector requires an inline capacity of at least one element");
+
+    public:
+        using value_type      = T;
+        using size_type       = size_t;
+        using reference       = T&;
+        using const_reference = const T&;
+        using pointer         = T*;
+        using const_pointer   = const T*;
+        using iterator        = T*;
+        using const_iterator  = const T*;
+
+    private:
+        alignas(T) unsigned char    inlineBuffer[N * sizeof(T)];    ///< Inline element storage
+        T*                          elementData;                    ///< Current element storage, inline or heap
+        size_t                      elementCount;                   ///< Number of constructed elements
+        size_t                      elementCapacity;                ///< Capacity of the current element storage
+
+        T* getInlineData()                          {return reinterpret_cast<T*>(inlineBuffer);}
+
+        /**
+         * @brief Move the current elements to a new storage block of at least newCapacity elements
+         *
+         * @param newCapacity - Required capacity
+         */
+        void reallocate(size_t newCapacity)
+        {
+            T* newData = std::allocator<T>().allocate(newCapacity);
+            std::uninitialized_move(elementData, elementData + elementCount, newData);
+            std::destroy(elementData, elementData + elementCount);
+            releaseStorage();
+
+            elementData = newData;
+            elementCapacity = newCapacity;
+        }
+
+        /**
+         * @brief Free the heap storage block if one is in use, the elements must already be destroyed
+         */
+        void releaseStorage()
+        {
+            if (!isInline())
+            {
+                std::allocator<T>().deallocate(elementData, elementCapacity);
+            }
+            elementData = getInlineData();
+            elementCapacity = N;
+        }
+
+        /**
+         * @brief Make sure there is room for growthCount more elements, grow geometrically
+         *
+         * @param growthCount - Number of elements about to be added
+         */
+        void growFor(size_t growthCount)
+        {
+            if ((elementCount + growthCount) > elementCapacity)
+            {
+                reallocate(std::max(elementCapacity * 2, elementCount + growthCount));
+            }
+        }
+
+        /**
+         * @brief Take over the elements of another vector, this vector must be empty and inline
+         *
+         * @param other - Vector to take the elements from, left empty
+         */
+        void takeElements(inline_vector& other)
+        {
+            if (!other.isInline())
+            {
+                // Take over the heap block
+                elementData = other.elementData;
+                elementCount = other.elementCount;
+                elementCapacity = other.elementCapacity;
+                other.elementData = other.getInlineData();
+                other.elementCount = 0;
+                other.elementCapacity = N;
+            }
+            else
+            {
+                std::uninitialized_move(other.begin(), other.end(), elementData);
+                elementCount = other.elementCount;
+                other.clear();
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct an empty inline vector
+         */
+        inline_vector() : elementData(getInlineData()), elementCount(0), elementCapacity(N) {}
+
+        inline_vector(const inline_vector& other) : inline_vector()
+        {
+            reserve(other.elementCount);
+            std::uninitialized_copy(other.begin(), other.end(), elementData);
+            elementCount = other.elementCount;
+        }
+
+        inline_vector(inline_vector&& other) noexcept : inline_vector()
+        {
+            takeElements(other);
+        }
+
+        inline_vector& operator=(const inline_vector& other)
+        {
+            if (this != &other)
+            {
+                clear();
+                reserve(other.elementCount);
+                std::uninitialized_copy(other.begin(), other.end(), elementData);
+                elementCount = other.elementCount;
+            }
+            return *this;
+        }
+
+        inline_vector& operator=(inline_vector&& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                releaseStorage();
+                takeElements(other);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Destroy the elements and release any heap storage
+         */
+        ~inline_vector()
+        {
+            clear();
+            releaseStorage();
+        }
+
+        // Element access
+        T*          data()                                  {return elementData;}
+        const T*    data() const                            {return elementData;}
+        T&          operator[](size_t index)                {return elementData[index];}
+        const T&    operator[](size_t index) const          {return elementData[index];}
+        T&          front()                                 {return elementData[0];}
+        const T&    front() const                           {return elementData[0];}
+        T&          back()                                  {return elementData[elementCount - 1];}
+        const T&    back() const                            {return elementData[elementCount - 1];}
+
+        // Iterators
+        iterator        begin()                             {return elementData;}
+        const_iterator  begin() const                       {return elementData;}
+        iterator        end()                               {return elementData + elementCount;}
+        const_iterator  end() const                         {return elementData + elementCount;}
+
+        // Capacity
+        bool    empty() const                               {return (elementCount == 0);}
+        size_t  size() const                                {return elementCount;}
+        size_t  capacity() const                            {return elementCapacity;}
+
+        /**
+         * @brief Check if the elements are held in the inline buffer
+         *
+         * @return true  - Elements are in the inline buffer, no heap storage is in use
+         * @return false - Elements are in a heap storage block
+         */
+        bool    isInline() const                            {return (elementData == reinterpret_cast<const T*>(inlineBuffer));}
+
+        /**
+         * @brief Make sure the storage can hold at least newCapacity elements
+         *
+         * @param newCapacity - Minimum number of elements
+         */
+        void reserve(size_t newCapacity)
+        {
+            if (newCapacity > elementCapacity)
+            {
+                reallocate(newCapacity);
+            }
+        }
+
+        // Modifiers
+        void clear()
+        {
+            std::destroy(elementData, elementData + elementCount);
+            elementCount = 0;
+        }
+
+        void push_back(const T& element)                    {emplace_back(element);}
+        void push_back(T&& element)                         {emplace_back(std::move(element));}
+
+        template <typename... Args> T& emplace_back(Args&&... args)
+        {
+            if (elementCount == elementCapacity)
+            {
+                // Construct first in case args refers to an existing element
+                T newElement(std::forward<Args>(args)...);
+                growFor(1);
+                new (elementData + elementCount) T(std::move(newElement));
+            }
+            else
+            {
+                new (elementData + elementCount) T(std::forward<Args>(args)...);
+            }
+            return elementData[elementCount++];
+        }
+
+        void pop_back()
+        {
+            elementCount--;
+            std::destroy_at(elementData + elementCount);
+        }
+
+        /**
+         * @brief Insert a range of elements before position
+         *
+         * @param position - Insert position
+         * @param first    - First element of the range to insert
+         * @param last     - End of the range to insert
+         *
+         * @return iterator - Iterator to the first inserted element
+         */
+        template <typename InputIt> iterator insert(const_iterator position, InputIt first, InputIt last)
+        {
+            const size_t insertIndex = static_cast<size_t>(position - elementData);
+            const size_t oldCount = elementCount;
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+            {
+                growFor(static_cast<size_t>(std::distance(first, last)));
+            }
+
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+            std::rotate(elementData + insertIndex, elementData + oldCount, elementData + elementCount);
+            return elementData + insertIndex;
+        }
+
+        /**
+         * @brief Erase a range of elements
+         *
+         * @param first - First element to erase
+         * @param last  - End of the range to erase
+         *
+         * @return iterator - Iterator to the element following the erased range
+         */
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            T* eraseStart = elementData + (first - elementData);
+            T* eraseEnd   = elementData + (last - elementData);
+            T* newEnd     = std::move(eraseEnd, end(), eraseStart);
+            std::destroy(newEnd, end());
+            elementCount = static_cast<size_t>(newEnd - elementData);
+            return eraseStart;
+        }
+};
+
+}; // end of namespace argparser
+
+/** @} */
@@ -0,0 +1,152 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file internlistvarg.h
+ * @ingroup libvarg
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstring>
+#include <string_view>
+#include <vector>
+#include "varg_intf.h"
+#include "string_pool.h"
+
+namespace argparser
+{
+/**
+ * @brief String list argument with interned values.  Each value is stored once
+ *        in a shared string_pool and the list holds views of the pooled copies,
+ *        so repeated values such as host names do not allocate a new string.
+ *        The views are valid until the pool is cleared or destroyed.
+ */
+class internlistvarg : public varg_intf
+{
+    private:
+        string_pool*                    pool;       ///< Value string pool, not owned
+
+    public:
+        std::vector<std::string_view>   value;      ///< Current saved list values, views into the pool
+
+        /**
+         * @brief Construct an interned string list argument
+         *
+         * @param stringPool - Pool the values are interned in, for example the parser getStringPool().
+         *                     The pool must outlive the argument values.
+         */
+        explicit internlistvarg(string_pool& stringPool) : varg_intf(), pool(&stringPool), value()
+        {
+            setTypeFormat(typeStringFormat_e::TYPE_FMT_STRING);
+        }
+
+        /**
+         * @brief Destroy the internlistvarg object
+         */
+        virtual ~internlistvarg() = default;
+
+        /**
+         * @brief Return if varg is a list of elements or a single element type
+         *
+         * @return true - List type variable, multiple arguement values are allowed
+         */
+        virtual bool isList() const                                 {return true;}
+
+        /**
+         * @brief Intern the input string and append the pooled view
+         *
+         * @param newValue - Input character string
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e - String values always succeed
+         */
+        virtual valueParseStatus_e setValue(const char* newValue)
+        {
+            value.push_back(pool->intern(newValue));
+            return valueParseStatus_e::PARSE_SUCCESS_e;
+        }
+
+        /**
+         * Virtual interface method implementation for the setValue function
+         *
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - Lists do not have a default set value
+         */
+        virtual valueParseStatus_e setValue()                       {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
+
+        /**
+         * @brief Intern each value of a delimited value buffer in order, the buffer slices
+         *        are looked up directly without a temporary string copy
+         *
+         * @param buffer      - Pointer to the delimited value buffer, does not need to be null terminated
+         * @param length      - Length of the value buffer in characters
+         * @param delimiter   - Value list delimiter character
+         * @param failedIndex - Not used, the assignment can not fail
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e - String values always succeed
+         */
+        virtual valueParseStatus_e setValueBuffer(const char* buffer, size_t length, char delimiter, size_t& /* failedIndex */)
+        {
+            size_t startPos = 0;
+            while (startPos < length)
+            {
+                const char* delimiterPtr = static_cast<const char*>(memchr(buffer + startPos, delimiter, length - startPos));
+                size_t      endPos       = ((delimiterPtr != nullptr) ? static_cast<size_t>(delimiterPtr - buffer) : length);
+                value.push_back(pool->intern(std::string_view(buffer + startPos, endPos - startPos)));
+                startPos = endPos + 1;
+            }
+            return valueParseStatus_e::PARSE_SUCCESS_e;
+        }
+
+        /**
+         * Virtual interface method implementation for the isEmpty function
+         *
+         * @return true - if the list is empty
+         * @return false - if list is not empty
+         */
+        virtual bool isEmpty()                                      {return value.empty();}
+
+        /**
+         * @brief Reserve room for additional values
+         *
+         * @param additionalCount - Number of values about to be added
+         */
+        virtual void reserveValues(size_t additionalCount)          {reserveAdditional(value, additionalCount);}
+
+        /**
+         * @brief Get the heap memory held by the argument, the view list only.  The
+         *        string text is held by the pool, see string_pool::getHeapUsage().
+         *
+         * @return heapUsage - Heap bytes and blocks held by the argument
+         */
+        virtual heapUsage getHeapUsage() const
+        {
+            heapUsage usage = varg_intf::getHeapUsage();
+            usage += getContainerHeapUsage(value);
+            return usage;
+        }
+};
+
+}; // end of namespace argparser
+
+/** @} */
@@ -30,108 +30,260 @@
 
 // Includes
 #include <stdlib.h>
-#include <list>
+#include <cstring>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
 #include "varg_intf.h"
+#include "inline_vector.h"
+#include "parallel_work.h"
 
 namespace argparser
 {
 
+constexpr size_t listParallelDefaultThreshold = 64 * 1024;     ///< Default minimum value buffer length for parallel conversion
+constexpr size_t listParallelChunksPerWorker = 4;               ///< Number of conversion chunks to create for each worker thread
+constexpr size_t listInlineDefaultCapacity = 8;                 ///< Default inline element capacity of the inline storage policy
+
 /**
- * @brief Variable list argument type template class
+ * @brief Storage policy trait, true if the storage type has a reserve(size_t) method
  */
-template <typename T> class listvarg : public varg_intf
+template <typename Storage, typename = void> struct listStorageHasReserve : std::false_type {};
+template <typename Storage> struct listStorageHasReserve<Storage, std::void_t<decltype(std::declval<Storage&>().reserve(size_t()))>> : std::true_type {};
+
+/**
+ * @brief Storage policy trait, true if the storage type elements are contiguous and accessible through data()
+ */
+template <typename Storage, typename = void> struct listStorageIsContiguous : std::false_type {};
+template <typename Storage> struct listStorageIsContiguous<Storage, std::void_t<decltype(std::declval<Storage&>().data())>> : std::true_type {};
+
+/**
+ * @brief List argument element conversion base class.  Holds the per type value
+ *        limits and element conversion independent of the list storage policy.
+ */
+template <typename T> class listvarg_base : public varg_intf
 {
     protected:
         /**
-         * @brief Set the value of a signed element and add the new element to the value list object
+         * @brief Convert the input string to an element value without adding it to the list
          *
          * @param newValue - Pointer to the text value string
+         * @param element  - Converted element value if the conversion succeeded
          *
-         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully converted
          * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
          * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value exceeds lower value limit
          * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value exceeds upper value limit
          */
-        valueParseStatus_e setSignedElementValue(const char* newValue);
+        valueParseStatus_e convertElement(const char* newValue, T& element) const;
 
         /**
-         * @brief Set the value of an unsigned list element and add the new element to the value list object
+         * @brief Convert a signed element input string without adding it to the list
          *
          * @param newValue - Pointer to the text value string
+         * @param element  - Converted element value if the conversion succeeded
          *
-         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
-         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
-         * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value exceeds lower value limit
-         * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value exceeds upper value limit
+         * @return valueParseStatus_e - Conversion status
          */
-        valueParseStatus_e setUnsignedElementValue(const char* newValue);
+        valueParseStatus_e convertSignedElement(const char* newValue, T& element) const;
 
         /**
-         * @brief Set the value of a double list element and add the new element to the value list object
+         * @brief Convert an unsigned element input string without adding it to the list
          *
          * @param newValue - Pointer to the text value string
+         * @param element  - Converted element value if the conversion succeeded
          *
-         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
-         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
-         * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value exceeds lower value limit
-         * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value exceeds upper value limit
+         * @return valueParseStatus_e - Conversion status
          */
-        valueParseStatus_e setDoubleElementValue(const char* newValue);
+        valueParseStatus_e convertUnsignedElement(const char* newValue, T& element) const;
 
+    public:
         /**
-         * @brief Set the value of a boolean element and add the new element to the value list object
-         *
-         * @param newValue - input argument string
+         * @brief Construct a list argument base object, sets the type limits and type string
+         */
+        listvarg_base();
+
+        /**
+         * @brief Destroy the list argument base object
+         */
+        virtual ~listvarg_base() = default;
+
+        /**
+         * @brief Return if varg is a list of elements or a single element type
          *
-         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
-         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
-         * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value exceeds lower value limit
-         * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value exceeds upper value limit
+         * @return true - List type variable, multiple arguement values are allowed
+         * @return false - Only 0 or 1 argument values are allowed.
          */
-        valueParseStatus_e setBoolElementValue(const char* newValue);
+        virtual bool isList() const                                     {return true;}
 
         /**
-         * @brief Set the Element Value object
+         * Virtual interface method implementation for the template variable implementation setValue function
          *
-         * @param newValue - input argument string
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - Lists do not have a default set value
+         */
+        virtual valueParseStatus_e setValue()                           {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
+};
+
+/**
+ * @brief Variable list argument type template class
+ *
+ * @tparam T       - Element type
+ * @tparam Storage - Value storage policy, any sequence container with push_back(),
+ *                   insert(end, first, last), size(), empty() and clear().  Storage
+ *                   with reserve() is pre-sized from the known value count.
+ */
+template <typename T, typename Storage = std::vector<T>> class listvarg : public listvarg_base<T>
+{
+    private:
+        size_t      parallelThreshold = 0;      ///< Minimum value buffer length for parallel conversion, 0 = disabled
+        unsigned    parallelThreads = 0;        ///< Maximum number of conversion threads, 0 = hardware concurrency
+
+        /**
+         * @brief Parallel conversion chunk data
+         */
+        struct conversionChunk
+        {
+            const char*         start;          ///< Start of the chunk in the value buffer
+            size_t              length;         ///< Length of the chunk, always ends on a delimiter or the buffer end
+            std::vector<T>      values;         ///< Converted chunk values
+            size_t              failedIndex;    ///< Chunk relative index of the first failed element
+            valueParseStatus_e  status;         ///< Conversion status of the first failed element
+        };
+
+        /**
+         * @brief Convert all of the elements in a chunk, stop at the first conversion failure
          *
-         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
-         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
-         * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value exceeds lower value limit
-         * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value exceeds upper value limit
+         * @param chunk     - Chunk to convert
+         * @param delimiter - Value list delimiter character
          */
-        valueParseStatus_e setCharElementValue(const char* newValue);
+        void convertChunk(conversionChunk& chunk, char delimiter) const
+        {
+            std::string element;
+            size_t      startPos = 0;
+
+            // Reserve the value storage from the element count
+            size_t elementCount = 0;
+            for (const char* searchPtr = chunk.start;
+                 (searchPtr = static_cast<const char*>(memchr(searchPtr, delimiter, chunk.length - (searchPtr - chunk.start)))) != nullptr;
+                 searchPtr++)
+            {
+                elementCount++;
+            }
+            chunk.values.reserve(elementCount + 1);
+
+            chunk.status = valueParseStatus_e::PARSE_SUCCESS_e;
+            while (startPos < chunk.length)
+            {
+                const char* delimiterPtr = static_cast<const char*>(memchr(chunk.start + startPos, delimiter, chunk.length - startPos));
+                size_t      endPos       = ((delimiterPtr != nullptr) ? static_cast<size_t>(delimiterPtr - chunk.start) : chunk.length);
+
+                T elementValue{};
+                element.assign(chunk.start + startPos, endPos - startPos);
+                chunk.status = listvarg_base<T>::convertElement(element.c_str(), elementValue);
+                if (chunk.status != valueParseStatus_e::PARSE_SUCCESS_e)
+                {
+                    chunk.failedIndex = chunk.values.size();
+                    break;
+                }
+                chunk.values.push_back(std::move(elementValue));
+                startPos = endPos + 1;
+            }
+        }
 
         /**
-         * @brief Set the value of a string element and add the new element to the value list object
+         * @brief Split the value buffer at delimiter boundaries and convert the pieces in parallel
          *
-         * @param newValue - input argument string
+         * @param buffer      - Pointer to the delimited value buffer
+         * @param length      - Length of the value buffer in characters
+         * @param delimiter   - Value list delimiter character
+         * @param failedIndex - Set to the index of the element that failed if the return is not PARSE_SUCCESS_e
          *
-         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
-         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
+         * @return valueParseStatus_e - Status of the first failed element or PARSE_SUCCESS_e
          */
-        valueParseStatus_e setStringElementValue(const char* newValue);
+        valueParseStatus_e setParallelValueBuffer(const char* buffer, size_t length, char delimiter, size_t& failedIndex)
+        {
+            // Size the worker pool from the number of values to convert
+            size_t elementCount = 1;
+            for (const char* searchPtr = buffer;
+                 (searchPtr = static_cast<const char*>(memchr(searchPtr, delimiter, length - (searchPtr - buffer)))) != nullptr;
+                 searchPtr++)
+            {
+                elementCount++;
+            }
+
+            // Break the buffer into chunks that end on a delimiter
+            const size_t chunkTarget = getWorkerCount(elementCount, parallelThreads) * listParallelChunksPerWorker;
+            const size_t chunkSize   = (length / chunkTarget) + 1;
+            std::vector<conversionChunk> chunkList;
+            chunkList.reserve(chunkTarget + 1);
+
+            size_t startPos = 0;
+            while (startPos < length)
+            {
+                size_t endPos = startPos + chunkSize;
+                if (endPos >= length)
+                {
+                    endPos = length;
+                }
+                else
+                {
+                    const char* delimiterPtr = static_cast<const char*>(memchr(buffer + endPos, delimiter, length - endPos));
+                    endPos = ((delimiterPtr != nullptr) ? static_cast<size_t>(delimiterPtr - buffer) + 1 : length);
+                }
+
+                chunkList.push_back({buffer + startPos, endPos - startPos, {}, 0, valueParseStatus_e::PARSE_SUCCESS_e});
+                startPos = endPos;
+            }
+
+            // Convert the chunks
+            runParallel(chunkList.size(), parallelThreads, [&](size_t chunkIndex) {convertChunk(chunkList[chunkIndex], delimiter);});
+
+            // Size the storage once, then concatenate the results in order, stop at the first failure
+            size_t convertedCount = 0;
+            for (auto& chunk : chunkList)
+            {
+                convertedCount += chunk.values.size();
+            }
+            reserveValues(convertedCount);
+
+            size_t elementBase = 0;
+            for (auto& chunk : chunkList)
+            {
+                value.insert(value.end(), std::make_move_iterator(chunk.values.begin()), std::make_move_iterator(chunk.values.end()));
+                if (chunk.status != valueParseStatus_e::PARSE_SUCCESS_e)
+                {
+                    failedIndex = elementBase + chunk.failedIndex;
+                    return chunk.status;
+                }
+                elementBase += chunk.values.size();
+            }
+            return valueParseStatus_e::PARSE_SUCCESS_e;
+        }
 
     public:
-        std::list< T >  value;          ///< Current saved list values
+        Storage     value;              ///< Current saved list values
 
         /**
-         * @brief Construct a varg_intf object
+         * @brief Construct a list argument object
          */
-        listvarg();
+        listvarg() = default;
 
         /**
-         * @brief Destroy the varg object
+         * @brief Construct a list argument object with an allocator aware storage policy
+         *
+         * @param allocator - Storage allocator, for example a std::pmr::polymorphic_allocator
+         *                    or std::pmr::memory_resource pointer
          */
-        virtual ~listvarg()                                             {value.clear();}
+        template <typename Allocator, typename = std::enable_if_t<std::is_constructible_v<Storage, const Allocator&>>>
+        explicit listvarg(const Allocator& allocator) : value(allocator) {}
 
         /**
-         * @brief Return if varg is a list of elements or a single element type
-         *
-         * @return true - List type variable, multiple arguement values are allowed
-         * @return false - Only 0 or 1 argument values are allowed.
+         * @brief Destroy the varg object
          */
-        virtual bool isList() const                                     {return true;}
+        virtual ~listvarg()                                             {value.clear();}
 
         /**
          * @brief Virtual interface method implementation for the template variable implementation setValue with input function
@@ -143,14 +295,18 @@ template <typename T> class listvarg : public varg_intf
          * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value exceeds lower value limit
          * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value exceeds upper value limit
          */
-        virtual valueParseStatus_e setValue(const char* newValue);
+        virtual valueParseStatus_e setValue(const char* newValue)
+        {
+            T element{};
+            valueParseStatus_e status = listvarg_base<T>::convertElement(newValue, element);
+            if (status == valueParseStatus_e::PARSE_SUCCESS_e)
+            {
+                value.push_back(std::move(element));
+            }
+            return status;
+        }
 
-        /**
-         * Virtual interface method implementation for the template variable implementation setValue function
-         *
-         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - Lists do not have a default set value
-         */
-        virtual valueParseStatus_e setValue()                           {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
+        using listvarg_base<T>::setValue;
 
         /**
          * Virtual interface method implementation for the template variable implementation isEmpty function
@@ -159,8 +315,85 @@ template <typename T> class listvarg : public varg_intf
          * @return false - if list is not empty
          */
         virtual bool isEmpty()                                          {return value.empty();}
+
+        /**
+         * @brief Get the heap memory held by the argument, includes the list storage
+         *
+         * @return heapUsage - Heap bytes and blocks held by the argument
+         */
+        virtual heapUsage getHeapUsage() const
+        {
+            heapUsage usage = varg_intf::getHeapUsage();
+            usage += getContainerHeapUsage(value);
+            return usage;
+        }
+
+        /**
+         * @brief Reserve room for additional values if the storage policy supports it
+         *
+         * @param additionalCount - Number of values about to be added
+         */
+        virtual void reserveValues(size_t additionalCount)
+        {
+            if constexpr (listStorageHasReserve<Storage>::value)
+            {
+                reserveAdditional(value, additionalCount);
+            }
+        }
+
+        /**
+         * @brief Enable parallel conversion of large delimited value buffers
+         *
+         * @param minBufferLength - Minimum value buffer length in characters before the conversion is split across threads
+         * @param maxThreads      - Maximum number of conversion threads, 0 = hardware concurrency
+         */
+        void enableParallelAssignment(size_t minBufferLength = listParallelDefaultThreshold, unsigned maxThreads = 0)
+        {
+            parallelThreshold = ((minBufferLength != 0) ? minBufferLength : 1);
+            parallelThreads = maxThreads;
+        }
+
+        /**
+         * @brief Disable parallel conversion of large delimited value buffers
+         */
+        void disableParallelAssignment()                                {parallelThreshold = 0;}
+
+        /**
+         * @brief Assign each value of a delimited value buffer in order.  Buffers longer than the
+         *        parallel assignment threshold are split at delimiter boundaries and converted on
+         *        a pool of worker threads.  The parallel conversion bypasses setValue(), so derived
+         *        types, which may validate in setValue(), always use the serial path.
+         *
+         * @param buffer      - Pointer to the delimited value buffer, does not need to be null terminated
+         * @param length      - Length of the value buffer in characters
+         * @param delimiter   - Value list delimiter character
+         * @param failedIndex - Set to the index of the element that failed if the return is not PARSE_SUCCESS_e
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if all of the values were successsfully set
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if an element string could not be translated
+         * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if an element value exceeds lower value limit
+         * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if an element value exceeds upper value limit
+         */
+        virtual valueParseStatus_e setValueBuffer(const char* buffer, size_t length, char delimiter, size_t& failedIndex)
+        {
+            if ((parallelThreshold == 0) || (length < parallelThreshold) || (typeid(*this) != typeid(listvarg)))
+            {
+                return varg_intf::setValueBuffer(buffer, length, delimiter, failedIndex);
+            }
+            return setParallelValueBuffer(buffer, length, delimiter, failedIndex);
+        }
 }; // end of class definition
 
+/**
+ * @brief List argument that keeps up to N values in an inline buffer before allocating
+ */
+template <typename T, size_t N = listInlineDefaultCapacity> using inlinelistvarg = listvarg<T, inline_vector<T, N>>;
+
+/**
+ * @brief List argument whose value storage is allocated from a std::pmr::memory_resource
+ */
+template <typename T> using pmrlistvarg = listvarg<T, std::pmr::vector<T>>;
+
 }; // end of namespace argparser
 
 /** @} */
@@ -0,0 +1,110 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file parallel_work.h
+ * @ingroup libvarg
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstddef>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace argparser
+{
+
+/**
+ * @brief Get the number of worker threads to use for a job set
+ *
+ * @param jobCount    - Number of jobs to run
+ * @param threadCount - Requested maximum number of threads, 0 = hardware concurrency
+ *
+ * @return unsigned - Number of threads to use, always >= 1
+ */
+inline unsigned getWorkerCount(size_t jobCount, unsigned threadCount)
+{
+    unsigned workerCount = ((threadCount != 0) ? threadCount : std::thread::hardware_concurrency());
+    if (workerCount == 0)
+    {
+        workerCount = 1;
+    }
+    if (jobCount < workerCount)
+    {
+        workerCount = static_cast<unsigned>((jobCount != 0) ? jobCount : 1);
+    }
+    return workerCount;
+}
+
+/**
+ * @brief Run a set of independent jobs on a pool of worker threads.
+ *
+ * The calling thread is one of the workers.  Jobs are handed out in index
+ * order, each job index is run exactly once and the call returns after all
+ * of the jobs have completed.
+ *
+ * @param jobCount    - Number of jobs to run, job indexes are 0 to jobCount-1
+ * @param threadCount - Maximum number of threads to use, 0 = hardware concurrency
+ * @param job         - Callable object with a job(size_t jobIndex) signature
+ */
+template <typename Job> void runParallel(size_t jobCount, unsigned threadCount, Job&& job)
+{
+    const unsigned workerCount = getWorkerCount(jobCount, threadCount);
+    if (workerCount <= 1)
+    {
+        for (size_t jobIndex = 0; jobIndex < jobCount; jobIndex++)
+        {
+            job(jobIndex);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextJob(0);
+    auto worker = [&]()
+    {
+        for (size_t jobIndex = nextJob.fetch_add(1); jobIndex < jobCount; jobIndex = nextJob.fetch_add(1))
+        {
+            job(jobIndex);
+        }
+    };
+
+    std::vector<std::thread> workerList;
+    workerList.reserve(workerCount - 1);
+    for (unsigned threadIndex = 1; threadIndex < workerCount; threadIndex++)
+    {
+        workerList.emplace_back(worker);
+    }
+    worker();
+
+    for (auto& workerThread : workerList)
+    {
+        workerThread.join();
+    }
+}
+
+}; // end of namespace argparser
+
+/** @} */
@@ -0,0 +1,209 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file pattern_matcher.h
+ * @ingroup libvarg
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace argparser
+{
+
+/**
+ * @brief Pattern dialects accepted by pattern_matcher
+ */
+enum patternSyntax_e : uint8_t
+{
+    PATTERN_REGEX_e,                    ///< Restricted regular expression, see pattern_matcher
+    PATTERN_GLOB_e,                     ///< Shell glob, '*', '?' and [...] classes
+};
+
+constexpr size_t patternMaxPositions = 64;      ///< Maximum number of character positions in a compiled pattern
+
+/**
+ * @brief Precompiled whole string pattern matcher.
+ *
+ * The pattern is compiled once into a Glushkov position automaton with at most
+ * patternMaxPositions character positions, and the active state set is a single
+ * 64 bit word.  Matching is one table lookup and a follow set merge per input
+ * character, so it is linear in the input length and never allocates.
+ *
+ * The regular expression dialect supports literals, '.', [...] and [^...]
+ * classes with ranges, the \\d \\w \\s \\D \\W \\S class escapes, grouping with
+ * ( ), alternation with '|' and the '*', '+' and '?' quantifiers.  The match is
+ * always anchored at both ends.  The glob dialect supports '*', '?', [...] and
+ * [!...] classes and '\\' escapes.
+ */
+class pattern_matcher
+{
+    private:
+        /**
+         * @brief First, last and nullable sets of a compiled sub expression
+         */
+        struct positionSet
+        {
+            uint64_t    first;          ///< Positions that can match the first character
+            uint64_t    last;           ///< Positions that can match the last character
+            bool        nullable;       ///< Sub expression matches the empty string
+        };
+
+        using charClass = std::bitset<256>;
+
+        std::array<uint64_t, 256>                   charMask;       ///< Positions that accept each input byte
+        std::array<uint64_t, patternMaxPositions>   follow;         ///< Positions that may follow each position
+        uint64_t                                    firstMask;      ///< Positions that can start a match
+        uint64_t                                    lastMask;       ///< Positions that can end a match
+        bool                                        emptyMatch;     ///< Pattern matches the empty string
+        size_t                                      positionCount;  ///< Number of character positions
+        size_t                                      errorIndex;     ///< Pattern index of the compile error, npos if the pattern is valid
+
+        std::string_view                            pattern;        ///< Pattern being compiled, only valid during compile()
+        size_t                                      patternIndex;   ///< Compile position in the pattern
+
+        /**
+         * @brief Add a character position that accepts the input bytes in acceptSet
+         *
+         * @param acceptSet - Input bytes the position accepts
+         *
+         * @return positionSet - Single position set
+         */
+        positionSet addPosition(const charClass& acceptSet);
+
+        /**
+         * @brief Concatenate two sub expressions and update the follow sets
+         *
+         * @param left  - Left sub expression
+         * @param right - Right sub expression
+         *
+         * @return positionSet - Concatenated sub expression
+         */
+        positionSet concatenate(const positionSet& left, const positionSet& right);
+
+        /**
+         * @brief Allow a sub expression to repeat and update the follow sets
+         *
+         * @param inner - Sub expression to repeat
+         *
+         * @return positionSet - Repeated sub expression
+         */
+        positionSet repeat(const positionSet& inner);
+
+        /**
+         * @brief Record a compile error at the current pattern index
+         *
+         * @return false - Always
+         */
+        bool setError();
+
+        /**
+         * @brief Get the class of a \d \w \s \D \W \S escape
+         *
+         * @param escapeChar - Character following the '\'
+         * @param acceptSet  - Returned class
+         *
+         * @return true  - escapeChar is a class escape
+         * @return false - escapeChar is a literal escape
+         */
+        bool parseEscapeClass(char escapeChar, charClass& acceptSet) const;
+
+        /**
+         * @brief Parse a [...] class, the pattern index is just past the '['
+         *
+         * @param acceptSet  - Returned class
+         * @param negateChar - Character that negates the class when it is first
+         *
+         * @return bool - False on a compile error
+         */
+        bool parseClass(charClass& acceptSet, char negateChar);
+
+        /**
+         * @brief Regular expression recursive descent parsers, each returns false on a compile error
+         *
+         * @param result - Returned sub expression
+         */
+        bool parseAlternation(positionSet& result);
+        bool parseSequence(positionSet& result);        ///< @copydoc parseAlternation
+        bool parseRepeat(positionSet& result);          ///< @copydoc parseAlternation
+        bool parseAtom(positionSet& result);            ///< @copydoc parseAlternation
+
+        /**
+         * @brief Parse a glob pattern
+         *
+         * @param result - Returned expression
+         *
+         * @return bool - False on a compile error
+         */
+        bool parseGlob(positionSet& result);
+
+    public:
+        /**
+         * @brief Construct a matcher that only matches the empty string
+         */
+        pattern_matcher();
+
+        /**
+         * @brief Construct and compile a matcher
+         *
+         * @param patternString - Pattern to compile
+         * @param syntax        - Pattern dialect
+         */
+        pattern_matcher(std::string_view patternString, patternSyntax_e syntax);
+
+        /**
+         * @brief Compile a new pattern
+         *
+         * @param patternString - Pattern to compile
+         * @param syntax        - Pattern dialect
+         *
+         * @return true  - Pattern compiled
+         * @return false - Pattern is invalid or needs more than patternMaxPositions positions, see getErrorIndex()
+         */
+        bool compile(std::string_view patternString, patternSyntax_e syntax);
+
+        /**
+         * @brief Check if the whole input string matches the pattern
+         *
+         * @param input - String to check
+         *
+         * @return true  - Input matches
+         * @return false - Input does not match or the pattern is invalid
+         */
+        bool match(std::string_view input) const;
+
+        bool    isValid() const                     {return (errorIndex == std::string_view::npos);}    ///< @brief True if the pattern compiled
+        size_t  getErrorIndex() const               {return errorIndex;}                                ///< @brief Pattern index of the compile error, npos if valid
+        size_t  getPositionCount() const            {return positionCount;}                             ///< @brief Number of compiled character positions
+};
+
+}; // end of namespace argparser
+
+/** @} */
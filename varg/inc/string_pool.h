@@ -0,0 +1,140 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file string_pool.h
+ * @ingroup libvarg
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+#include "heap_usage.h"
+
+namespace argparser
+{
+
+constexpr size_t stringPoolDefaultBlockSize = 4096;     ///< Default string pool storage block size in bytes
+
+/**
+ * @brief String pool deduplication counters
+ */
+struct stringPoolStats
+{
+    size_t      internCount;        ///< Number of strings interned
+    size_t      uniqueCount;        ///< Number of distinct strings stored
+    size_t      requestedBytes;     ///< Total length of every interned string
+    size_t      storedBytes;        ///< Total length of the distinct strings stored
+
+    /**
+     * @brief Get the deduplication ratio
+     *
+     * @return double - Interned strings per stored string, 0 if nothing was interned
+     */
+    double dedupRatio() const           {return ((uniqueCount != 0) ? (static_cast<double>(internCount) / static_cast<double>(uniqueCount)) : 0.0);}
+
+    /**
+     * @brief Get the number of string bytes the deduplication did not need to store
+     *
+     * @return size_t - requestedBytes - storedBytes
+     */
+    size_t bytesSaved() const           {return requestedBytes - storedBytes;}
+};
+
+/**
+ * @brief Append only pool of distinct strings.  Each distinct string is stored
+ *        once, null terminated, in large storage blocks and every intern() call
+ *        for an equal string returns a view of the same storage.  The views stay
+ *        valid until the pool is cleared or destroyed.
+ *
+ * The pool is thread safe, parser copies share one pool and may intern from
+ * different threads at the same time.
+ */
+class string_pool
+{
+    private:
+        std::vector<std::unique_ptr<char[]>>    blockList;      ///< String storage blocks
+        std::unordered_set<std::string_view>    entries;        ///< Views of the stored strings
+        char*                                   blockNext;      ///< Next free byte in the current block
+        size_t                                  blockRemaining; ///< Free bytes in the current block
+        size_t                                  blockSize;      ///< Storage block size
+        size_t                                  blockBytes;     ///< Total size of the storage blocks
+        stringPoolStats                         stats;          ///< Deduplication counters
+        mutable std::mutex                      poolLock;       ///< Serializes access to the pool
+
+        /**
+         * @brief Copy a new string into the pool storage
+         *
+         * @param newString - String to store
+         *
+         * @return std::string_view - View of the null terminated stored copy
+         */
+        std::string_view store(std::string_view newString);
+
+    public:
+        /**
+         * @brief Construct an empty string pool
+         *
+         * @param storageBlockSize - Storage block size, strings longer than a quarter block get their own block
+         */
+        explicit string_pool(size_t storageBlockSize = stringPoolDefaultBlockSize);
+
+        string_pool(const string_pool& other) = delete;
+        string_pool& operator=(const string_pool& other) = delete;
+
+        /**
+         * @brief Get the pooled copy of a string, adding it if it is not in the pool
+         *
+         * @param newString - String to intern, does not need to be null terminated
+         *
+         * @return std::string_view - View of the pooled copy, the view data is null terminated
+         */
+        std::string_view intern(std::string_view newString);
+
+        /**
+         * @brief Remove every string, all previously returned views become invalid.
+         *        The counters are reset.
+         */
+        void clear();
+
+        /**
+         * @brief Get the heap memory held by the pool, the storage blocks plus an
+         *        estimate of the lookup set buckets and nodes
+         *
+         * @return heapUsage - Heap bytes and blocks held by the pool
+         */
+        heapUsage getHeapUsage() const;
+
+        size_t          size() const        {std::lock_guard<std::mutex> guard(poolLock); return entries.size();}  ///< @brief Number of distinct strings
+        stringPoolStats getStats() const    {std::lock_guard<std::mutex> guard(poolLock); return stats;}           ///< @brief Deduplication counters
+};
+
+}; // end of namespace argparser
+
+/** @} */
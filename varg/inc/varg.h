@@ -116,7 +116,7 @@ template <typename T> class varg : public varg_intf
          * @param defaultValue - Initial value of varg.value
          * @param flagValue    - Flag set value of varg.value
          */
-        varg(T defaultValue, T flagValue) : varg_intf(), value(defaultValue), flagSetValue(flagValue)   {}
+        varg(T defaultValue, T flagValue) : varg_intf(), value(defaultValue), flagSetValue(flagValue)   {varg_intf::setDefaultMinMax<T>();}
 
         /**
          * @brief Construct a varg_intf object
@@ -165,6 +165,22 @@ template <typename T> class varg : public varg_intf
          * @return true - Base variable is never empty
          */
         virtual bool isEmpty()                              {return false;}
+
+        /**
+         * @brief Get the heap memory held by the argument, includes the string value storage
+         *
+         * @return heapUsage - Heap bytes and blocks held by the argument
+         */
+        virtual heapUsage getHeapUsage() const
+        {
+            heapUsage usage = varg_intf::getHeapUsage();
+            if constexpr (std::is_same_v<T, std::string>)
+            {
+                usage += getStringHeapUsage(value);
+                usage += getStringHeapUsage(flagSetValue);
+            }
+            return usage;
+        }
 }; // end of class definition
 
 }; // end of namespace argparser
@@ -29,10 +29,15 @@
 #pragma once
 
 // Includes
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <climits>
 #include <limits>
 #include <string>
+#include <type_traits>
+#include "heap_usage.h"
 
 namespace argparser
 {
@@ -52,7 +57,7 @@ enum valueParseStatus_e
  * @brief Type string format type selection
  * 
  */
-enum typeStringFormat_e
+enum typeStringFormat_e : uint8_t
 {
     TYPE_FMT_SIGNED,                    ///< Use the signed min/max
     TYPE_FMT_UNSIGNED,                  ///< Use the unsigned min/max
@@ -60,22 +65,62 @@ enum typeStringFormat_e
     TYPE_FMT_CHAR,                      ///< Set the default char type string
     TYPE_FMT_BOOL,                      ///< Set the default boolean type string
     TYPE_FMT_STRING,                    ///< Set the default string type string
+    TYPE_FMT_NONE,                      ///< No type string, derived class supplies getTypeString()
 };
 
+/**
+ * @brief Make room for additional container values.  Grows the capacity at least
+ *        geometrically so a series of small reservations does not reallocate on
+ *        every call.
+ *
+ * @param container       - Container to reserve, must support size(), capacity() and reserve()
+ * @param additionalCount - Number of values about to be added
+ */
+template <typename Container> void reserveAdditional(Container& container, size_t additionalCount)
+{
+    const size_t requiredCount = container.size() + additionalCount;
+    if (requiredCount > container.capacity())
+    {
+        container.reserve(std::max(container.capacity() * 2, requiredCount));
+    }
+}
+
 /**
  * @brief Base variable argument varg interface and methods 
  */
 class varg_intf
 {
+    public:
+        static constexpr size_t elementBufferSize = 256;    ///< Stack buffer size for the default setValueBuffer() elements
+
     private:
-        long long int       maxSignedValue;         ///< Maximum allowed signed integer value
-        long long int       minSignedValue;         ///< Minimum allowed signed integer value
-        long long unsigned  maxUnsignedValue;       ///< Maximum allowed unsigned integer value
-        long long unsigned  minUnsignedValue;       ///< Minimum allowed unsigned integer value
-        double              minDoubleValue;         ///< Minimum allowed floating point value
-        double              maxDoubleValue;         ///< Minimum allowed floating point value
-
-        std::string         typeString;             ///< Type description string with min/max values
+        /**
+         * @brief Value limits, only the member matching the argument value type is used
+         */
+        union valueBounds_u
+        {
+            struct
+            {
+                long long int       minValue;       ///< Minimum allowed signed integer value
+                long long int       maxValue;       ///< Maximum allowed signed integer value
+            } signedBounds;
+
+            struct
+            {
+                long long unsigned  minValue;       ///< Minimum allowed unsigned integer value
+                long long unsigned  maxValue;       ///< Maximum allowed unsigned integer value
+            } unsignedBounds;
+
+            struct
+            {
+                double              minValue;       ///< Minimum allowed floating point value
+                double              maxValue;       ///< Maximum allowed floating point value
+            } doubleBounds;
+        };
+
+        valueBounds_u       bounds;                 ///< Value limits for the numeric kind in use
+        typeStringFormat_e  typeFormat;             ///< Type description string format
+        std::string         typeString;             ///< Type description string, generated on first getTypeString() call
     
     protected:
         /**
@@ -84,7 +129,7 @@ class varg_intf
          * @param min - Minimum signed value allowed to be assigned
          * @param max - Minimum signed value allowed to be assigned
          */
-        void setMinMaxSigned(long long int min, long long int max)              {minSignedValue = min; maxSignedValue = max;}
+        void setMinMaxSigned(long long int min, long long int max)              {bounds.signedBounds.minValue = min; bounds.signedBounds.maxValue = max; typeString.clear();}
 
         /**
          * @brief Set the Min Max Signed object
@@ -92,7 +137,7 @@ class varg_intf
          * @param min - Minimum unsigned value allowed to be assigned
          * @param max - Minimum unsigned value allowed to be assigned
          */
-        void setMinMaxUnsigned(long long unsigned min, long long unsigned max)  {minUnsignedValue = min; maxUnsignedValue = max;}
+        void setMinMaxUnsigned(long long unsigned min, long long unsigned max)  {bounds.unsignedBounds.minValue = min; bounds.unsignedBounds.maxValue = max; typeString.clear();}
 
         /**
          * @brief Set the Min Max Signed object
@@ -100,34 +145,33 @@ class varg_intf
          * @param min - Minimum floating point value allowed to be assigned
          * @param max - Minimum floating point value allowed to be assigned
          */
-        void setMinMaxDouble(double min, double max)                            {minDoubleValue = min; maxDoubleValue = max;}
+        void setMinMaxDouble(double min, double max)                            {bounds.doubleBounds.minValue = min; bounds.doubleBounds.maxValue = max; typeString.clear();}
 
         /**
-         * @brief Construct a type string
+         * @brief Set the value limits to the full range of the numeric type T
          */
-        void setTypeString(typeStringFormat_e fmtType);
+        template <typename T> void setDefaultMinMax()
+        {
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                setMinMaxDouble(std::numeric_limits<double>::min(), std::numeric_limits<double>::max());
+            }
+            else if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T>)
+            {
+                setMinMaxUnsigned(0ULL, std::numeric_limits<T>::max());
+            }
+            else if constexpr (std::is_integral_v<T>)
+            {
+                setMinMaxSigned(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+            }
+        }
 
         /**
-         * @brief Gt the Bool Value object
+         * @brief Select the type string format, the string itself is built on the first getTypeString() call
          *
-         * @param newValue - input argument string
-         * @param parsedValue - parsed boolean value if parsing succeeded
-         *
-         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
-         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
+         * @param fmtType - Type string format
          */
-        static valueParseStatus_e getBoolValue(const char* newValue, bool& parsedValue);
-
-        /**
-         * @brief Get the New character object value
-         * 
-         * @param newValue - input argument string
-         * @param parsedValue - parsed character value if parsing succeeded
-         * 
-         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
-         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
-         */
-        static valueParseStatus_e getCharValue(const char* newValue, char& parsedValue);
+        void setTypeFormat(typeStringFormat_e fmtType)                          {typeFormat = fmtType; typeString.clear();}
 
         /**
          * @brief Get a signed value from the input string
@@ -168,6 +212,56 @@ class varg_intf
          */
         valueParseStatus_e getDoubleValue(const char* newValue, double& parsedValue) const;
 
+        /**
+         * @brief Convert a value string to a T using the argument limits
+         *
+         * @param newValue    - Input string to parse
+         * @param parsedValue - Converted value, only valid if the return is PARSE_SUCCESS_e
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully converted
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
+         * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value was below the lower set limit
+         * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value was above the upper set limit
+         */
+        template <typename T> valueParseStatus_e convertValue(const char* newValue, T& parsedValue) const
+        {
+            if constexpr (std::is_same_v<T, std::string>)
+            {
+                parsedValue = newValue;
+                return valueParseStatus_e::PARSE_SUCCESS_e;
+            }
+            else if constexpr (std::is_same_v<T, bool>)
+            {
+                return getBoolValue(newValue, parsedValue);
+            }
+            else if constexpr (std::is_same_v<T, char>)
+            {
+                return getCharValue(newValue, parsedValue);
+            }
+            else if constexpr (std::is_floating_point_v<T>)
+            {
+                double tempValue = 0.0;
+                valueParseStatus_e status = getDoubleValue(newValue, tempValue);
+                parsedValue = static_cast<T>(tempValue);
+                return status;
+            }
+            else if constexpr (std::is_unsigned_v<T>)
+            {
+                long long unsigned tempValue = 0;
+                valueParseStatus_e status = getUnsignedValue(newValue, tempValue);
+                parsedValue = static_cast<T>(tempValue);
+                return status;
+            }
+            else
+            {
+                static_assert(std::is_integral_v<T>, "Unsupported value type");
+                long long int tempValue = 0;
+                valueParseStatus_e status = getSignedValue(newValue, tempValue);
+                parsedValue = static_cast<T>(tempValue);
+                return status;
+            }
+        }
+
     public:
         varg_intf();                                                ///< @brief Default constructor for varg_intf object
         varg_intf(const varg_intf& other) = default;                ///< @brief Copy constructor for varg_intf object
@@ -180,12 +274,79 @@ class varg_intf
          */
         virtual ~varg_intf() = default;
 
+        /**
+         * @brief Gt the Bool Value object
+         *
+         * @param newValue - input argument string
+         * @param parsedValue - parsed boolean value if parsing succeeded
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
+         */
+        static valueParseStatus_e getBoolValue(const char* newValue, bool& parsedValue);
+
+        /**
+         * @brief Get the New character object value
+         * 
+         * @param newValue - input argument string
+         * @param parsedValue - parsed character value if parsing succeeded
+         * 
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
+         */
+        static valueParseStatus_e getCharValue(const char* newValue, char& parsedValue);
+
+        /**
+         * @brief Parse a signed value from the input string and check it against the input limits
+         *
+         * @param newValue    - Input string to parse
+         * @param parsedValue - return long long integer value
+         * @param minValue    - Minimum allowed value
+         * @param maxValue    - Maximum allowed value
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
+         * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value was below the lower set limit
+         * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value was above the upper set limit
+         */
+        static valueParseStatus_e parseSignedValue(const char* newValue, long long int& parsedValue, long long int minValue, long long int maxValue);
+
+        /**
+         * @brief Parse an unsigned value from the input string and check it against the input limits
+         *
+         * @param newValue    - Input string to parse
+         * @param parsedValue - return long long unsigned value
+         * @param minValue    - Minimum allowed value
+         * @param maxValue    - Maximum allowed value
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
+         * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value was below the lower set limit
+         * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value was above the upper set limit
+         */
+        static valueParseStatus_e parseUnsignedValue(const char* newValue, long long unsigned& parsedValue, long long unsigned minValue, long long unsigned maxValue);
+
+        /**
+         * @brief Parse a floating point value from the input string and check its magnitude against the input limits
+         *
+         * @param newValue    - Input string to parse
+         * @param parsedValue - return double value
+         * @param minValue    - Minimum allowed absolute value
+         * @param maxValue    - Maximum allowed absolute value
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
+         * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value was below the lower set limit
+         * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value was above the upper set limit
+         */
+        static valueParseStatus_e parseDoubleValue(const char* newValue, double& parsedValue, double minValue, double maxValue);
+
         /**
          * @brief Get the base argument type as a string
          *
          * @return char* - Base type string
          */
-        virtual const char* getTypeString()                     {return typeString.c_str();}
+        virtual const char* getTypeString();
 
         /**
          * @brief Return if varg is a list of elements or a single element type
@@ -214,6 +375,39 @@ class varg_intf
          */
         virtual valueParseStatus_e setValue() = 0;
 
+        /**
+         * @brief Assign each value of a delimited value buffer in order.  The default
+         *        implementation calls setValue(const char*) for each buffer element,
+         *        elements shorter than elementBufferSize are terminated in a stack buffer.
+         *
+         * @param buffer      - Pointer to the delimited value buffer, does not need to be null terminated
+         * @param length      - Length of the value buffer in characters
+         * @param delimiter   - Value list delimiter character
+         * @param failedIndex - Set to the index of the element that failed if the return is not PARSE_SUCCESS_e
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if all of the values were successsfully set
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if an element string could not be translated
+         * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if an element value exceeds lower value limit
+         * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if an element value exceeds upper value limit
+         */
+        virtual valueParseStatus_e setValueBuffer(const char* buffer, size_t length, char delimiter, size_t& failedIndex);
+
+        /**
+         * @brief Reserve room for additional values before a multiple value assignment.
+         *        Only list types with a reservable storage policy use the hint.
+         *
+         * @param additionalCount - Number of values about to be added
+         */
+        virtual void reserveValues(size_t)                      {}
+
+        /**
+         * @brief Check a deferred value assignment.  Types that convert during
+         *        setValue() have nothing left to check.
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e - if the value is valid, else the conversion error status
+         */
+        virtual valueParseStatus_e validate()                   {return valueParseStatus_e::PARSE_SUCCESS_e;}
+
         /**
          * Virtual place holder for the template variable implementation isEmpty function
          *
@@ -221,6 +415,14 @@ class varg_intf
          * @return false - if variable is not empty
          */
         virtual bool isEmpty() = 0;
+
+        /**
+         * @brief Get the heap memory held by the argument, the generated type string
+         *        plus any value storage added by the derived type
+         *
+         * @return heapUsage - Heap bytes and blocks held by the argument
+         */
+        virtual heapUsage getHeapUsage() const                  {return getStringHeapUsage(typeString);}
 };
 
 }; // end of namespace argparser
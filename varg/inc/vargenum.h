@@ -30,9 +30,9 @@
 
 // Includes
 #include <stdlib.h>
-#include <map>
 #include <string>
 #include "varg_intf.h"
+#include "enum_name_table.h"
 
 namespace argparser
 {
@@ -42,7 +42,7 @@ namespace argparser
 template <typename T> class vargenum : public varg_intf
 {
     private:
-        std::map< std::string, T >  enumNameMap;    ///< Map of enum strings to value
+        enumNameTable<T>            enumNameMap;    ///< Enum name to value lookup table
         std::string                 enumName;       ///< Enum name
 
     public:
@@ -51,15 +51,17 @@ template <typename T> class vargenum : public varg_intf
         /**
          * @brief Construct a vargenum object
          *
-         * @param defaultValue - Default value for the vargenum.value to start with
-         * @param name - name of the enum
+         * @param defaultValue    - Default value for the vargenum.value to start with
+         * @param name            - name of the enum
+         * @param caseInsensitive - True to match the enum names without regard to case
          */
-        vargenum(T defaultValue, const char* name = ""): varg_intf(), value(defaultValue), enumName(name)    {enumNameMap.clear();}
+        vargenum(T defaultValue, const char* name = "", bool caseInsensitive = false): varg_intf(),
+            enumNameMap(caseInsensitive), enumName(name), value(defaultValue)    {}
 
         /**
          * @brief Destroy the vargenum object
          */
-        virtual ~vargenum()                                             {enumNameMap.clear(); enumName.clear();}
+        virtual ~vargenum()                                             {enumName.clear();}
 
         /**
          * @brief Get the base argument type as a string
@@ -81,7 +83,8 @@ template <typename T> class vargenum : public varg_intf
         virtual bool isList() const                                       {return false;}
 
         /**
-         * @brief Virtual interface method implementation for the template variable implementation setValue with input function
+         * @brief Virtual interface method implementation for the template variable implementation setValue with input function.
+         *        The name is found with a binary search of the sorted name table, no copy of the input is made.
          *
          * @param newValue - Input character string
          *
@@ -90,14 +93,11 @@ template <typename T> class vargenum : public varg_intf
          */
         virtual valueParseStatus_e setValue(const char* newValue)
         {
-            std::string searchString = newValue;
-            for (auto const & [key, val] : enumNameMap)
+            const T* enumValue = enumNameMap.find(newValue);
+            if (enumValue != nullptr)
             {
-                if (key == searchString)
-                {
-                    value = val;
-                    return valueParseStatus_e::PARSE_SUCCESS_e;
-                }
+                value = *enumValue;
+                return valueParseStatus_e::PARSE_SUCCESS_e;
             }
 
             return valueParseStatus_e::PARSE_INVALID_INPUT_e;
@@ -118,17 +118,23 @@ template <typename T> class vargenum : public varg_intf
         virtual bool isEmpty()                                          {return false;}
 
         /**
-         * @brief Assign enum map values
+         * @brief Assign enum map values.  If the name is already assigned the first value is kept.
          *
          * @param entryName - Name of the enum value
          * @param enumValue - Value to assign for the name
          */
         void setEnumValue(const char* entryName, T enumValue)
         {
-            std::string entryNameStr = entryName;
-            enumNameMap.emplace(entryNameStr, enumValue);
+            enumNameMap.addName(entryName, enumValue);
         }
 
+        /**
+         * @brief Sort the name table and remove duplicate names.  Called automatically
+         *        by the first setValue() after a setEnumValue() call, call it directly
+         *        after registration to keep the sort out of the parse.
+         */
+        void buildLookupTable()                                         {enumNameMap.build();}
+
 }; // end of class definition
 
 }; // end of namespace argparser
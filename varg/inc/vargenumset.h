@@ -0,0 +1,200 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file vargenumset.h
+ * @ingroup libvarg
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstring>
+#include <bitset>
+#include <string>
+#include <string_view>
+#include "varg_intf.h"
+#include "enum_name_table.h"
+
+namespace argparser
+{
+/**
+ * @brief Variable argument enum set template class.  Each enum name maps to a
+ *        bit number, every name assigned on the command line sets its bit.
+ *
+ * @tparam T        - Enum type, each value must be less than MaxBits
+ * @tparam MaxBits  - Number of bits in the set
+ */
+template <typename T, size_t MaxBits = 64> class vargenumset : public varg_intf
+{
+    private:
+        enumNameTable<T>            enumNameMap;    ///< Enum name to bit number lookup table
+        std::string                 enumName;       ///< Enum name
+
+        /**
+         * @brief Set the bit for one enum name
+         *
+         * @param name - Enum name, does not need to be null terminated
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if the bit was set
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if the name is unknown or the value is not a valid bit number
+         */
+        valueParseStatus_e setNameBit(std::string_view name)
+        {
+            const T* enumValue = enumNameMap.find(name);
+            if ((enumValue == nullptr) || (static_cast<size_t>(*enumValue) >= MaxBits))
+            {
+                return valueParseStatus_e::PARSE_INVALID_INPUT_e;
+            }
+
+            value.set(static_cast<size_t>(*enumValue));
+            return valueParseStatus_e::PARSE_SUCCESS_e;
+        }
+
+    public:
+        std::bitset<MaxBits>        value;          ///< Current set of enum values
+
+        /**
+         * @brief Construct a vargenumset object with no values set
+         *
+         * @param name            - name of the enum
+         * @param caseInsensitive - True to match the enum names without regard to case
+         */
+        vargenumset(const char* name = "", bool caseInsensitive = false): varg_intf(),
+            enumNameMap(caseInsensitive), enumName(name), value()   {}
+
+        /**
+         * @brief Destroy the vargenumset object
+         */
+        virtual ~vargenumset()                                          {enumName.clear();}
+
+        /**
+         * @brief Get the base argument type as a string
+         *
+         * @return const char* - Base type string
+         */
+        virtual const char* getTypeString()
+        {
+            if (enumName.empty()) return "enum value";
+            else return enumName.c_str();
+        }
+
+        /**
+         * @brief Return if varg is a list of elements or a single element type
+         *
+         * @return true - Multiple enum names may be assigned
+         */
+        virtual bool isList() const                                     {return true;}
+
+        /**
+         * @brief Virtual interface method implementation for the template variable implementation setValue with input function
+         *
+         * @param newValue - Input character string
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
+         */
+        virtual valueParseStatus_e setValue(const char* newValue)       {return setNameBit(newValue);}
+
+        /**
+         * Virtual interface method implementation for the template variable implementation setValue function
+         *
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - enum set type must have an input string to map to the enum value
+         */
+        virtual valueParseStatus_e setValue()                           {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
+
+        /**
+         * @brief Set the bit for each name of a delimited name buffer, the names
+         *        are looked up in place without a copy
+         *
+         * @param buffer      - Pointer to the delimited name buffer, does not need to be null terminated
+         * @param length      - Length of the name buffer in characters
+         * @param delimiter   - Name list delimiter character
+         * @param failedIndex - Set to the index of the name that failed if the return is not PARSE_SUCCESS_e
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if all of the names were successsfully set
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if a name could not be translated
+         */
+        virtual valueParseStatus_e setValueBuffer(const char* buffer, size_t length, char delimiter, size_t& failedIndex)
+        {
+            size_t elementIndex = 0;
+            size_t startPos     = 0;
+            while (startPos < length)
+            {
+                const char* delimiterPtr = static_cast<const char*>(memchr(buffer + startPos, delimiter, length - startPos));
+                size_t      endPos       = ((delimiterPtr != nullptr) ? static_cast<size_t>(delimiterPtr - buffer) : length);
+
+                if (setNameBit(std::string_view(buffer + startPos, endPos - startPos)) != valueParseStatus_e::PARSE_SUCCESS_e)
+                {
+                    failedIndex = elementIndex;
+                    return valueParseStatus_e::PARSE_INVALID_INPUT_e;
+                }
+
+                elementIndex++;
+                startPos = endPos + 1;
+            }
+            return valueParseStatus_e::PARSE_SUCCESS_e;
+        }
+
+        /**
+         * Virtual interface method implementation for the template variable implementation isEmpty function
+         *
+         * @return true - if no enum values are set
+         * @return false - if at least one enum value is set
+         */
+        virtual bool isEmpty()                                          {return value.none();}
+
+        /**
+         * @brief Assign enum map values.  If the name is already assigned the first value is kept.
+         *
+         * @param entryName - Name of the enum value
+         * @param enumValue - Bit number to set for the name, must be less than MaxBits
+         */
+        void setEnumValue(const char* entryName, T enumValue)           {enumNameMap.addName(entryName, enumValue);}
+
+        /**
+         * @brief Sort the name table and remove duplicate names.  Called automatically
+         *        by the first setValue() after a setEnumValue() call.
+         */
+        void buildLookupTable()                                         {enumNameMap.build();}
+
+        /**
+         * @brief Check if an enum value is in the set
+         *
+         * @param enumValue - Enum value to check
+         *
+         * @return true  - Value is in the set
+         * @return false - Value is not in the set or is outside of the set range
+         */
+        bool isSet(T enumValue) const
+        {
+            const size_t bitIndex = static_cast<size_t>(enumValue);
+            return ((bitIndex < MaxBits) && value[bitIndex]);
+        }
+
+}; // end of class definition
+
+}; // end of namespace argparser
+
+/** @} */
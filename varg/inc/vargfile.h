@@ -0,0 +1,148 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file vargfile.h
+ * @ingroup libvarg
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstddef>
+#include <string>
+#include "varg_intf.h"
+
+namespace argparser
+{
+
+/**
+ * @brief Memory access pattern hint for the file mapping
+ */
+enum fileAccessHint_e
+{
+    FILE_ACCESS_NORMAL_e = 0,           ///< No special access pattern
+    FILE_ACCESS_SEQUENTIAL_e,           ///< File is read front to back
+    FILE_ACCESS_RANDOM_e,               ///< File is read in random order
+    FILE_ACCESS_WILLNEED_e,             ///< Whole file will be read soon, start read ahead
+};
+
+/**
+ * @brief Input file argument.  The path is checked when it is assigned and the
+ *        file is memory mapped read only on the first data access.
+ */
+class vargfile : public varg_intf
+{
+    private:
+        fileAccessHint_e            accessHint;     ///< Mapping access pattern hint
+        mutable const std::byte*    mappedData;     ///< Mapped file data, nullptr until the first access
+        mutable size_t              mappedSize;     ///< Size of the mapped file data
+        mutable bool                mapAttempted;   ///< True once the file mapping has been attempted
+
+        /**
+         * @brief Release the file mapping
+         */
+        void unmap();
+
+    public:
+        std::string                 value;          ///< Current file path
+
+        /**
+         * @brief Construct a vargfile object
+         *
+         * @param defaultPath - Default file path, not checked
+         * @param hint        - Access pattern hint for the file mapping
+         */
+        vargfile(const char* defaultPath = "", fileAccessHint_e hint = fileAccessHint_e::FILE_ACCESS_NORMAL_e);
+        vargfile(const vargfile& other);                ///< @brief Copy the path and hint, the copy maps the file again on access
+        vargfile& operator=(const vargfile& other);     ///< @brief Copy the path and hint, the copy maps the file again on access
+
+        /**
+         * @brief Unmap the file and destroy the vargfile object
+         */
+        virtual ~vargfile();
+
+        /**
+         * @brief Get the base argument type as a string
+         *
+         * @return const char* - Base type string
+         */
+        virtual const char* getTypeString()             {return "<file>";}
+
+        /**
+         * @brief Return if varg is a list of elements or a single element type
+         *
+         * @return false - Only 0 or 1 argument values are allowed.
+         */
+        virtual bool isList() const                     {return false;}
+
+        /**
+         * @brief Check and save the file path
+         *
+         * @param newValue - File path
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if the path names a readable regular file
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if the file does not exist, is not a regular file or is not readable
+         */
+        virtual valueParseStatus_e setValue(const char* newValue);
+
+        /**
+         * Virtual interface method implementation for the template variable implementation setValue function
+         *
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - file type must have an input string
+         */
+        virtual valueParseStatus_e setValue()           {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
+
+        /**
+         * Virtual interface method implementation for the template variable implementation isEmpty function
+         *
+         * @return true - Base variable is never empty
+         */
+        virtual bool isEmpty()                          {return false;}
+
+        /**
+         * @brief Get the file data, the file is mapped on the first call
+         *
+         * @return const std::byte* - Read only file data, nullptr if the file is empty or could not be mapped
+         */
+        const std::byte* data() const;
+
+        /**
+         * @brief Get the file data size, the file is mapped on the first call
+         *
+         * @return size_t - File data size in bytes, 0 if the file is empty or could not be mapped
+         */
+        size_t size() const                             {data(); return mappedSize;}
+
+        /**
+         * @brief Check if the file is currently mapped
+         *
+         * @return true  - data() is valid
+         * @return false - The file has not been accessed, is empty or could not be mapped
+         */
+        bool isMapped() const                           {return (mappedData != nullptr);}
+}; // end of class definition
+
+}; // end of namespace argparser
+
+/** @} */
@@ -0,0 +1,191 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file vargmap.h
+ * @ingroup libvarg
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include "varg_intf.h"
+#include "flat_string_map.h"
+
+namespace argparser
+{
+
+/**
+ * @brief Duplicate key handling for map arguments
+ */
+enum mapDuplicateKey_e
+{
+    MAP_KEEP_LAST_e = 0,                ///< A repeated key replaces the earlier value
+    MAP_KEEP_FIRST_e,                   ///< A repeated key is ignored
+    MAP_REJECT_DUPLICATE_e,             ///< A repeated key is an invalid input
+};
+
+/**
+ * @brief Map argument template class.  Each element is a "key=value" pair, the
+ *        value string is converted to V with the varg_intf converters and
+ *        stored in a flat hash map.
+ *
+ * @tparam V - Value type, std::string, bool, char or an arithmetic type
+ */
+template <typename V> class vargmap : public varg_intf
+{
+    private:
+        flat_string_map<V>          entryMap;           ///< Key to value map
+        char                        innerDelimiter;     ///< Key value delimiter character
+        mapDuplicateKey_e           duplicatePolicy;    ///< Repeated key handling
+
+    public:
+        /**
+         * @brief Construct an empty vargmap object
+         *
+         * @param keyValueDelimiter - Character between the key and the value
+         * @param duplicateKey      - Repeated key handling
+         */
+        vargmap(char keyValueDelimiter = '=', mapDuplicateKey_e duplicateKey = mapDuplicateKey_e::MAP_KEEP_LAST_e) :
+            varg_intf(), entryMap(), innerDelimiter(keyValueDelimiter), duplicatePolicy(duplicateKey)
+        {
+            setDefaultMinMax<V>();
+        }
+
+        /**
+         * @brief Construct an empty vargmap object with numeric value limits
+         *
+         * @param minValue          - Minimum allowed value
+         * @param maxValue          - Maximum allowed value
+         * @param keyValueDelimiter - Character between the key and the value
+         * @param duplicateKey      - Repeated key handling
+         */
+        vargmap(V minValue, V maxValue, char keyValueDelimiter = '=', mapDuplicateKey_e duplicateKey = mapDuplicateKey_e::MAP_KEEP_LAST_e) :
+            vargmap(keyValueDelimiter, duplicateKey)
+        {
+            static_assert(std::is_arithmetic_v<V> && !std::is_same_v<V, bool> && !std::is_same_v<V, char>, "Only numeric types have limits");
+            if constexpr (std::is_floating_point_v<V>)  setMinMaxDouble(minValue, maxValue);
+            else if constexpr (std::is_unsigned_v<V>)   setMinMaxUnsigned(minValue, maxValue);
+            else                                        setMinMaxSigned(minValue, maxValue);
+        }
+
+        /**
+         * @brief Destroy the vargmap object
+         */
+        virtual ~vargmap() = default;
+
+        /**
+         * @brief Get the base argument type as a string
+         *
+         * @return const char* - Base type string
+         */
+        virtual const char* getTypeString()                             {return "<key=value>";}
+
+        /**
+         * @brief Return if varg is a list of elements or a single element type
+         *
+         * @return true - Multiple key value pairs are allowed
+         */
+        virtual bool isList() const                                     {return true;}
+
+        /**
+         * @brief Split a key value element, convert the value and add it to the map
+         *
+         * @param newValue - Key value element string
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if the element has no key, no delimiter, the value
+         *                                                     could not be translated or the key is a rejected duplicate
+         * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value exceeds lower value limit
+         * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value exceeds upper value limit
+         */
+        virtual valueParseStatus_e setValue(const char* newValue)
+        {
+            const char* delimiterPtr = strchr(newValue, innerDelimiter);
+            if ((delimiterPtr == nullptr) || (delimiterPtr == newValue))
+            {
+                return valueParseStatus_e::PARSE_INVALID_INPUT_e;
+            }
+
+            V entryValue{};
+            valueParseStatus_e status = convertValue(delimiterPtr + 1, entryValue);
+            if (status != valueParseStatus_e::PARSE_SUCCESS_e)
+            {
+                return status;
+            }
+
+            auto [existingValue, inserted] = entryMap.insert(std::string_view(newValue, static_cast<size_t>(delimiterPtr - newValue)), entryValue);
+            if (!inserted)
+            {
+                if (duplicatePolicy == mapDuplicateKey_e::MAP_REJECT_DUPLICATE_e)
+                {
+                    return valueParseStatus_e::PARSE_INVALID_INPUT_e;
+                }
+                else if (duplicatePolicy == mapDuplicateKey_e::MAP_KEEP_LAST_e)
+                {
+                    *existingValue = std::move(entryValue);
+                }
+            }
+            return valueParseStatus_e::PARSE_SUCCESS_e;
+        }
+
+        /**
+         * Virtual interface method implementation for the template variable implementation setValue function
+         *
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - map type must have an input string
+         */
+        virtual valueParseStatus_e setValue()                           {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
+
+        /**
+         * Virtual interface method implementation for the template variable implementation isEmpty function
+         *
+         * @return true - if no entries have been assigned
+         * @return false - if at least one entry has been assigned
+         */
+        virtual bool isEmpty()                                          {return entryMap.empty();}
+
+        /**
+         * @brief Find the value for a key
+         *
+         * @param key - Key to find
+         *
+         * @return const V* - Pointer to the value or nullptr if the key was not assigned
+         */
+        const V* find(std::string_view key) const                       {return entryMap.find(key);}
+
+        /**
+         * @brief Get the key value map
+         *
+         * @return const flat_string_map<V>& - Key value map
+         */
+        const flat_string_map<V>& getMap() const                        {return entryMap;}
+};
+
+}; // end of namespace argparser
+
+/** @} */
@@ -0,0 +1,222 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file vargpattern.h
+ * @ingroup libvarg
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstring>
+#include <string>
+#include <string_view>
+#include "varg_intf.h"
+#include "listvarg.h"
+#include "pattern_matcher.h"
+
+namespace argparser
+{
+/**
+ * @brief Pattern validated string argument.  The pattern is compiled once when
+ *        the argument is constructed and each value is checked with the
+ *        precompiled pattern_matcher before it is stored.
+ */
+class vargpattern : public varg_intf
+{
+    private:
+        pattern_matcher     matcher;        ///< Compiled value pattern
+
+    public:
+        std::string         value;          ///< Current value
+
+        /**
+         * @brief Construct a pattern validated string argument
+         *
+         * @param patternString - Pattern every value must match, see pattern_matcher
+         * @param syntax        - Pattern dialect
+         * @param defaultValue  - Default value, not checked against the pattern
+         */
+        vargpattern(std::string_view patternString, patternSyntax_e syntax = patternSyntax_e::PATTERN_REGEX_e, const char* defaultValue = "") :
+            varg_intf(), matcher(patternString, syntax), value(defaultValue)
+        {
+            setTypeFormat(typeStringFormat_e::TYPE_FMT_STRING);
+        }
+
+        /**
+         * @brief Destroy the vargpattern object
+         */
+        virtual ~vargpattern() = default;
+
+        /**
+         * @brief Check if the pattern compiled, an invalid pattern rejects every value
+         *
+         * @return true  - Pattern is valid
+         * @return false - Pattern is invalid, see getMatcher().getErrorIndex()
+         */
+        bool isPatternValid() const                                 {return matcher.isValid();}
+
+        /**
+         * @brief Get the compiled pattern
+         *
+         * @return const pattern_matcher& - Compiled pattern
+         */
+        const pattern_matcher& getMatcher() const                   {return matcher;}
+
+        /**
+         * @brief Return if varg is a list of elements or a single element type
+         *
+         * @return false - Only 0 or 1 argument values are allowed.
+         */
+        virtual bool isList() const                                 {return false;}
+
+        /**
+         * @brief Check the input string against the pattern and store it if it matches
+         *
+         * @param newValue - Input character string
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if the value matched and was set
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if the value does not match the pattern
+         */
+        virtual valueParseStatus_e setValue(const char* newValue)
+        {
+            if (!matcher.match(newValue))
+            {
+                return valueParseStatus_e::PARSE_INVALID_INPUT_e;
+            }
+            value = newValue;
+            return valueParseStatus_e::PARSE_SUCCESS_e;
+        }
+
+        /**
+         * Virtual interface method implementation for the setValue function
+         *
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - string type must have an input string
+         */
+        virtual valueParseStatus_e setValue()                       {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
+
+        /**
+         * Virtual interface method implementation for the isEmpty function
+         *
+         * @return false - Base variable is never empty
+         */
+        virtual bool isEmpty()                                      {return false;}
+};
+
+/**
+ * @brief Pattern validated string list argument.  Delimited value buffer slices are
+ *        matched in place, only matching values are copied into the list.
+ */
+class listvargpattern : public listvarg<std::string>
+{
+    private:
+        pattern_matcher     matcher;        ///< Compiled value pattern
+
+    public:
+        /**
+         * @brief Construct a pattern validated string list argument
+         *
+         * @param patternString - Pattern every value must match, see pattern_matcher
+         * @param syntax        - Pattern dialect
+         */
+        explicit listvargpattern(std::string_view patternString, patternSyntax_e syntax = patternSyntax_e::PATTERN_REGEX_e) :
+            listvarg<std::string>(), matcher(patternString, syntax) {}
+
+        /**
+         * @brief Destroy the listvargpattern object
+         */
+        virtual ~listvargpattern() = default;
+
+        /**
+         * @brief Check if the pattern compiled, an invalid pattern rejects every value
+         *
+         * @return true  - Pattern is valid
+         * @return false - Pattern is invalid, see getMatcher().getErrorIndex()
+         */
+        bool isPatternValid() const                                 {return matcher.isValid();}
+
+        /**
+         * @brief Get the compiled pattern
+         *
+         * @return const pattern_matcher& - Compiled pattern
+         */
+        const pattern_matcher& getMatcher() const                   {return matcher;}
+
+        /**
+         * @brief Check the input string against the pattern and append it if it matches
+         *
+         * @param newValue - Input character string
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if the value matched and was added
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if the value does not match the pattern
+         */
+        virtual valueParseStatus_e setValue(const char* newValue)
+        {
+            if (!matcher.match(newValue))
+            {
+                return valueParseStatus_e::PARSE_INVALID_INPUT_e;
+            }
+            value.emplace_back(newValue);
+            return valueParseStatus_e::PARSE_SUCCESS_e;
+        }
+
+        using listvarg<std::string>::setValue;
+
+        /**
+         * @brief Match and append each value of a delimited value buffer in order
+         *
+         * @param buffer      - Pointer to the delimited value buffer, does not need to be null terminated
+         * @param length      - Length of the value buffer in characters
+         * @param delimiter   - Value list delimiter character
+         * @param failedIndex - Set to the index of the element that failed if the return is not PARSE_SUCCESS_e
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if all of the values matched
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if an element does not match the pattern
+         */
+        virtual valueParseStatus_e setValueBuffer(const char* buffer, size_t length, char delimiter, size_t& failedIndex)
+        {
+            size_t elementIndex = 0;
+            size_t startPos     = 0;
+            while (startPos < length)
+            {
+                const char*      delimiterPtr = static_cast<const char*>(memchr(buffer + startPos, delimiter, length - startPos));
+                size_t           endPos       = ((delimiterPtr != nullptr) ? static_cast<size_t>(delimiterPtr - buffer) : length);
+                std::string_view element(buffer + startPos, endPos - startPos);
+                if (!matcher.match(element))
+                {
+                    failedIndex = elementIndex;
+                    return valueParseStatus_e::PARSE_INVALID_INPUT_e;
+                }
+
+                value.emplace_back(element);
+                elementIndex++;
+                startPos = endPos + 1;
+            }
+            return valueParseStatus_e::PARSE_SUCCESS_e;
+        }
+};
+
+}; // end of namespace argparser
+
+/** @} */
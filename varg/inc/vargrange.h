@@ -0,0 +1,445 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file vargrange.h
+ * @ingroup libvarg
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <algorithm>
+#include <bitset>
+#include <climits>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "varg_intf.h"
+
+namespace argparser
+{
+/**
+ * @brief Range list argument template class.  Accepts "a", "a-b" and "a-b:step"
+ *        elements, for example "0-15,32-47:2,64", and keeps the values as a
+ *        sorted vector of merged closed intervals.
+ *
+ * A stepped range only contains every step'th value, so it is kept as a
+ * single {first, last, step} entry in a separate list instead of one
+ * interval per member.
+ */
+template <typename T> class vargrange : public varg_intf
+{
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "vargrange only supports integer types");
+
+    public:
+        /**
+         * @brief Closed value interval [first, last]
+         */
+        struct rangeInterval
+        {
+            T   first;      ///< First value in the interval
+            T   last;       ///< Last value in the interval
+        };
+
+        /**
+         * @brief Stepped value range, every step'th value from first to last
+         */
+        struct steppedInterval
+        {
+            T                   first;      ///< First value in the range
+            T                   last;       ///< Last member of the range, first + n * step
+            long long unsigned  step;       ///< Distance between members, > 1
+        };
+
+    private:
+        std::vector<rangeInterval>      intervals;          ///< Sorted, non overlapping, non adjacent intervals
+        std::vector<steppedInterval>    steppedIntervals;   ///< Stepped ranges sorted by first value, same step ranges are merged
+        std::vector<T>                  steppedMaxLast;     ///< Largest last value of each stepped range and every range before it
+
+        /**
+         * @brief Convert a single value string using the argument limits
+         *
+         * @param valueString - Input string
+         * @param newValue    - Converted value
+         *
+         * @return valueParseStatus_e - Conversion status
+         */
+        valueParseStatus_e convertValue(const std::string& valueString, T& newValue) const
+        {
+            valueParseStatus_e status;
+            if constexpr (std::is_signed_v<T>)
+            {
+                long long int tempValue = 0;
+                status = getSignedValue(valueString.c_str(), tempValue);
+                newValue = static_cast<T>(tempValue);
+            }
+            else
+            {
+                long long unsigned tempValue = 0;
+                status = getUnsignedValue(valueString.c_str(), tempValue);
+                newValue = static_cast<T>(tempValue);
+            }
+            return status;
+        }
+
+        /**
+         * @brief Check if nextValue immediately follows lastValue, safe at the limits of T
+         *
+         * @param lastValue - Last value of the lower interval
+         * @param nextValue - First value of the upper interval
+         *
+         * @return true  - nextValue == lastValue + 1
+         * @return false - Values are not adjacent
+         */
+        static bool isAdjacent(T lastValue, T nextValue)
+        {
+            return ((lastValue != std::numeric_limits<T>::max()) && (static_cast<T>(lastValue + 1) == nextValue));
+        }
+
+        /**
+         * @brief Add an interval and merge it with any overlapping or adjacent interval
+         *
+         * @param newInterval - Interval to add, first <= last
+         */
+        void addInterval(rangeInterval newInterval)
+        {
+            // First interval that could merge with the new one
+            auto mergeStart = std::lower_bound(intervals.begin(), intervals.end(), newInterval.first,
+                                               [](const rangeInterval& current, T value)
+                                               {return ((current.last < value) && !isAdjacent(current.last, value));});
+
+            // Extend the new interval over every interval it touches
+            auto mergeEnd = mergeStart;
+            while ((mergeEnd != intervals.end()) &&
+                   ((mergeEnd->first <= newInterval.last) || isAdjacent(newInterval.last, mergeEnd->first)))
+            {
+                newInterval.first = std::min(newInterval.first, mergeEnd->first);
+                newInterval.last  = std::max(newInterval.last, mergeEnd->last);
+                ++mergeEnd;
+            }
+
+            if (mergeStart == mergeEnd)
+            {
+                intervals.insert(mergeStart, newInterval);
+            }
+            else
+            {
+                *mergeStart = newInterval;
+                intervals.erase(mergeStart + 1, mergeEnd);
+            }
+        }
+
+        /**
+         * @brief Add a stepped range, merge it with any same step range that has the
+         *        same member phase and overlaps or directly continues it
+         *
+         * @param newStepped - Stepped range to add, last is a member of the range
+         */
+        void addSteppedInterval(steppedInterval newStepped)
+        {
+            bool merged = true;
+            while (merged)
+            {
+                merged = false;
+                for (auto current = steppedIntervals.begin(); current != steppedIntervals.end(); ++current)
+                {
+                    const steppedInterval& lower = ((current->first < newStepped.first) ? *current : newStepped);
+                    const steppedInterval& upper = ((current->first < newStepped.first) ? newStepped : *current);
+                    const long long unsigned gap = static_cast<long long unsigned>(upper.first) - static_cast<long long unsigned>(lower.first);
+
+                    if ((current->step == newStepped.step) && ((gap % newStepped.step) == 0) &&
+                        ((upper.first <= lower.last) ||
+                         ((static_cast<long long unsigned>(upper.first) - static_cast<long long unsigned>(lower.last)) == newStepped.step)))
+                    {
+                        newStepped.first = lower.first;
+                        newStepped.last  = std::max(lower.last, upper.last);
+                        steppedIntervals.erase(current);
+                        merged = true;
+                        break;
+                    }
+                }
+            }
+
+            auto insertPos = std::upper_bound(steppedIntervals.begin(), steppedIntervals.end(), newStepped.first,
+                                              [](T searchValue, const steppedInterval& current) {return (searchValue < current.first);});
+            steppedIntervals.insert(insertPos, newStepped);
+
+            // Rebuild the running maximum used to bound the lookup
+            steppedMaxLast.resize(steppedIntervals.size());
+            for (size_t index = 0; index < steppedIntervals.size(); index++)
+            {
+                steppedMaxLast[index] = ((index == 0) ? steppedIntervals[index].last : std::max(steppedMaxLast[index - 1], steppedIntervals[index].last));
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct an empty vargrange object with the full range of T allowed
+         */
+        vargrange() : varg_intf(), intervals(), steppedIntervals(), steppedMaxLast()
+        {
+            setDefaultMinMax<T>();
+            setTypeFormat(std::is_signed_v<T> ? typeStringFormat_e::TYPE_FMT_SIGNED : typeStringFormat_e::TYPE_FMT_UNSIGNED);
+        }
+
+        /**
+         * @brief Construct an empty vargrange object with value limits
+         *
+         * @param minValue - Minimum allowed value
+         * @param maxValue - Maximum allowed value
+         */
+        vargrange(T minValue, T maxValue) : vargrange()
+        {
+            if constexpr (std::is_signed_v<T>)  setMinMaxSigned(minValue, maxValue);
+            else                                setMinMaxUnsigned(minValue, maxValue);
+        }
+
+        /**
+         * @brief Destroy the vargrange object
+         */
+        virtual ~vargrange() = default;
+
+        /**
+         * @brief Return if varg is a list of elements or a single element type
+         *
+         * @return true - Multiple range elements are allowed
+         */
+        virtual bool isList() const                                     {return true;}
+
+        /**
+         * @brief Parse a range element and add it to the interval list
+         *
+         * @param newValue - Range element string, "a", "a-b" or "a-b:step"
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated, or a > b, or step is 0
+         * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if a value exceeds lower value limit
+         * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if a value exceeds upper value limit
+         */
+        virtual valueParseStatus_e setValue(const char* newValue)
+        {
+            std::string element = newValue;
+            long long unsigned step = 1;
+
+            // Split off the step
+            size_t stepPos = element.find(':');
+            if (stepPos != std::string::npos)
+            {
+                valueParseStatus_e status = parseUnsignedValue(element.c_str() + stepPos + 1, step, 1, ULLONG_MAX);
+                if (status != valueParseStatus_e::PARSE_SUCCESS_e)
+                {
+                    return valueParseStatus_e::PARSE_INVALID_INPUT_e;
+                }
+                element.erase(stepPos);
+            }
+
+            // Split the range, skip a leading sign on the first value
+            rangeInterval newInterval;
+            size_t rangePos = ((element.size() > 1) ? element.find('-', 1) : std::string::npos);
+            valueParseStatus_e status = convertValue(element.substr(0, rangePos), newInterval.first);
+            if ((status == valueParseStatus_e::PARSE_SUCCESS_e) && (rangePos != std::string::npos))
+            {
+                status = convertValue(element.substr(rangePos + 1), newInterval.last);
+            }
+            else
+            {
+                newInterval.last = newInterval.first;
+            }
+
+            if (status != valueParseStatus_e::PARSE_SUCCESS_e)
+            {
+                return status;
+            }
+            if (newInterval.first > newInterval.last)
+            {
+                return valueParseStatus_e::PARSE_INVALID_INPUT_e;
+            }
+
+            // Trim the range to its last member, a single member range is a plain interval
+            const long long unsigned span = static_cast<long long unsigned>(newInterval.last) - static_cast<long long unsigned>(newInterval.first);
+            if ((step == 1) || (span < step))
+            {
+                if (span < step)
+                {
+                    newInterval.last = newInterval.first;
+                }
+                addInterval(newInterval);
+            }
+            else
+            {
+                steppedInterval newStepped;
+                newStepped.first = newInterval.first;
+                newStepped.last  = static_cast<T>(static_cast<long long unsigned>(newInterval.first) + ((span / step) * step));
+                newStepped.step  = step;
+                addSteppedInterval(newStepped);
+            }
+            return valueParseStatus_e::PARSE_SUCCESS_e;
+        }
+
+        /**
+         * Virtual interface method implementation for the template variable implementation setValue function
+         *
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - range type must have an input string
+         */
+        virtual valueParseStatus_e setValue()                           {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
+
+        /**
+         * Virtual interface method implementation for the template variable implementation isEmpty function
+         *
+         * @return true - if no values have been assigned
+         * @return false - if at least one value has been assigned
+         */
+        virtual bool isEmpty()                                          {return (intervals.empty() && steppedIntervals.empty());}
+
+        /**
+         * @brief Check if a value is in one of the ranges
+         *
+         * @param value - Value to check
+         *
+         * @return true  - Value is in the range list
+         * @return false - Value is not in the range list
+         */
+        bool contains(T value) const
+        {
+            auto nextInterval = std::upper_bound(intervals.begin(), intervals.end(), value,
+                                                 [](T searchValue, const rangeInterval& current) {return (searchValue < current.first);});
+            if ((nextInterval != intervals.begin()) && (value <= (nextInterval - 1)->last))
+            {
+                return true;
+            }
+
+            // Walk back from the last range that starts at or before the value, stop once no
+            // earlier range reaches the value
+            auto nextStepped = std::upper_bound(steppedIntervals.begin(), steppedIntervals.end(), value,
+                                                [](T searchValue, const steppedInterval& current) {return (searchValue < current.first);});
+            for (size_t index = static_cast<size_t>(nextStepped - steppedIntervals.begin()); (index != 0) && (value <= steppedMaxLast[index - 1]); index--)
+            {
+                const steppedInterval& current = steppedIntervals[index - 1];
+                if ((value <= current.last) &&
+                    (((static_cast<long long unsigned>(value) - static_cast<long long unsigned>(current.first)) % current.step) == 0))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Get the sorted, merged interval list
+         *
+         * @return const std::vector<rangeInterval>& - Interval list
+         */
+        const std::vector<rangeInterval>& getIntervals() const          {return intervals;}
+
+        /**
+         * @brief Get the stepped range list, sorted by first value
+         *
+         * @return const std::vector<steppedInterval>& - Stepped range list
+         */
+        const std::vector<steppedInterval>& getSteppedIntervals() const {return steppedIntervals;}
+
+        /**
+         * @brief Export the range list as a bit mask, bit n is set if value n is in the
+         *        range list.  Values outside [0, MaskBits) are not represented, so a
+         *        std::bitset<1024> matches the layout of a CPU set.
+         *
+         * @tparam MaskBits - Number of bits in the mask
+         *
+         * @return std::bitset<MaskBits> - Value bit mask
+         */
+        template <size_t MaskBits> std::bitset<MaskBits> toBitset() const
+        {
+            std::bitset<MaskBits> mask;
+            for (auto const& current : intervals)
+            {
+                T firstValue = current.first;
+                if constexpr (std::is_signed_v<T>)
+                {
+                    if (current.last < 0)
+                    {
+                        continue;
+                    }
+                    firstValue = std::max(firstValue, static_cast<T>(0));
+                }
+                if (static_cast<long long unsigned>(firstValue) >= MaskBits)
+                {
+                    continue;
+                }
+
+                const size_t firstBit = static_cast<size_t>(firstValue);
+                const size_t lastBit  = std::min(static_cast<size_t>(current.last), MaskBits - 1);
+                for (size_t bit = firstBit; bit <= lastBit; bit++)
+                {
+                    mask.set(bit);
+                }
+            }
+
+            for (auto const& current : steppedIntervals)
+            {
+                // Offset of the first member that is not negative
+                long long unsigned firstOffset = 0;
+                if constexpr (std::is_signed_v<T>)
+                {
+                    if (current.last < 0)
+                    {
+                        continue;
+                    }
+                    if (current.first < 0)
+                    {
+                        const long long unsigned span         = static_cast<long long unsigned>(current.last) - static_cast<long long unsigned>(current.first);
+                        const long long unsigned toZero       = 0ULL - static_cast<long long unsigned>(current.first);
+                        const long long unsigned firstMember  = (toZero / current.step) + (((toZero % current.step) != 0) ? 1 : 0);
+                        if (firstMember > (span / current.step))
+                        {
+                            continue;
+                        }
+                        firstOffset = firstMember * current.step;
+                    }
+                }
+
+                const T firstValue = static_cast<T>(static_cast<long long unsigned>(current.first) + firstOffset);
+                if (static_cast<long long unsigned>(firstValue) >= MaskBits)
+                {
+                    continue;
+                }
+
+                const size_t lastBit = std::min(static_cast<size_t>(current.last), MaskBits - 1);
+                for (size_t bit = static_cast<size_t>(firstValue); ; bit += static_cast<size_t>(current.step))
+                {
+                    mask.set(bit);
+                    if ((lastBit - bit) < current.step)
+                    {
+                        break;
+                    }
+                }
+            }
+            return mask;
+        }
+};
+
+}; // end of namespace argparser
+
+/** @} */
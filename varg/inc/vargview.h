@@ -0,0 +1,274 @@
+/*
+ Copyright (c) 2022-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file vargview.h
+ * @ingroup libvarg
+ * @{
+ */
+
+#pragma once
+
+// Includes
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include "varg_intf.h"
+
+namespace argparser
+{
+/**
+ * @brief Borrowed string argument.  The value is a view of the parser argument
+ *        storage, no copy is made.  The view is valid until the parser object is
+ *        destroyed or parse() is called again.
+ */
+class vargview : public varg_intf
+{
+    public:
+        std::string_view            value;          ///< Current value, borrowed from the parse session
+
+        /**
+         * @brief Construct a vargview object
+         *
+         * @param defaultValue - Default value, the string must outlive the vargview object
+         */
+        vargview(const char* defaultValue = ""): varg_intf(), value(defaultValue)   {setTypeFormat(typeStringFormat_e::TYPE_FMT_STRING);}
+
+        /**
+         * @brief Destroy the vargview object
+         */
+        virtual ~vargview() = default;
+
+        /**
+         * @brief Return if varg is a list of elements or a single element type
+         *
+         * @return false - Only 0 or 1 argument values are allowed.
+         */
+        virtual bool isList() const                                 {return false;}
+
+        /**
+         * @brief Virtual interface method implementation for the setValue with input function
+         *
+         * @param newValue - Input character string, must stay valid for the parse session
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e - String values always succeed
+         */
+        virtual valueParseStatus_e setValue(const char* newValue)   {value = std::string_view(newValue); return valueParseStatus_e::PARSE_SUCCESS_e;}
+
+        /**
+         * Virtual interface method implementation for the setValue function
+         *
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - string type must have an input string
+         */
+        virtual valueParseStatus_e setValue()                       {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
+
+        /**
+         * @brief Borrow the value buffer slice, no copy or null termination is needed
+         *
+         * @param buffer      - Pointer to the value buffer, must stay valid for the parse session
+         * @param length      - Length of the value buffer in characters
+         * @param delimiter   - Value list delimiter character
+         * @param failedIndex - Not used, the assignment can not fail
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e - String values always succeed
+         */
+        virtual valueParseStatus_e setValueBuffer(const char* buffer, size_t length, char delimiter, size_t& /* failedIndex */)
+        {
+            const char* delimiterPtr = static_cast<const char*>(memchr(buffer, delimiter, length));
+            value = std::string_view(buffer, ((delimiterPtr != nullptr) ? static_cast<size_t>(delimiterPtr - buffer) : length));
+            return valueParseStatus_e::PARSE_SUCCESS_e;
+        }
+
+        /**
+         * Virtual interface method implementation for the isEmpty function
+         *
+         * @return false - Base variable is never empty
+         */
+        virtual bool isEmpty()                                      {return false;}
+};
+
+/**
+ * @brief Lazily converted numeric argument.  The raw value slice is borrowed from
+ *        the parser argument storage and only converted on the first getValue()
+ *        or validate() call, the result is cached.  The slice is valid until the
+ *        parser object is destroyed or parse() is called again.
+ */
+template <typename T> class varglazy : public varg_intf
+{
+    static_assert(std::is_arithmetic_v<T>, "varglazy only supports arithmetic types");
+
+    private:
+        std::string_view            rawValue;           ///< Unconverted value slice, empty if no value was assigned
+        mutable T                   value;              ///< Converted or default value
+        mutable valueParseStatus_e  conversionStatus;   ///< Status of the cached conversion
+        mutable bool                converted;          ///< True if rawValue has been converted
+
+        /**
+         * @brief Select the type string format matching T
+         */
+        void setTypeFormatForType()
+        {
+            if constexpr (std::is_same_v<T, bool>)              setTypeFormat(typeStringFormat_e::TYPE_FMT_BOOL);
+            else if constexpr (std::is_same_v<T, char>)         setTypeFormat(typeStringFormat_e::TYPE_FMT_CHAR);
+            else if constexpr (std::is_floating_point_v<T>)     setTypeFormat(typeStringFormat_e::TYPE_FMT_DOUBLE);
+            else if constexpr (std::is_unsigned_v<T>)           setTypeFormat(typeStringFormat_e::TYPE_FMT_UNSIGNED);
+            else                                                setTypeFormat(typeStringFormat_e::TYPE_FMT_SIGNED);
+        }
+
+        /**
+         * @brief Convert the raw value slice once and cache the result
+         *
+         * @return valueParseStatus_e - Cached conversion status
+         */
+        valueParseStatus_e convert() const
+        {
+            if (!converted)
+            {
+                converted = true;
+                if (!rawValue.empty())
+                {
+                    // The slice may be part of a delimited list, copy to null terminate it
+                    std::string valueString(rawValue);
+                    T newValue{};
+                    conversionStatus = convertValue(valueString.c_str(), newValue);
+                    if (conversionStatus == valueParseStatus_e::PARSE_SUCCESS_e)
+                    {
+                        value = newValue;
+                    }
+                }
+            }
+            return conversionStatus;
+        }
+
+    public:
+        /**
+         * @brief Construct a varglazy object
+         *
+         * @param defaultValue - Value returned if no value is assigned or the assigned value is invalid
+         */
+        varglazy(T defaultValue) : varg_intf(), rawValue(), value(defaultValue),
+            conversionStatus(valueParseStatus_e::PARSE_SUCCESS_e), converted(true)
+        {
+            setDefaultMinMax<T>();
+            setTypeFormatForType();
+        }
+
+        /**
+         * @brief Construct a bounded varglazy object
+         *
+         * @param defaultValue - Value returned if no value is assigned or the assigned value is invalid
+         * @param minValue     - Minimum allowed value
+         * @param maxValue     - Maximum allowed value
+         */
+        varglazy(T defaultValue, T minValue, T maxValue) : varglazy(defaultValue)
+        {
+            static_assert(!std::is_same_v<T, bool> && !std::is_same_v<T, char>, "Only numeric types have limits");
+            if constexpr (std::is_floating_point_v<T>)  setMinMaxDouble(minValue, maxValue);
+            else if constexpr (std::is_unsigned_v<T>)   setMinMaxUnsigned(minValue, maxValue);
+            else                                        setMinMaxSigned(minValue, maxValue);
+        }
+
+        /**
+         * @brief Destroy the varglazy object
+         */
+        virtual ~varglazy() = default;
+
+        /**
+         * @brief Return if varg is a list of elements or a single element type
+         *
+         * @return false - Only 0 or 1 argument values are allowed.
+         */
+        virtual bool isList() const                                 {return false;}
+
+        /**
+         * @brief Save the value string for a later conversion
+         *
+         * @param newValue - Input character string, must stay valid for the parse session
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e - Conversion errors are reported by validate()
+         */
+        virtual valueParseStatus_e setValue(const char* newValue)
+        {
+            size_t failedIndex = 0;
+            return setValueBuffer(newValue, strlen(newValue), '\0', failedIndex);
+        }
+
+        /**
+         * Virtual interface method implementation for the setValue function
+         *
+         * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - lazy type must have an input string
+         */
+        virtual valueParseStatus_e setValue()                       {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
+
+        /**
+         * @brief Save the value buffer slice for a later conversion
+         *
+         * @param buffer      - Pointer to the value buffer, must stay valid for the parse session
+         * @param length      - Length of the value buffer in characters
+         * @param delimiter   - Value list delimiter character
+         * @param failedIndex - Not used, conversion errors are reported by validate()
+         *
+         * @return valueParseStatus_e::PARSE_SUCCESS_e - Conversion errors are reported by validate()
+         */
+        virtual valueParseStatus_e setValueBuffer(const char* buffer, size_t length, char delimiter, size_t& /* failedIndex */)
+        {
+            const char* delimiterPtr = static_cast<const char*>(memchr(buffer, delimiter, length));
+            rawValue = std::string_view(buffer, ((delimiterPtr != nullptr) ? static_cast<size_t>(delimiterPtr - buffer) : length));
+            conversionStatus = valueParseStatus_e::PARSE_SUCCESS_e;
+            converted = false;
+            return valueParseStatus_e::PARSE_SUCCESS_e;
+        }
+
+        /**
+         * @brief Convert the saved value string if it has not been converted yet
+         *
+         * @return valueParseStatus_e - Conversion status
+         */
+        virtual valueParseStatus_e validate()                       {return convert();}
+
+        /**
+         * Virtual interface method implementation for the isEmpty function
+         *
+         * @return false - Base variable is never empty
+         */
+        virtual bool isEmpty()                                      {return false;}
+
+        /**
+         * @brief Get the value, converting the saved value string on the first call
+         *
+         * @return const T& - Converted value, or the default value if the conversion failed
+         */
+        const T& getValue() const                                   {convert(); return value;}
+
+        /**
+         * @brief Get the saved value string
+         *
+         * @return std::string_view - Unconverted value string
+         */
+        std::string_view getRawValue() const                        {return rawValue;}
+};
+
+}; // end of namespace argparser
+
+/** @} */
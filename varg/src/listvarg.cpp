@@ -39,255 +39,149 @@ using namespace argparser;
 //============================================================================================================================
 //============================================================================================================================
 /**
- * @brief Set the value of a signed list element and add the new element to the value list object
+ * @brief Convert a signed list element input string without adding it to the value list
  *
  * @param newValue - input argument string
+ * @param element  - Converted element value
  *
- * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
- * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
- * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value exceeds lower value limit
- * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value exceeds upper value limit
+ * @return valueParseStatus_e - Conversion status
  */
-template <> valueParseStatus_e listvarg<short unsigned>::setSignedElementValue(const char* newValue)        {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-template <> valueParseStatus_e listvarg<unsigned>::setSignedElementValue(const char* newValue)              {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-template <> valueParseStatus_e listvarg<long unsigned>::setSignedElementValue(const char* newValue)         {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-template <> valueParseStatus_e listvarg<long long unsigned>::setSignedElementValue(const char* newValue)    {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-template <> valueParseStatus_e listvarg<double>::setSignedElementValue(const char* newValue)                {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-template <> valueParseStatus_e listvarg<char>::setSignedElementValue(const char* newValue)                  {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-template <> valueParseStatus_e listvarg<bool>::setSignedElementValue(const char* newValue)                  {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-template <> valueParseStatus_e listvarg<std::string>::setSignedElementValue(const char* newValue)           {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-
-template <typename T> valueParseStatus_e listvarg<T>::setSignedElementValue(const char* newValue)
+template <typename T> valueParseStatus_e listvarg_base<T>::convertSignedElement(const char* newValue, T& element) const
 {
     long long int tempValue;
     valueParseStatus_e status = varg_intf::getSignedValue(newValue, tempValue);
     if (status == valueParseStatus_e::PARSE_SUCCESS_e)
     {
-        T element = static_cast<T>(tempValue);
-        value.push_back(element);
+        element = static_cast<T>(tempValue);
     }
     return status;
 }
 
 /**
- * @brief Set the value of an unsigned list element and add the new element to the value list object
+ * @brief Convert an unsigned list element input string without adding it to the value list
  *
  * @param newValue - input argument string
+ * @param element  - Converted element value
  *
- * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
- * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
- * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value exceeds lower value limit
- * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value exceeds upper value limit
+ * @return valueParseStatus_e - Conversion status
  */
-template <> valueParseStatus_e listvarg<short int>::setUnsignedElementValue(const char* newValue)           {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-template <> valueParseStatus_e listvarg<int>::setUnsignedElementValue(const char* newValue)                 {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-template <> valueParseStatus_e listvarg<long int>::setUnsignedElementValue(const char* newValue)            {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-template <> valueParseStatus_e listvarg<long long int>::setUnsignedElementValue(const char* newValue)       {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-template <> valueParseStatus_e listvarg<double>::setUnsignedElementValue(const char* newValue)              {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-template <> valueParseStatus_e listvarg<char>::setUnsignedElementValue(const char* newValue)                {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-template <> valueParseStatus_e listvarg<bool>::setUnsignedElementValue(const char* newValue)                {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-template <> valueParseStatus_e listvarg<std::string>::setUnsignedElementValue(const char* newValue)         {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-
-template <typename T> valueParseStatus_e listvarg<T>::setUnsignedElementValue(const char* newValue)
+template <typename T> valueParseStatus_e listvarg_base<T>::convertUnsignedElement(const char* newValue, T& element) const
 {
     long long unsigned tempValue;
     valueParseStatus_e status = varg_intf::getUnsignedValue(newValue, tempValue);
     if (status == valueParseStatus_e::PARSE_SUCCESS_e)
     {
-        T element = static_cast<T>(tempValue);
-        value.push_back(element);
+        element = static_cast<T>(tempValue);
     }
     return status;
 }
 
 /**
- * @brief Set the value of a double list element and add the new element to the value list object
+ * @brief Convert the input string to an element value without adding it to the value list.
+ *        Used by the parallel buffer conversion, must not modify the object.
  *
  * @param newValue - input argument string
+ * @param element  - Converted element value
  *
- * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
+ * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully converted
  * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
  * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value exceeds lower value limit
  * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value exceeds upper value limit
  */
-template <> valueParseStatus_e listvarg<double>::setDoubleElementValue(const char* newValue)
-{
-    double element;
-    valueParseStatus_e status = varg_intf::getDoubleValue(newValue, element);
-    if (status == valueParseStatus_e::PARSE_SUCCESS_e)
-    {
-        value.push_back(element);
-    }
-    return status;
-}
-
-template <typename T> valueParseStatus_e listvarg<T>::setDoubleElementValue(const char* newValue)           {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-
-/**
- * @brief Set the Element Value object
- *
- * @param newValue - input argument string
- *
- * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
- * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
- */
-template <> valueParseStatus_e listvarg<char>::setCharElementValue(const char* newValue)
-{
-    char element;
-    valueParseStatus_e status = varg_intf::getCharValue(newValue, element);
-    if (valueParseStatus_e::PARSE_SUCCESS_e == status)
-    {
-        value.push_back(element);
-    }
-    return status;
-}
-
-/**
- * @brief Set the Bool Value object
- *
- * @param newValue - input argument string
- *
- * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
- * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
- */
-template <> valueParseStatus_e listvarg<bool>::setBoolElementValue(const char* newValue)
-{
-    bool element;
-    valueParseStatus_e status = varg_intf::getBoolValue(newValue, element);
-    if (valueParseStatus_e::PARSE_SUCCESS_e == status)
-    {
-        value.push_back(element);
-    }
-    return status;
-}
-template <typename T> valueParseStatus_e listvarg<T>::setBoolElementValue(const char* newValue)     {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-
-/**
- * @brief Set the string Value object
- *
- * @param newValue - input argument string
- *
- * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
- * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
- */
-template <> valueParseStatus_e listvarg<std::string>::setStringElementValue(const char* newValue)
-{
-    std::string element = newValue;
-    value.push_back(element);
+template <> valueParseStatus_e listvarg_base<short int>::convertElement(const char* newValue, short int& element) const                   {return convertSignedElement(newValue, element);}
+template <> valueParseStatus_e listvarg_base<int>::convertElement(const char* newValue, int& element) const                               {return convertSignedElement(newValue, element);}
+template <> valueParseStatus_e listvarg_base<long int>::convertElement(const char* newValue, long int& element) const                     {return convertSignedElement(newValue, element);}
+template <> valueParseStatus_e listvarg_base<long long int>::convertElement(const char* newValue, long long int& element) const           {return convertSignedElement(newValue, element);}
+
+template <> valueParseStatus_e listvarg_base<short unsigned>::convertElement(const char* newValue, short unsigned& element) const         {return convertUnsignedElement(newValue, element);}
+template <> valueParseStatus_e listvarg_base<unsigned>::convertElement(const char* newValue, unsigned& element) const                     {return convertUnsignedElement(newValue, element);}
+template <> valueParseStatus_e listvarg_base<long unsigned>::convertElement(const char* newValue, long unsigned& element) const           {return convertUnsignedElement(newValue, element);}
+template <> valueParseStatus_e listvarg_base<long long unsigned>::convertElement(const char* newValue, long long unsigned& element) const {return convertUnsignedElement(newValue, element);}
+
+template <> valueParseStatus_e listvarg_base<double>::convertElement(const char* newValue, double& element) const                         {return varg_intf::getDoubleValue(newValue, element);}
+template <> valueParseStatus_e listvarg_base<char>::convertElement(const char* newValue, char& element) const                             {return varg_intf::getCharValue(newValue, element);}
+template <> valueParseStatus_e listvarg_base<bool>::convertElement(const char* newValue, bool& element) const                             {return varg_intf::getBoolValue(newValue, element);}
+template <> valueParseStatus_e listvarg_base<std::string>::convertElement(const char* newValue, std::string& element) const
+{
+    element = newValue;
     return valueParseStatus_e::PARSE_SUCCESS_e;
 }
 
-template <typename T> valueParseStatus_e listvarg<T>::setStringElementValue(const char* newValue)   {return valueParseStatus_e::PARSE_INVALID_INPUT_e;}
-
 //============================================================================================================================
 //============================================================================================================================
 //  Constructor
 //============================================================================================================================
 //============================================================================================================================
 /**
- * @brief Construct a varg_intf object
+ * @brief Construct a list argument base object
  */
-template <> listvarg<short int>::listvarg()
+template <> listvarg_base<short int>::listvarg_base()
 {
-    value.clear();
     varg_intf::setMinMaxSigned(SHRT_MIN, SHRT_MAX);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_SIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_SIGNED);
 }
 
-template <> listvarg<int>::listvarg()
+template <> listvarg_base<int>::listvarg_base()
 {
-    value.clear();
     varg_intf::setMinMaxSigned(INT_MIN, INT_MAX);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_SIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_SIGNED);
 }
 
-template <> listvarg<long int>::listvarg()
+template <> listvarg_base<long int>::listvarg_base()
 {
-    value.clear();
     varg_intf::setMinMaxSigned(LONG_MIN, LONG_MAX);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_SIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_SIGNED);
 }
 
-template <> listvarg<long long int>::listvarg()
+template <> listvarg_base<long long int>::listvarg_base()
 {
-    value.clear();
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_SIGNED);
+    varg_intf::setMinMaxSigned(LLONG_MIN, LLONG_MAX);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_SIGNED);
 }
 
-template <> listvarg<short unsigned>::listvarg()
+template <> listvarg_base<short unsigned>::listvarg_base()
 {
-    value.clear();
     varg_intf::setMinMaxUnsigned(0ULL, USHRT_MAX);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_UNSIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_UNSIGNED);
 }
 
-template <> listvarg<unsigned>::listvarg()
+template <> listvarg_base<unsigned>::listvarg_base()
 {
-    value.clear();
     varg_intf::setMinMaxUnsigned(0ULL, UINT_MAX);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_UNSIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_UNSIGNED);
 }
 
-template <> listvarg<long unsigned>::listvarg()
+template <> listvarg_base<long unsigned>::listvarg_base()
 {
-    value.clear();
     varg_intf::setMinMaxUnsigned(0ULL, ULONG_MAX);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_UNSIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_UNSIGNED);
 }
 
-template <> listvarg<long long unsigned>::listvarg()
+template <> listvarg_base<long long unsigned>::listvarg_base()
 {
-    value.clear();
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_UNSIGNED);
+    varg_intf::setMinMaxUnsigned(0ULL, ULLONG_MAX);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_UNSIGNED);
 }
 
-template <> listvarg<double>::listvarg()
+template <> listvarg_base<double>::listvarg_base()
 {
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_DOUBLE);
+    varg_intf::setMinMaxDouble(std::numeric_limits<double>::min(), std::numeric_limits<double>::max());
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_DOUBLE);
 }
 
-template <> listvarg<char>::listvarg()
+template <> listvarg_base<char>::listvarg_base()
 {
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_CHAR);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_CHAR);
 }
 
-template <> listvarg<bool>::listvarg()
+template <> listvarg_base<bool>::listvarg_base()
 {
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_BOOL);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_BOOL);
 }
 
-template <> listvarg<std::string>::listvarg()
+template <> listvarg_base<std::string>::listvarg_base()
 {
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_STRING);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_STRING);
 }
 
-//============================================================================================================================
-//============================================================================================================================
-//  Public functions
-//============================================================================================================================
-//============================================================================================================================
-/**
- * @brief Set value from input string specializations
- *
- * @param newValue - Input string to parse
- *
- * @return true - if argment string was parsed
- * @return false - if argment string failed to properly parse
- */
-template <> valueParseStatus_e listvarg<short int>::setValue(const char* newValue)          {return setSignedElementValue(newValue);}
-template <> valueParseStatus_e listvarg<int>::setValue(const char* newValue)                {return setSignedElementValue(newValue);}
-template <> valueParseStatus_e listvarg<long int>::setValue(const char* newValue)           {return setSignedElementValue(newValue);}
-template <> valueParseStatus_e listvarg<long long int>::setValue(const char* newValue)      {return setSignedElementValue(newValue);}
-
-template <> valueParseStatus_e listvarg<short unsigned>::setValue(const char* newValue)     {return setUnsignedElementValue(newValue);}
-template <> valueParseStatus_e listvarg<unsigned>::setValue(const char* newValue)           {return setUnsignedElementValue(newValue);}
-template <> valueParseStatus_e listvarg<long unsigned>::setValue(const char* newValue)      {return setUnsignedElementValue(newValue);}
-template <> valueParseStatus_e listvarg<long long unsigned>::setValue(const char* newValue) {return setUnsignedElementValue(newValue);}
-
-template <> valueParseStatus_e listvarg<double>::setValue(const char* newValue)             {return setDoubleElementValue(newValue);}
-
-template <> valueParseStatus_e listvarg<char>::setValue(const char* newValue)               {return setCharElementValue(newValue);}
-template <> valueParseStatus_e listvarg<bool>::setValue(const char* newValue)               {return setBoolElementValue(newValue);}
-template <> valueParseStatus_e listvarg<std::string>::setValue(const char* newValue)        {return setStringElementValue(newValue);}
-
 /** @} */
@@ -0,0 +1,562 @@
+/* 
+ Copyright (c) 2022-2024 Randal Eike
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a 
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file pattern_matcher.cpp
+ * @ingroup argparser
+ * @defgroup Argument parsing utilities
+ * @{
+ */
+
+// Includes
+#include "pattern_matcher.h"
+
+using namespace argparser;
+
+//============================================================================================================================
+//============================================================================================================================
+//  Private functions
+//============================================================================================================================
+//============================================================================================================================
+
+namespace
+{
+
+/**
+ * @brief Get the index of the lowest set bit
+ *
+ * @param positionBits - Position set, must not be zero
+ *
+ * @return size_t - Lowest position index
+ */
+inline size_t lowestPosition(uint64_t positionBits)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_ctzll(positionBits));
+#else
+    size_t position = 0;
+    while ((positionBits & 1) == 0)
+    {
+        positionBits >>= 1;
+        position++;
+    }
+    return position;
+#endif
+}
+
+}; // end of anonymous namespace
+
+/**
+ * @brief Add a character position
+ *
+ * @param acceptSet - Input bytes the position accepts
+ *
+ * @return positionSet - Single position set, not nullable
+ */
+pattern_matcher::positionSet pattern_matcher::addPosition(const charClass& acceptSet)
+{
+    const uint64_t positionBit = 1ULL << positionCount;
+    for (size_t byteValue = 0; byteValue < acceptSet.size(); byteValue++)
+    {
+        if (acceptSet.test(byteValue))
+        {
+            charMask[byteValue] |= positionBit;
+        }
+    }
+    positionCount++;
+    return {positionBit, positionBit, false};
+}
+
+/**
+ * @brief Concatenate two sub expressions, every last position of the left side may
+ *        be followed by every first position of the right side
+ *
+ * @param left  - Left sub expression
+ * @param right - Right sub expression
+ *
+ * @return positionSet - Concatenated sub expression
+ */
+pattern_matcher::positionSet pattern_matcher::concatenate(const positionSet& left, const positionSet& right)
+{
+    for (uint64_t lastBits = left.last; lastBits != 0; lastBits &= (lastBits - 1))
+    {
+        follow[lowestPosition(lastBits)] |= right.first;
+    }
+
+    return {left.first | (left.nullable ? right.first : 0),
+            right.last | (right.nullable ? left.last : 0),
+            left.nullable && right.nullable};
+}
+
+/**
+ * @brief Allow a sub expression to repeat, every last position may be followed by
+ *        every first position
+ *
+ * @param inner - Sub expression to repeat
+ *
+ * @return positionSet - Repeated sub expression, nullable is unchanged
+ */
+pattern_matcher::positionSet pattern_matcher::repeat(const positionSet& inner)
+{
+    for (uint64_t lastBits = inner.last; lastBits != 0; lastBits &= (lastBits - 1))
+    {
+        follow[lowestPosition(lastBits)] |= inner.first;
+    }
+    return inner;
+}
+
+/**
+ * @brief Record a compile error at the current pattern index
+ *
+ * @return false - Always, for use in return statements
+ */
+bool pattern_matcher::setError()
+{
+    errorIndex = patternIndex;
+    return false;
+}
+
+/**
+ * @brief Get the class of a \\d \\w \\s \\D \\W \\S escape
+ *
+ * @param escapeChar - Character following the '\\'
+ * @param acceptSet  - Returned class
+ *
+ * @return true  - escapeChar is a class escape
+ * @return false - escapeChar is a literal escape
+ */
+bool pattern_matcher::parseEscapeClass(char escapeChar, charClass& acceptSet) const
+{
+    acceptSet.reset();
+    switch (escapeChar | 0x20)
+    {
+        case 'd':
+            for (int byteValue = '0'; byteValue <= '9'; byteValue++)
+            {
+                acceptSet.set(byteValue);
+            }
+            break;
+
+        case 'w':
+            for (int byteValue = 0; byteValue < 128; byteValue++)
+            {
+                if (((byteValue >= '0') && (byteValue <= '9')) || ((byteValue | 0x20) >= 'a' && (byteValue | 0x20) <= 'z') || (byteValue == '_'))
+                {
+                    acceptSet.set(byteValue);
+                }
+            }
+            break;
+
+        case 's':
+            for (char spaceChar : {' ', '\t', '\n', '\r', '\f', '\v'})
+            {
+                acceptSet.set(static_cast<unsigned char>(spaceChar));
+            }
+            break;
+
+        default:
+            return false;
+    }
+
+    // Upper case escapes are the negated class
+    if ((escapeChar >= 'A') && (escapeChar <= 'Z'))
+    {
+        acceptSet.flip();
+    }
+    return true;
+}
+
+/**
+ * @brief Parse a [...] class, the pattern index is just past the '['
+ *
+ * @param acceptSet  - Returned class
+ * @param negateChar - Character that negates the class when it is first
+ *
+ * @return true  - Class parsed, the pattern index is just past the ']'
+ * @return false - Class is not terminated
+ */
+bool pattern_matcher::parseClass(charClass& acceptSet, char negateChar)
+{
+    acceptSet.reset();
+    bool negate = false;
+    if ((patternIndex < pattern.size()) && (pattern[patternIndex] == negateChar))
+    {
+        negate = true;
+        patternIndex++;
+    }
+
+    // A ']' right after the opening is a literal
+    bool firstChar = true;
+    while ((patternIndex < pattern.size()) && ((pattern[patternIndex] != ']') || firstChar))
+    {
+        firstChar = false;
+        auto rangeStart = static_cast<unsigned char>(pattern[patternIndex++]);
+        if (rangeStart == '\\')
+        {
+            if (patternIndex >= pattern.size())
+            {
+                return setError();
+            }
+
+            charClass escapeSet;
+            if (parseEscapeClass(pattern[patternIndex], escapeSet))
+            {
+                acceptSet |= escapeSet;
+                patternIndex++;
+                continue;
+            }
+            rangeStart = static_cast<unsigned char>(pattern[patternIndex++]);
+        }
+
+        auto rangeEnd = rangeStart;
+        if (((patternIndex + 1) < pattern.size()) && (pattern[patternIndex] == '-') && (pattern[patternIndex + 1] != ']'))
+        {
+            rangeEnd = static_cast<unsigned char>(pattern[patternIndex + 1]);
+            patternIndex += 2;
+            if (rangeEnd < rangeStart)
+            {
+                return setError();
+            }
+        }
+
+        for (unsigned byteValue = rangeStart; byteValue <= rangeEnd; byteValue++)
+        {
+            acceptSet.set(byteValue);
+        }
+    }
+
+    if (patternIndex >= pattern.size())
+    {
+        return setError();
+    }
+    patternIndex++;
+
+    if (negate)
+    {
+        acceptSet.flip();
+    }
+    return true;
+}
+
+/**
+ * @brief Parse alternatives separated by '|'
+ *
+ * @param result - Returned sub expression
+ *
+ * @return true  - Parsed
+ * @return false - Compile error
+ */
+bool pattern_matcher::parseAlternation(positionSet& result)
+{
+    if (!parseSequence(result))
+    {
+        return false;
+    }
+
+    while ((patternIndex < pattern.size()) && (pattern[patternIndex] == '|'))
+    {
+        patternIndex++;
+        positionSet alternative;
+        if (!parseSequence(alternative))
+        {
+            return false;
+        }
+        result = {result.first | alternative.first, result.last | alternative.last, result.nullable || alternative.nullable};
+    }
+    return true;
+}
+
+/**
+ * @brief Parse a sequence of quantified atoms up to a '|', ')' or the pattern end
+ *
+ * @param result - Returned sub expression, the empty sequence is nullable
+ *
+ * @return true  - Parsed
+ * @return false - Compile error
+ */
+bool pattern_matcher::parseSequence(positionSet& result)
+{
+    result = {0, 0, true};
+    while ((patternIndex < pattern.size()) && (pattern[patternIndex] != '|') && (pattern[patternIndex] != ')'))
+    {
+        positionSet element;
+        if (!parseRepeat(element))
+        {
+            return false;
+        }
+        result = concatenate(result, element);
+    }
+    return true;
+}
+
+/**
+ * @brief Parse an atom and any following '*', '+' or '?' quantifiers
+ *
+ * @param result - Returned sub expression
+ *
+ * @return true  - Parsed
+ * @return false - Compile error
+ */
+bool pattern_matcher::parseRepeat(positionSet& result)
+{
+    if (!parseAtom(result))
+    {
+        return false;
+    }
+
+    while (patternIndex < pattern.size())
+    {
+        const char quantifier = pattern[patternIndex];
+        if (quantifier == '*')
+        {
+            result = repeat(result);
+            result.nullable = true;
+        }
+        else if (quantifier == '+')
+        {
+            result = repeat(result);
+        }
+        else if (quantifier == '?')
+        {
+            result.nullable = true;
+        }
+        else
+        {
+            break;
+        }
+        patternIndex++;
+    }
+    return true;
+}
+
+/**
+ * @brief Parse a literal, '.', class, escape or parenthesized group
+ *
+ * @param result - Returned sub expression
+ *
+ * @return true  - Parsed
+ * @return false - Compile error
+ */
+bool pattern_matcher::parseAtom(positionSet& result)
+{
+    const char atomChar = pattern[patternIndex];
+    if ((atomChar == '*') || (atomChar == '+') || (atomChar == '?'))
+    {
+        return setError();
+    }
+
+    patternIndex++;
+    if (atomChar == '(')
+    {
+        if (!parseAlternation(result))
+        {
+            return false;
+        }
+        if ((patternIndex >= pattern.size()) || (pattern[patternIndex] != ')'))
+        {
+            return setError();
+        }
+        patternIndex++;
+        return true;
+    }
+
+    charClass acceptSet;
+    if (atomChar == '.')
+    {
+        acceptSet.set();
+    }
+    else if (atomChar == '[')
+    {
+        if (!parseClass(acceptSet, '^'))
+        {
+            return false;
+        }
+    }
+    else if (atomChar == '\\')
+    {
+        if (patternIndex >= pattern.size())
+        {
+            return setError();
+        }
+        if (!parseEscapeClass(pattern[patternIndex], acceptSet))
+        {
+            acceptSet.set(static_cast<unsigned char>(pattern[patternIndex]));
+        }
+        patternIndex++;
+    }
+    else
+    {
+        acceptSet.set(static_cast<unsigned char>(atomChar));
+    }
+
+    if (positionCount >= patternMaxPositions)
+    {
+        return setError();
+    }
+    result = addPosition(acceptSet);
+    return true;
+}
+
+/**
+ * @brief Parse a glob pattern
+ *
+ * @param result - Returned expression
+ *
+ * @return true  - Parsed
+ * @return false - Compile error
+ */
+bool pattern_matcher::parseGlob(positionSet& result)
+{
+    result = {0, 0, true};
+    while (patternIndex < pattern.size())
+    {
+        const char globChar = pattern[patternIndex++];
+        charClass acceptSet;
+        if ((globChar == '*') || (globChar == '?'))
+        {
+            acceptSet.set();
+        }
+        else if (globChar == '[')
+        {
+            if (!parseClass(acceptSet, '!'))
+            {
+                return false;
+            }
+        }
+        else if (globChar == '\\')
+        {
+            if (patternIndex >= pattern.size())
+            {
+                return setError();
+            }
+            acceptSet.set(static_cast<unsigned char>(pattern[patternIndex++]));
+        }
+        else
+        {
+            acceptSet.set(static_cast<unsigned char>(globChar));
+        }
+
+        if (positionCount >= patternMaxPositions)
+        {
+            return setError();
+        }
+
+        positionSet element = addPosition(acceptSet);
+        if (globChar == '*')
+        {
+            element = repeat(element);
+            element.nullable = true;
+        }
+        result = concatenate(result, element);
+    }
+    return true;
+}
+
+//============================================================================================================================
+//============================================================================================================================
+//  Public functions
+//============================================================================================================================
+//============================================================================================================================
+
+/**
+ * @brief Construct a matcher that only matches the empty string
+ */
+pattern_matcher::pattern_matcher() :
+    charMask(), follow(), firstMask(0), lastMask(0), emptyMatch(true), positionCount(0),
+    errorIndex(std::string_view::npos), pattern(), patternIndex(0)
+{
+}
+
+/**
+ * @brief Construct and compile a matcher
+ *
+ * @param patternString - Pattern to compile
+ * @param syntax        - Pattern dialect
+ */
+pattern_matcher::pattern_matcher(std::string_view patternString, patternSyntax_e syntax) : pattern_matcher()
+{
+    compile(patternString, syntax);
+}
+
+/**
+ * @brief Compile a new pattern
+ *
+ * @param patternString - Pattern to compile
+ * @param syntax        - Pattern dialect
+ *
+ * @return true  - Pattern compiled
+ * @return false - Pattern is invalid or needs more than patternMaxPositions positions
+ */
+bool pattern_matcher::compile(std::string_view patternString, patternSyntax_e syntax)
+{
+    charMask.fill(0);
+    follow.fill(0);
+    positionCount = 0;
+    errorIndex = std::string_view::npos;
+    pattern = patternString;
+    patternIndex = 0;
+
+    positionSet result = {0, 0, true};
+    bool compiled = ((syntax == patternSyntax_e::PATTERN_GLOB_e) ? parseGlob(result) : parseAlternation(result));
+
+    // A regex alternation only stops early on an unmatched ')'
+    if (compiled && (patternIndex < pattern.size()))
+    {
+        compiled = setError();
+    }
+
+    pattern = std::string_view();
+    firstMask = (compiled ? result.first : 0);
+    lastMask = (compiled ? result.last : 0);
+    emptyMatch = (compiled && result.nullable);
+    return compiled;
+}
+
+/**
+ * @brief Check if the whole input string matches the pattern
+ *
+ * @param input - String to check
+ *
+ * @return true  - Input matches
+ * @return false - Input does not match or the pattern is invalid
+ */
+bool pattern_matcher::match(std::string_view input) const
+{
+    if (input.empty())
+    {
+        return emptyMatch;
+    }
+
+    uint64_t state = firstMask & charMask[static_cast<unsigned char>(input[0])];
+    for (size_t inputIndex = 1; (inputIndex < input.size()) && (state != 0); inputIndex++)
+    {
+        uint64_t reachable = 0;
+        for (uint64_t stateBits = state; stateBits != 0; stateBits &= (stateBits - 1))
+        {
+            reachable |= follow[lowestPosition(stateBits)];
+        }
+        state = reachable & charMask[static_cast<unsigned char>(input[inputIndex])];
+    }
+    return ((state & lastMask) != 0);
+}
+
+/** @} */
@@ -0,0 +1,160 @@
+/* 
+ Copyright (c) 2022-2024 Randal Eike
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a 
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file string_pool.cpp
+ * @ingroup argparser
+ * @defgroup Argument parsing utilities
+ * @{
+ */
+
+// Includes
+#include <cstring>
+#include "string_pool.h"
+
+using namespace argparser;
+
+//============================================================================================================================
+//============================================================================================================================
+//  Private functions
+//============================================================================================================================
+//============================================================================================================================
+
+/**
+ * @brief Copy a new string into the pool storage
+ *
+ * @param newString - String to store
+ *
+ * @return std::string_view - View of the null terminated stored copy
+ */
+std::string_view string_pool::store(std::string_view newString)
+{
+    const size_t storeSize = newString.size() + 1;
+    char* storage;
+    if (storeSize > (blockSize / 4))
+    {
+        // Large strings get a dedicated block so the current block is not wasted
+        blockList.push_back(std::make_unique<char[]>(storeSize));
+        blockBytes += storeSize;
+        storage = blockList.back().get();
+    }
+    else
+    {
+        if (storeSize > blockRemaining)
+        {
+            blockList.push_back(std::make_unique<char[]>(blockSize));
+            blockBytes += blockSize;
+            blockNext = blockList.back().get();
+            blockRemaining = blockSize;
+        }
+        storage = blockNext;
+        blockNext += storeSize;
+        blockRemaining -= storeSize;
+    }
+
+    memcpy(storage, newString.data(), newString.size());
+    storage[newString.size()] = '\0';
+    return std::string_view(storage, newString.size());
+}
+
+//============================================================================================================================
+//============================================================================================================================
+//  Public functions
+//============================================================================================================================
+//============================================================================================================================
+
+/**
+ * @brief Construct an empty string pool
+ *
+ * @param storageBlockSize - Storage block size, strings longer than a quarter block get their own block
+ */
+string_pool::string_pool(size_t storageBlockSize) :
+    blockList(), entries(), blockNext(nullptr), blockRemaining(0),
+    blockSize((storageBlockSize >= 16) ? storageBlockSize : 16), blockBytes(0), stats{0, 0, 0, 0}
+{
+}
+
+/**
+ * @brief Get the pooled copy of a string, adding it if it is not in the pool
+ *
+ * @param newString - String to intern, does not need to be null terminated
+ *
+ * @return std::string_view - View of the pooled copy, the view data is null terminated
+ */
+std::string_view string_pool::intern(std::string_view newString)
+{
+    std::lock_guard<std::mutex> guard(poolLock);
+    stats.internCount++;
+    stats.requestedBytes += newString.size();
+
+    auto existing = entries.find(newString);
+    if (existing != entries.end())
+    {
+        return *existing;
+    }
+
+    std::string_view pooledString = store(newString);
+    entries.insert(pooledString);
+    stats.uniqueCount++;
+    stats.storedBytes += newString.size();
+    return pooledString;
+}
+
+/**
+ * @brief Remove every string, all previously returned views become invalid
+ */
+void string_pool::clear()
+{
+    std::lock_guard<std::mutex> guard(poolLock);
+    entries.clear();
+    blockList.clear();
+    blockNext = nullptr;
+    blockRemaining = 0;
+    blockBytes = 0;
+    stats = {0, 0, 0, 0};
+}
+
+/**
+ * @brief Get the heap memory held by the pool, the storage blocks plus an
+ *        estimate of the lookup set buckets and nodes
+ *
+ * @return heapUsage - Heap bytes and blocks held by the pool
+ */
+heapUsage string_pool::getHeapUsage() const
+{
+    std::lock_guard<std::mutex> guard(poolLock);
+
+    // Storage blocks and the block pointer array
+    heapUsage usage{blockBytes, blockList.size()};
+    usage += getContainerHeapUsage(blockList);
+
+    // Lookup set, one node per entry plus the bucket array once it outgrows the single inline bucket
+    const size_t nodeSize = sizeof(void*) + sizeof(std::string_view) + sizeof(size_t);
+    usage += heapUsage{entries.size() * nodeSize, entries.size()};
+    if (entries.bucket_count() > 1)
+    {
+        usage += heapUsage{entries.bucket_count() * sizeof(void*), 1};
+    }
+    return usage;
+}
+
+/** @} */
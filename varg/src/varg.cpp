@@ -150,151 +150,153 @@ template <typename T> valueParseStatus_e varg<T>::setDoubleValue(const char* new
 template <> varg<short int>::varg(short int defaultValue) : value(defaultValue), flagSetValue(0)
 { 
     varg_intf::setMinMaxSigned(SHRT_MIN, SHRT_MAX);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_SIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_SIGNED);
 }
 
 template <> varg<int>::varg(int defaultValue) : value(defaultValue), flagSetValue(0)
 { 
     varg_intf::setMinMaxSigned(INT_MIN, INT_MAX);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_SIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_SIGNED);
 }
 
 template <> varg<long int>::varg(long int defaultValue) : value(defaultValue), flagSetValue(0)
 { 
     varg_intf::setMinMaxSigned(LONG_MIN, LONG_MAX);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_SIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_SIGNED);
 }
 
 template <> varg<long long int>::varg(long long int defaultValue) : value(defaultValue), flagSetValue(0)               
 {
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_SIGNED);
+    varg_intf::setMinMaxSigned(LLONG_MIN, LLONG_MAX);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_SIGNED);
 }
 
 template <> varg<short unsigned>::varg(short unsigned defaultValue) : value(defaultValue), flagSetValue(0)
 { 
     varg_intf::setMinMaxUnsigned(0ULL, USHRT_MAX);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_UNSIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_UNSIGNED);
 }
 
 template <> varg<unsigned>::varg(unsigned defaultValue) : value(defaultValue), flagSetValue(0)
 { 
     varg_intf::setMinMaxUnsigned(0ULL, UINT_MAX);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_UNSIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_UNSIGNED);
 }
 
 template <> varg<long unsigned>::varg(long unsigned defaultValue) : value(defaultValue), flagSetValue(0)
 { 
     varg_intf::setMinMaxUnsigned(0ULL, ULONG_MAX);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_UNSIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_UNSIGNED);
 }
 
 template <> varg<long long unsigned>::varg(long long unsigned defaultValue) : value(defaultValue), flagSetValue(0)
 {
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_UNSIGNED);
+    varg_intf::setMinMaxUnsigned(0ULL, ULLONG_MAX);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_UNSIGNED);
 }
 
 template <> varg<double>::varg(double defaultValue) : value(defaultValue), flagSetValue(0.0)
 {
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_DOUBLE);
+    varg_intf::setMinMaxDouble(std::numeric_limits<double>::min(), std::numeric_limits<double>::max());
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_DOUBLE);
 }
 
 template <> varg<char>::varg(char defaultValue) : value(defaultValue), flagSetValue(0)
 {
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_CHAR);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_CHAR);
 }
 
 template <> varg<bool>::varg(bool defaultValue) : value(defaultValue), flagSetValue(!defaultValue)
 {
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_BOOL);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_BOOL);
 }
 
 template <> varg<std::string>::varg(std::string defaultValue) : value(defaultValue)
 {
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_STRING);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_STRING);
 }
 
 template <> varg<short int>::varg(short int defaultValue, short int min, short int max) : 
     value(defaultValue), flagSetValue(0)
 { 
     varg_intf::setMinMaxSigned(min, max);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_SIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_SIGNED);
 }
 
 template <> varg<int>::varg(int defaultValue, int min, int max) : 
     value(defaultValue), flagSetValue(0)
 {
     varg_intf::setMinMaxSigned(min, max);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_SIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_SIGNED);
 }
 
 template <> varg<long int>::varg(long int defaultValue, long int min, long int max) : 
     value(defaultValue), flagSetValue(0)
 {
     varg_intf::setMinMaxSigned(min, max);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_SIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_SIGNED);
 }
 
 template <> varg<long long int>::varg(long long int defaultValue, long long int min, long long int max) : 
     value(defaultValue), flagSetValue(0)
 {
     varg_intf::setMinMaxSigned(min, max);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_SIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_SIGNED);
 }
 
 template <> varg<short unsigned>::varg(short unsigned defaultValue, short unsigned min, short unsigned max) : 
     value(defaultValue), flagSetValue(0)
 {
     varg_intf::setMinMaxUnsigned(min, max);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_UNSIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_UNSIGNED);
 }
 
 template <> varg<unsigned>::varg(unsigned defaultValue, unsigned min, unsigned max) :
     value(defaultValue), flagSetValue(0)
 {
     varg_intf::setMinMaxUnsigned(min, max);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_UNSIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_UNSIGNED);
 }
 
 template <> varg<long unsigned>::varg(long unsigned defaultValue, long unsigned min, long unsigned max) :
     value(defaultValue), flagSetValue(0)
 {
     varg_intf::setMinMaxUnsigned(min, max);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_UNSIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_UNSIGNED);
 }
 
 template <> varg<long long unsigned>::varg(long long unsigned defaultValue, long long unsigned min, long long unsigned max) :
     value(defaultValue), flagSetValue(0)
 {
     varg_intf::setMinMaxUnsigned(min, max);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_UNSIGNED);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_UNSIGNED);
 }
 
 template <> varg<double>::varg(double defaultValue, double min, double max) :
     value(defaultValue), flagSetValue(0.0)
 {
     varg_intf::setMinMaxDouble(min, max);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_DOUBLE);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_DOUBLE);
 }
 
 template <> varg<char>::varg(char defaultValue, char min, char max) : 
     value(defaultValue), flagSetValue(0)
 {
     varg_intf::setMinMaxSigned(static_cast<long long int>(min), static_cast<long long int>(max));
-    std::stringstream myTypeStr;
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_CHAR);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_CHAR);
 }
 
 template <> varg<bool>::varg(bool defaultValue, bool min, bool max) : 
     value(defaultValue), flagSetValue(false)
 {
     varg_intf::setMinMaxUnsigned(0ULL, 1ULL);
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_BOOL);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_BOOL);
 }
 
 template <> varg<std::string>::varg(std::string defaultValue, std::string min, std::string max) : 
     value(defaultValue)
 {
-    varg_intf::setTypeString(typeStringFormat_e::TYPE_FMT_STRING);
+    varg_intf::setTypeFormat(typeStringFormat_e::TYPE_FMT_STRING);
 }
 
 //============================================================================================================================
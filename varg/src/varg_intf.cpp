@@ -29,6 +29,7 @@
 
 // Includes 
 #include <stdlib.h>
+#include <cstring>
 #include <algorithm>
 #include <string>
 #include <iostream>
@@ -141,16 +142,129 @@ valueParseStatus_e varg_intf::getCharValue(const char* newValue, char& parsedVal
  * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value was above the upper set limit
  */
 valueParseStatus_e varg_intf::getSignedValue(const char* newValue, long long int &parsedValue) const
+{
+    return parseSignedValue(newValue, parsedValue, bounds.signedBounds.minValue, bounds.signedBounds.maxValue);
+}
+
+/**
+ * @brief Get the Unsigned Value object
+ *
+ * @param newValue - input argument string
+ * @param parsedValue - return long long integer value
+ *
+ * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
+ * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
+ * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value was below the lower set limit
+ * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value was above the upper set limit
+ */
+valueParseStatus_e varg_intf::getUnsignedValue(const char* newValue, long long unsigned& parsedValue) const
+{
+    return parseUnsignedValue(newValue, parsedValue, bounds.unsignedBounds.minValue, bounds.unsignedBounds.maxValue);
+}
+
+/**
+ * @brief Get the Double Value object
+ *
+ * @param newValue - input argument string
+ * @param parsedValue - return double value
+ *
+ * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
+ * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
+ * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value was below the lower set limit
+ * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value was above the upper set limit
+ */
+valueParseStatus_e varg_intf::getDoubleValue(const char* newValue, double &parsedValue) const
+{
+    return parseDoubleValue(newValue, parsedValue, bounds.doubleBounds.minValue, bounds.doubleBounds.maxValue);
+}
+
+/**
+ * @brief Get the base argument type as a string, built from the type format and
+ *        value limits on the first call
+ *
+ * @return char* - Base type string
+ */
+const char* varg_intf::getTypeString()
+{
+    if (!typeString.empty() || (typeFormat == typeStringFormat_e::TYPE_FMT_NONE))
+    {
+        return typeString.c_str();
+    }
+
+    std::stringstream myTypeStr;
+
+    switch(typeFormat)
+    {
+        case typeStringFormat_e::TYPE_FMT_SIGNED:
+            myTypeStr << "<" << bounds.signedBounds.minValue << ":[+]" << bounds.signedBounds.maxValue << ">";
+            break;
+        case typeStringFormat_e::TYPE_FMT_UNSIGNED:
+            myTypeStr << "<" << bounds.unsignedBounds.minValue << ":[+]" << bounds.unsignedBounds.maxValue << ">";
+            break;
+        case typeStringFormat_e::TYPE_FMT_DOUBLE:
+            myTypeStr << "<" << bounds.doubleBounds.minValue << ":" << bounds.doubleBounds.maxValue << ">";
+            break;
+        case typeStringFormat_e::TYPE_FMT_CHAR:
+            myTypeStr << "<char>";
+            break;
+        case typeStringFormat_e::TYPE_FMT_BOOL:
+            myTypeStr << "<t|T|f|F>";
+            break;
+        case typeStringFormat_e::TYPE_FMT_STRING:
+            myTypeStr << "<string>";
+            break;
+        default:
+            myTypeStr << "<unknown>";
+            break;
+    }
+    typeString = myTypeStr.str();
+    return typeString.c_str();
+}
+
+//============================================================================================================================
+//============================================================================================================================
+//  Constructor/Destructor functions
+//============================================================================================================================
+//============================================================================================================================
+/**
+ * @brief Construct a varg_intf object
+ */
+varg_intf::varg_intf() : bounds(), typeFormat(typeStringFormat_e::TYPE_FMT_NONE)
+{
+    bounds.signedBounds.minValue = LLONG_MIN;
+    bounds.signedBounds.maxValue = LLONG_MAX;
+}
+
+//============================================================================================================================
+//============================================================================================================================
+//  Public functions
+//============================================================================================================================
+//============================================================================================================================
+
+/**
+ * @brief Parse a signed value from the input string and check it against the input limits
+ * 
+ * @param newValue    - Input string to parse
+ * @param parsedValue - return long long integer value
+ * @param minValue    - Minimum allowed value
+ * @param maxValue    - Maximum allowed value
+ * 
+ * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
+ * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
+ * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value was below the lower set limit
+ * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value was above the upper set limit
+ */
+valueParseStatus_e varg_intf::parseSignedValue(const char* newValue, long long int& parsedValue, long long int minValue, long long int maxValue)
 {
     valueParseStatus_e returnStatus = valueParseStatus_e::PARSE_SUCCESS_e;
     int                parseCount   = sscanf(newValue, "%lld", &parsedValue);
     if (1 == parseCount)
     {
-        if (parsedValue > maxSignedValue)
+        if (parsedValue > maxValue)
         {
             returnStatus = valueParseStatus_e::PARSE_BOUNDARY_HIGH_e;
         }
-        else if (parsedValue < minSignedValue)
+        else if (parsedValue < minValue)
         {
             returnStatus = valueParseStatus_e::PARSE_BOUNDARY_LOW_e;
         }
@@ -163,17 +277,19 @@ valueParseStatus_e varg_intf::getSignedValue(const char* newValue, long long int
 }
 
 /**
- * @brief Get the Unsigned Value object
- *
- * @param newValue - input argument string
- * @param parsedValue - return long long integer value
- *
+ * @brief Parse a unsigned value from the input string and check it against the input limits
+ * 
+ * @param newValue    - Input string to parse
+ * @param parsedValue - return long long unsigned value
+ * @param minValue    - Minimum allowed value
+ * @param maxValue    - Maximum allowed value
+ * 
  * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
  * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
  * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value was below the lower set limit
  * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value was above the upper set limit
  */
-valueParseStatus_e varg_intf::getUnsignedValue(const char* newValue, long long unsigned& parsedValue) const
+valueParseStatus_e varg_intf::parseUnsignedValue(const char* newValue, long long unsigned& parsedValue, long long unsigned minValue, long long unsigned maxValue)
 {
     valueParseStatus_e returnStatus = valueParseStatus_e::PARSE_SUCCESS_e;
     const char*        testChar     = newValue;
@@ -187,11 +303,11 @@ valueParseStatus_e varg_intf::getUnsignedValue(const char* newValue, long long u
     int parseCount = sscanf(newValue, "%llu", &parsedValue);
     if ((1 == parseCount) && (*testChar != '-'))
     {
-        if (parsedValue > maxUnsignedValue)
+        if (parsedValue > maxValue)
         {
             returnStatus = valueParseStatus_e::PARSE_BOUNDARY_HIGH_e;
         }
-        if (parsedValue < minUnsignedValue)
+        if (parsedValue < minValue)
         {
             returnStatus = valueParseStatus_e::PARSE_BOUNDARY_LOW_e;
         }
@@ -205,17 +321,19 @@ valueParseStatus_e varg_intf::getUnsignedValue(const char* newValue, long long u
 }
 
 /**
- * @brief Get the Double Value object
- *
- * @param newValue - input argument string
+ * @brief Parse a floating point value from the input string and check it against the input limits
+ * 
+ * @param newValue    - Input string to parse
  * @param parsedValue - return double value
- *
+ * @param minValue    - Minimum allowed value
+ * @param maxValue    - Maximum allowed value
+ * 
  * @return valueParseStatus_e::PARSE_SUCCESS_e       - if value was successsfully set
  * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if input string could not be translated
  * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if value was below the lower set limit
  * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if value was above the upper set limit
  */
-valueParseStatus_e varg_intf::getDoubleValue(const char* newValue, double &parsedValue) const
+valueParseStatus_e varg_intf::parseDoubleValue(const char* newValue, double& parsedValue, double minValue, double maxValue)
 {
     valueParseStatus_e returnStatus = valueParseStatus_e::PARSE_SUCCESS_e;
     int                parseCount   = sscanf(newValue, "%lf", &parsedValue);
@@ -223,11 +341,11 @@ valueParseStatus_e varg_intf::getDoubleValue(const char* newValue, double &parse
 
     if (1 == parseCount)
     {
-        if (absValue > maxDoubleValue)
+        if (absValue > maxValue)
         {
             returnStatus = valueParseStatus_e::PARSE_BOUNDARY_HIGH_e;
         }
-        else if (absValue < minDoubleValue)
+        else if (absValue < minValue)
         {
             returnStatus = valueParseStatus_e::PARSE_BOUNDARY_LOW_e;
         }
@@ -241,62 +359,57 @@ valueParseStatus_e varg_intf::getDoubleValue(const char* newValue, double &parse
 }
 
 /**
- * @brief Construct a type string
+ * @brief Assign each value of a delimited value buffer in order
+ *
+ * @param buffer      - Pointer to the delimited value buffer, does not need to be null terminated
+ * @param length      - Length of the value buffer in characters
+ * @param delimiter   - Value list delimiter character
+ * @param failedIndex - Set to the index of the element that failed if the return is not PARSE_SUCCESS_e
+ *
+ * @return valueParseStatus_e::PARSE_SUCCESS_e       - if all of the values were successsfully set
+ * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if an element string could not be translated
+ * @return valueParseStatus_e::PARSE_BOUNDARY_LOW_e  - if an element value exceeds lower value limit
+ * @return valueParseStatus_e::PARSE_BOUNDARY_HIGH_e - if an element value exceeds upper value limit
  */
-void varg_intf::setTypeString(typeStringFormat_e fmtType)
+valueParseStatus_e varg_intf::setValueBuffer(const char* buffer, size_t length, char delimiter, size_t& failedIndex)
 {
-    std::stringstream myTypeStr;
+    char        shortElement[elementBufferSize];
+    std::string longElement;
+    size_t      elementIndex = 0;
+    size_t      startPos     = 0;
 
-    switch(fmtType)
+    while (startPos < length)
     {
-        case typeStringFormat_e::TYPE_FMT_SIGNED:
-            myTypeStr << "<" << minSignedValue << ":[+]" << maxSignedValue << ">";
-            break;
-        case typeStringFormat_e::TYPE_FMT_UNSIGNED:
-            myTypeStr << "<" << minUnsignedValue << ":[+]" << maxUnsignedValue << ">";
-            break;
-        case typeStringFormat_e::TYPE_FMT_DOUBLE:
-            myTypeStr << "<" << minDoubleValue << ":" << maxDoubleValue << ">";
-            break;
-        case typeStringFormat_e::TYPE_FMT_CHAR:
-            myTypeStr << "<char>";
-            break;
-        case typeStringFormat_e::TYPE_FMT_BOOL:
-            myTypeStr << "<t|T|f|F>";
-            break;
-        case typeStringFormat_e::TYPE_FMT_STRING:
-            myTypeStr << "<string>";
-            break;
-        default:
-            myTypeStr << "<unknown>";
-            break;
+        const char* delimiterPtr = static_cast<const char*>(memchr(buffer + startPos, delimiter, length - startPos));
+        size_t      endPos       = ((delimiterPtr != nullptr) ? static_cast<size_t>(delimiterPtr - buffer) : length);
+        size_t      elementLength = endPos - startPos;
+
+        // Only elements that do not fit the stack buffer need a heap copy
+        const char* element = shortElement;
+        if (elementLength < elementBufferSize)
+        {
+            memcpy(shortElement, buffer + startPos, elementLength);
+            shortElement[elementLength] = '\0';
+        }
+        else
+        {
+            longElement.assign(buffer + startPos, elementLength);
+            element = longElement.c_str();
+        }
+
+        valueParseStatus_e status = setValue(element);
+        if (status != valueParseStatus_e::PARSE_SUCCESS_e)
+        {
+            failedIndex = elementIndex;
+            return status;
+        }
+
+        elementIndex++;
+        startPos = endPos + 1;
     }
-    typeString = myTypeStr.str();
-}
 
-//============================================================================================================================
-//============================================================================================================================
-//  Constructor/Destructor functions
-//============================================================================================================================
-//============================================================================================================================
-/**
- * @brief Construct a varg_intf object
- */
-varg_intf::varg_intf()
-{
-    maxSignedValue = LLONG_MAX;
-    minSignedValue = LLONG_MIN;
-    maxUnsignedValue = ULLONG_MAX;
-    minUnsignedValue = 0ULL;
-    maxDoubleValue = std::numeric_limits<double>::max();
-    minDoubleValue = std::numeric_limits<double>::min();
+    return valueParseStatus_e::PARSE_SUCCESS_e;
 }
 
-//============================================================================================================================
-//============================================================================================================================
-//  Public functions
-//============================================================================================================================
-//============================================================================================================================
-
 }
 /** @} */
@@ -0,0 +1,162 @@
+/* 
+ Copyright (c) 2022-2024 Randal Eike
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a 
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file vargfile.cpp
+ * @ingroup argparser
+ * @defgroup Argument parsing utilities
+ * @{
+ */
+
+// Includes 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "vargfile.h"
+
+using namespace argparser;
+
+//============================================================================================================================
+//============================================================================================================================
+//  Private functions
+//============================================================================================================================
+//============================================================================================================================
+
+/**
+ * @brief Release the file mapping
+ */
+void vargfile::unmap()
+{
+    if (mappedData != nullptr)
+    {
+        munmap(const_cast<std::byte*>(mappedData), mappedSize);
+    }
+    mappedData = nullptr;
+    mappedSize = 0;
+    mapAttempted = false;
+}
+
+//============================================================================================================================
+//============================================================================================================================
+//  Constructor functions
+//============================================================================================================================
+//============================================================================================================================
+
+/**
+ * @brief Construct a vargfile object
+ *
+ * @param defaultPath - Default file path, not checked
+ * @param hint        - Access pattern hint for the file mapping
+ */
+vargfile::vargfile(const char* defaultPath, fileAccessHint_e hint) :
+    varg_intf(), accessHint(hint), mappedData(nullptr), mappedSize(0), mapAttempted(false), value(defaultPath)
+{
+}
+
+vargfile::vargfile(const vargfile& other) :
+    varg_intf(other), accessHint(other.accessHint), mappedData(nullptr), mappedSize(0), mapAttempted(false), value(other.value)
+{
+}
+
+vargfile& vargfile::operator=(const vargfile& other)
+{
+    if (this != &other)
+    {
+        unmap();
+        varg_intf::operator=(other);
+        accessHint = other.accessHint;
+        value = other.value;
+    }
+    return *this;
+}
+
+vargfile::~vargfile()
+{
+    unmap();
+}
+
+//============================================================================================================================
+//============================================================================================================================
+//  Public functions
+//============================================================================================================================
+//============================================================================================================================
+
+/**
+ * @brief Check and save the file path
+ *
+ * @param newValue - File path
+ *
+ * @return valueParseStatus_e::PARSE_SUCCESS_e       - if the path names a readable regular file
+ * @return valueParseStatus_e::PARSE_INVALID_INPUT_e - if the file does not exist, is not a regular file or is not readable
+ */
+valueParseStatus_e vargfile::setValue(const char* newValue)
+{
+    struct stat fileStatus;
+    if ((stat(newValue, &fileStatus) != 0) || !S_ISREG(fileStatus.st_mode) || (access(newValue, R_OK) != 0))
+    {
+        return valueParseStatus_e::PARSE_INVALID_INPUT_e;
+    }
+
+    unmap();
+    value = newValue;
+    return valueParseStatus_e::PARSE_SUCCESS_e;
+}
+
+/**
+ * @brief Get the file data, the file is mapped on the first call
+ *
+ * @return const std::byte* - Read only file data, nullptr if the file is empty or could not be mapped
+ */
+const std::byte* vargfile::data() const
+{
+    if (mapAttempted)
+    {
+        return mappedData;
+    }
+    mapAttempted = true;
+
+    int fileDescriptor = open(value.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat fileStatus;
+    if ((fstat(fileDescriptor, &fileStatus) == 0) && (fileStatus.st_size > 0))
+    {
+        void* mapping = mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if (mapping != MAP_FAILED)
+        {
+            static const int adviceTable[] = {MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED};
+            madvise(mapping, static_cast<size_t>(fileStatus.st_size), adviceTable[accessHint]);
+            mappedData = static_cast<const std::byte*>(mapping);
+            mappedSize = static_cast<size_t>(fileStatus.st_size);
+        }
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    close(fileDescriptor);
+    return mappedData;
+}
+
+/** @} */
@@ -28,6 +28,9 @@
  */
 
 // Includes
+#include <cstring>
+#include <string>
+#include <memory_resource>
 #include "listvarg.h"
 #include <gtest/gtest.h>
 
@@ -129,7 +132,7 @@ TYPED_TEST_P(IntegerListUnitTest, ValueSetPassSignedPos)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(1, testvar.value.size());
-    EXPECT_EQ(33, testvar.value.front());
+    EXPECT_EQ(33, testvar.value[0]);
 }
 
 TYPED_TEST_P(IntegerListUnitTest, ValueSetPassSignedNeg)
@@ -139,7 +142,7 @@ TYPED_TEST_P(IntegerListUnitTest, ValueSetPassSignedNeg)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(1, testvar.value.size());
-    EXPECT_EQ(-55, testvar.value.front());
+    EXPECT_EQ(-55, testvar.value[0]);
 }
 
 TYPED_TEST_P(IntegerListUnitTest, ValueSetFail)
@@ -159,7 +162,7 @@ TYPED_TEST_P(IntegerListUnitTest, ValueSetMaxPass)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(1, testvar.value.size());
-    EXPECT_EQ(this->getMaxValue(), testvar.value.front());
+    EXPECT_EQ(this->getMaxValue(), testvar.value[0]);
 }
 
 TYPED_TEST_P(IntegerListUnitTest, ValueSetMaxFail)
@@ -182,7 +185,7 @@ TYPED_TEST_P(IntegerListUnitTest, ValueSetMinPass)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(1, testvar.value.size());
-    EXPECT_EQ(this->getMinValue(), testvar.value.front());
+    EXPECT_EQ(this->getMinValue(), testvar.value[0]);
 }
 
 TYPED_TEST_P(IntegerListUnitTest, ValueSetMinFail)
@@ -211,9 +214,8 @@ TYPED_TEST_P(IntegerListUnitTest, ValueSetPassDoubleEntry)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(2, testvar.value.size());
-    EXPECT_EQ(-55, testvar.value.front());
-    testvar.value.pop_front();
-    EXPECT_EQ(33, testvar.value.front());
+    EXPECT_EQ(-55, testvar.value[0]);
+    EXPECT_EQ(33, testvar.value[1]);
 }
 
 TYPED_TEST_P(IntegerListUnitTest, ValueSetPassTripleEntry)
@@ -225,11 +227,9 @@ TYPED_TEST_P(IntegerListUnitTest, ValueSetPassTripleEntry)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(3, testvar.value.size());
-    EXPECT_EQ(-11, testvar.value.front());
-    testvar.value.pop_front();
-    EXPECT_EQ(28, testvar.value.front());
-    testvar.value.pop_front();
-    EXPECT_EQ(17, testvar.value.front());
+    EXPECT_EQ(-11, testvar.value[0]);
+    EXPECT_EQ(28, testvar.value[1]);
+    EXPECT_EQ(17, testvar.value[2]);
 }
 
 REGISTER_TYPED_TEST_SUITE_P(IntegerListUnitTest, ValueSetPassSignedPos, ValueSetPassSignedNeg, ValueSetFail,
@@ -294,7 +294,7 @@ TYPED_TEST_P(UIntegerListUnitTest, ValueSetPass)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(1, testvar.value.size());
-    EXPECT_EQ(33, testvar.value.front());
+    EXPECT_EQ(33, testvar.value[0]);
 }
 
 TYPED_TEST_P(UIntegerListUnitTest, ValueSetFail)
@@ -323,7 +323,7 @@ TYPED_TEST_P(UIntegerListUnitTest, ValueSetMaxPass)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(1, testvar.value.size());
-    EXPECT_EQ(this->getMaxValue(), testvar.value.front());
+    EXPECT_EQ(this->getMaxValue(), testvar.value[0]);
 }
 
 TYPED_TEST_P(UIntegerListUnitTest, ValueSetMaxFail)
@@ -353,9 +353,8 @@ TYPED_TEST_P(UIntegerListUnitTest, ValueSetPassDoubleEntry)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(2, testvar.value.size());
-    EXPECT_EQ(55, testvar.value.front());
-    testvar.value.pop_front();
-    EXPECT_EQ(33, testvar.value.front());
+    EXPECT_EQ(55, testvar.value[0]);
+    EXPECT_EQ(33, testvar.value[1]);
 }
 
 TYPED_TEST_P(UIntegerListUnitTest, ValueSetPassTripleEntry)
@@ -367,11 +366,9 @@ TYPED_TEST_P(UIntegerListUnitTest, ValueSetPassTripleEntry)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(3, testvar.value.size());
-    EXPECT_EQ(11, testvar.value.front());
-    testvar.value.pop_front();
-    EXPECT_EQ(28, testvar.value.front());
-    testvar.value.pop_front();
-    EXPECT_EQ(17, testvar.value.front());
+    EXPECT_EQ(11, testvar.value[0]);
+    EXPECT_EQ(28, testvar.value[1]);
+    EXPECT_EQ(17, testvar.value[2]);
 }
 
 
@@ -411,7 +408,7 @@ TYPED_TEST_P(DoubleListUnitTest, ValueSetPassSignedPos)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(1, testvar.value.size());
-    EXPECT_EQ(3.1415, testvar.value.front());
+    EXPECT_EQ(3.1415, testvar.value[0]);
 }
 
 TYPED_TEST_P(DoubleListUnitTest, ValueSetPassSignedNeg)
@@ -421,7 +418,7 @@ TYPED_TEST_P(DoubleListUnitTest, ValueSetPassSignedNeg)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(1, testvar.value.size());
-    EXPECT_EQ(-3.1415, testvar.value.front());
+    EXPECT_EQ(-3.1415, testvar.value[0]);
 }
 
 TYPED_TEST_P(DoubleListUnitTest, ValueSetPassExponent)
@@ -431,7 +428,7 @@ TYPED_TEST_P(DoubleListUnitTest, ValueSetPassExponent)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(1, testvar.value.size());
-    EXPECT_EQ(3.1415e7, testvar.value.front());
+    EXPECT_EQ(3.1415e7, testvar.value[0]);
 }
 
 TYPED_TEST_P(DoubleListUnitTest, ValueSetPassInteger)
@@ -441,7 +438,7 @@ TYPED_TEST_P(DoubleListUnitTest, ValueSetPassInteger)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(1, testvar.value.size());
-    EXPECT_EQ(3.0, testvar.value.front());
+    EXPECT_EQ(3.0, testvar.value[0]);
 }
 
 TYPED_TEST_P(DoubleListUnitTest, ValueSetFail)
@@ -464,7 +461,7 @@ TYPED_TEST_P(DoubleListUnitTest, ValueSetMaxPass)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(1, testvar.value.size());
-    EXPECT_EQ(std::numeric_limits<double>::max(), testvar.value.front());
+    EXPECT_EQ(std::numeric_limits<double>::max(), testvar.value[0]);
 }
 
 TYPED_TEST_P(DoubleListUnitTest, ValueSetMinPass)
@@ -478,7 +475,7 @@ TYPED_TEST_P(DoubleListUnitTest, ValueSetMinPass)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(1, testvar.value.size());
-    EXPECT_EQ(std::numeric_limits<double>::min(), testvar.value.front());
+    EXPECT_EQ(std::numeric_limits<double>::min(), testvar.value[0]);
 }
 
 TYPED_TEST_P(DoubleListUnitTest, GetTypeString)
@@ -495,9 +492,8 @@ TYPED_TEST_P(DoubleListUnitTest, ValueSetPassDoubleEntry)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(2, testvar.value.size());
-    EXPECT_EQ(-2.72355, testvar.value.front());
-    testvar.value.pop_front();
-    EXPECT_EQ(3.1415, testvar.value.front());
+    EXPECT_EQ(-2.72355, testvar.value[0]);
+    EXPECT_EQ(3.1415, testvar.value[1]);
 }
 
 TYPED_TEST_P(DoubleListUnitTest, ValueSetPassTripleEntry)
@@ -509,11 +505,9 @@ TYPED_TEST_P(DoubleListUnitTest, ValueSetPassTripleEntry)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(3, testvar.value.size());
-    EXPECT_EQ(-11.5, testvar.value.front());
-    testvar.value.pop_front();
-    EXPECT_EQ(28.4, testvar.value.front());
-    testvar.value.pop_front();
-    EXPECT_EQ(17.9, testvar.value.front());
+    EXPECT_EQ(-11.5, testvar.value[0]);
+    EXPECT_EQ(28.4, testvar.value[1]);
+    EXPECT_EQ(17.9, testvar.value[2]);
 }
 
 REGISTER_TYPED_TEST_SUITE_P(DoubleListUnitTest, ValueSetPassSignedPos, ValueSetPassSignedNeg, ValueSetPassExponent,
@@ -541,7 +535,7 @@ TEST_P(ListBoolUnitTestWithParams, ValueSet)
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_FALSE(testvar.isEmpty());
     EXPECT_EQ(1, testvar.value.size());
-    EXPECT_EQ(expected, testvar.value.front());
+    EXPECT_EQ(expected, testvar.value[0]);
 }
 
 INSTANTIATE_TEST_SUITE_P(listvarg_bool_param, ListBoolUnitTestWithParams,
@@ -592,9 +586,8 @@ TEST(listvarg_bool, ValueSetPassDoubleEntry)
     EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("f"));
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_EQ(2, testvar.value.size());
-    EXPECT_EQ(true, testvar.value.front());
-    testvar.value.pop_front();
-    EXPECT_EQ(false, testvar.value.front());
+    EXPECT_EQ(true, testvar.value[0]);
+    EXPECT_EQ(false, testvar.value[1]);
 }
 
 TEST(listvarg_bool, ValueSetPassTripleEntry)
@@ -605,11 +598,9 @@ TEST(listvarg_bool, ValueSetPassTripleEntry)
     EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("0"));
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_EQ(3, testvar.value.size());
-    EXPECT_EQ(true, testvar.value.front());
-    testvar.value.pop_front();
-    EXPECT_EQ(false, testvar.value.front());
-    testvar.value.pop_front();
-    EXPECT_EQ(false, testvar.value.front());
+    EXPECT_EQ(true, testvar.value[0]);
+    EXPECT_EQ(false, testvar.value[1]);
+    EXPECT_EQ(false, testvar.value[2]);
 }
 
 /*
@@ -622,7 +613,7 @@ TEST(listvarg_char, ValueSetPass)
     EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("b"));
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_EQ(1, testvar.value.size());
-    EXPECT_EQ('b', testvar.value.front());
+    EXPECT_EQ('b', testvar.value[0]);
 }
 
 TEST(listvarg_char, ValueSetFail)
@@ -645,9 +636,8 @@ TEST(listvarg_char, ValueSetPassDoubleEntry)
     EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("f"));
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_EQ(2, testvar.value.size());
-    EXPECT_EQ('t', testvar.value.front());
-    testvar.value.pop_front();
-    EXPECT_EQ('f', testvar.value.front());
+    EXPECT_EQ('t', testvar.value[0]);
+    EXPECT_EQ('f', testvar.value[1]);
 }
 
 TEST(listvarg_char, ValueSetPassTripleEntry)
@@ -658,11 +648,9 @@ TEST(listvarg_char, ValueSetPassTripleEntry)
     EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("c"));
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_EQ(3, testvar.value.size());
-    EXPECT_EQ('a', testvar.value.front());
-    testvar.value.pop_front();
-    EXPECT_EQ('b', testvar.value.front());
-    testvar.value.pop_front();
-    EXPECT_EQ('c', testvar.value.front());
+    EXPECT_EQ('a', testvar.value[0]);
+    EXPECT_EQ('b', testvar.value[1]);
+    EXPECT_EQ('c', testvar.value[2]);
 }
 
 /*
@@ -674,7 +662,7 @@ TEST(listvarg_string, ValueSetPass)
     EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("Test String"));
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_EQ(1, testvar.value.size());
-    EXPECT_STREQ("Test String", testvar.value.front().c_str());
+    EXPECT_STREQ("Test String", testvar.value[0].c_str());
 }
 
 TEST(listvarg_string, GetTypeString)
@@ -690,9 +678,8 @@ TEST(listvarg_string, ValueSetPassDoubleEntry)
     EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("test2 string"));
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_EQ(2, testvar.value.size());
-    EXPECT_STREQ("test1 string", testvar.value.front().c_str());
-    testvar.value.pop_front();
-    EXPECT_STREQ("test2 string", testvar.value.front().c_str());
+    EXPECT_STREQ("test1 string", testvar.value[0].c_str());
+    EXPECT_STREQ("test2 string", testvar.value[1].c_str());
 }
 
 TEST(listvarg_string, ValueSetPassTripleEntry)
@@ -703,11 +690,230 @@ TEST(listvarg_string, ValueSetPassTripleEntry)
     EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("test3 string"));
     EXPECT_FALSE(testvar.value.empty());
     EXPECT_EQ(3, testvar.value.size());
-    EXPECT_STREQ("test1 string", testvar.value.front().c_str());
-    testvar.value.pop_front();
-    EXPECT_STREQ("test2 string", testvar.value.front().c_str());
-    testvar.value.pop_front();
-    EXPECT_STREQ("test3 string", testvar.value.front().c_str());
+    EXPECT_STREQ("test1 string", testvar.value[0].c_str());
+    EXPECT_STREQ("test2 string", testvar.value[1].c_str());
+    EXPECT_STREQ("test3 string", testvar.value[2].c_str());
+}
+
+TEST(listvarg_buffer, SequentialBufferSetPass)
+{
+    argparser::listvarg<int> testvar;
+    size_t failedIndex = 99;
+    const char* buffer = "1,-2,3";
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValueBuffer(buffer, strlen(buffer), ',', failedIndex));
+    EXPECT_EQ(99, failedIndex);
+    ASSERT_EQ(3, testvar.value.size());
+    EXPECT_EQ(1, testvar.value[0]);
+    EXPECT_EQ(-2, testvar.value[1]);
+    EXPECT_EQ(3, testvar.value[2]);
+}
+
+TEST(listvarg_buffer, SequentialBufferSetFailIndex)
+{
+    argparser::listvarg<short int> testvar;
+    size_t failedIndex = 99;
+    const char* buffer = "1,2,40000,4";
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_BOUNDARY_HIGH_e, testvar.setValueBuffer(buffer, strlen(buffer), ',', failedIndex));
+    EXPECT_EQ(2, failedIndex);
+    EXPECT_EQ(2, testvar.value.size());
+}
+
+TEST(listvarg_buffer, ParallelBufferSetOrder)
+{
+    argparser::listvarg<unsigned> testvar;
+    std::string buffer;
+    for (unsigned index = 0; index < 1000; index++)
+    {
+        buffer += std::to_string(index);
+        buffer += ',';
+    }
+
+    size_t failedIndex = 0;
+    testvar.enableParallelAssignment(16, 4);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValueBuffer(buffer.c_str(), buffer.size(), ',', failedIndex));
+    ASSERT_EQ(1000, testvar.value.size());
+
+    unsigned expected = 0;
+    for (auto element : testvar.value)
+    {
+        EXPECT_EQ(expected, element);
+        expected++;
+    }
+}
+
+TEST(listvarg_buffer, ParallelBufferSetFailIndex)
+{
+    argparser::listvarg<int> testvar;
+    std::string buffer;
+    for (unsigned index = 0; index < 1000; index++)
+    {
+        buffer += ((index == 737) ? std::string("bad") : std::to_string(index));
+        buffer += ((index == 911) ? "x," : ",");
+    }
+
+    size_t failedIndex = 0;
+    testvar.enableParallelAssignment(16, 4);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValueBuffer(buffer.c_str(), buffer.size(), ',', failedIndex));
+    EXPECT_EQ(737, failedIndex);
+    ASSERT_EQ(737, testvar.value.size());
+    EXPECT_EQ(736, testvar.value.back());
+}
+
+TEST(listvarg_buffer, ParallelBufferSetEmptyElements)
+{
+    argparser::listvarg<std::string> testvar;
+    std::string buffer = "a,,b,c,,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,";
+    size_t failedIndex = 0;
+    testvar.enableParallelAssignment(4, 3);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValueBuffer(buffer.c_str(), buffer.size(), ',', failedIndex));
+    ASSERT_EQ(22, testvar.value.size());
+    EXPECT_STREQ("a", testvar.value[0].c_str());
+    EXPECT_STREQ("", testvar.value[1].c_str());
+    EXPECT_STREQ("t", testvar.value.back().c_str());
+}
+
+TEST(listvarg_buffer, ParallelBufferBelowThreshold)
+{
+    argparser::listvarg<double> testvar;
+    const char* buffer = "1.5,2.5";
+    size_t failedIndex = 0;
+    testvar.enableParallelAssignment();
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValueBuffer(buffer, strlen(buffer), ',', failedIndex));
+    ASSERT_EQ(2, testvar.value.size());
+    EXPECT_EQ(2.5, testvar.value.back());
+}
+
+/**
+ * @brief List argument that only accepts even values
+ */
+class evenlistvarg : public argparser::listvarg<int>
+{
+    public:
+        virtual argparser::valueParseStatus_e setValue(const char* newValue)
+        {
+            if ((atoi(newValue) % 2) != 0)
+            {
+                return argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e;
+            }
+            return argparser::listvarg<int>::setValue(newValue);
+        }
+
+        using argparser::listvarg<int>::setValue;
+};
+
+TEST(listvarg_buffer, ParallelBufferDerivedSetValue)
+{
+    evenlistvarg testvar;
+    std::string buffer;
+    for (unsigned index = 0; index < 100; index++)
+    {
+        buffer += std::to_string((index == 61) ? 7 : (index * 2));
+        buffer += ',';
+    }
+
+    size_t failedIndex = 0;
+    testvar.enableParallelAssignment(16, 4);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValueBuffer(buffer.c_str(), buffer.size(), ',', failedIndex));
+    EXPECT_EQ(61, failedIndex);
+    EXPECT_EQ(61, testvar.value.size());
+}
+
+TEST(listvarg_storage, DefaultStorageContiguous)
+{
+    argparser::listvarg<int> testvar;
+    testvar.reserveValues(3);
+    EXPECT_LE(3, testvar.value.capacity());
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("4"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("5"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("6"));
+    ASSERT_EQ(3, testvar.value.size());
+    EXPECT_EQ(5, testvar.value.data()[1]);
+    EXPECT_TRUE(argparser::listStorageIsContiguous<decltype(testvar.value)>::value);
+}
+
+TEST(listvarg_storage, ReserveGeometricGrowth)
+{
+    argparser::listvarg<int> testvar;
+    size_t reallocCount = 0;
+    size_t lastCapacity = testvar.value.capacity();
+    for (int index = 0; index < 64; index++)
+    {
+        testvar.reserveValues(1);
+        EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue(std::to_string(index).c_str()));
+        if (testvar.value.capacity() != lastCapacity)
+        {
+            reallocCount++;
+            lastCapacity = testvar.value.capacity();
+        }
+    }
+    EXPECT_EQ(64, testvar.value.size());
+    EXPECT_GE(8U, reallocCount);
+}
+
+TEST(listvarg_storage, InlineStorage)
+{
+    argparser::inlinelistvarg<std::string, 2> testvar;
+    EXPECT_STREQ("<string>", testvar.getTypeString());
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("one"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("two"));
+    EXPECT_TRUE(testvar.value.isInline());
+
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("three"));
+    EXPECT_FALSE(testvar.value.isInline());
+    ASSERT_EQ(3, testvar.value.size());
+    EXPECT_STREQ("one", testvar.value[0].c_str());
+    EXPECT_STREQ("two", testvar.value[1].c_str());
+    EXPECT_STREQ("three", testvar.value[2].c_str());
+
+    testvar.value.erase(testvar.value.begin(), testvar.value.begin() + 2);
+    ASSERT_EQ(1, testvar.value.size());
+    EXPECT_STREQ("three", testvar.value[0].c_str());
+}
+
+TEST(listvarg_storage, InlineStorageBuffer)
+{
+    argparser::inlinelistvarg<short int> testvar;
+    std::string buffer = "1,2,3,4,5,6,7,8,9,10,11,12";
+    size_t failedIndex = 0;
+    testvar.enableParallelAssignment(4, 2);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValueBuffer(buffer.c_str(), buffer.size(), ',', failedIndex));
+    ASSERT_EQ(12, testvar.value.size());
+    for (short int index = 0; index < 12; index++)
+    {
+        EXPECT_EQ(index + 1, testvar.value[index]);
+    }
+}
+
+TEST(listvarg_storage, PmrStorage)
+{
+    char arena[256];
+    std::pmr::monotonic_buffer_resource resource(arena, sizeof(arena), std::pmr::null_memory_resource());
+    argparser::pmrlistvarg<unsigned> testvar(&resource);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("7"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("-7"));
+    ASSERT_EQ(1, testvar.value.size());
+    EXPECT_EQ(7, testvar.value[0]);
+    EXPECT_EQ(&resource, testvar.value.get_allocator().resource());
+}
+
+TEST(listvarg_storage, HeapUsage)
+{
+    argparser::listvarg<int> testvar;
+    EXPECT_EQ(0U, testvar.getHeapUsage().allocations);
+    testvar.reserveValues(10);
+    argparser::heapUsage usage = testvar.getHeapUsage();
+    EXPECT_EQ(1U, usage.allocations);
+    EXPECT_EQ(testvar.value.capacity() * sizeof(int), usage.bytes);
+
+    // Inline storage holds no heap memory until it grows past the inline capacity
+    argparser::inlinelistvarg<std::string, 2> inlinevar;
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, inlinevar.setValue("one"));
+    EXPECT_EQ(0U, inlinevar.getHeapUsage().allocations);
+    std::string longValue(100, 'x');
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, inlinevar.setValue(longValue.c_str()));
+    EXPECT_EQ(1U, inlinevar.getHeapUsage().allocations);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, inlinevar.setValue("three"));
+    EXPECT_EQ(2U, inlinevar.getHeapUsage().allocations);
 }
 
 /** @} */
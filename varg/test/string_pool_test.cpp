@@ -0,0 +1,152 @@
+/*
+ Copyright (c) 2023-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/**
+ * @file string_pool_test.cpp
+ * @ingroup libvarg_unittest
+ * @defgroup variable argument parsing utilities unit test
+ * @{
+ */
+
+// Includes
+#include <cstring>
+#include <string>
+#include "string_pool.h"
+#include "internlistvarg.h"
+#include <gtest/gtest.h>
+
+/*
+* String pool test
+*/
+TEST(string_pool, InternDedup)
+{
+    argparser::string_pool testPool;
+
+    std::string hostName = "host-a";
+    std::string_view first = testPool.intern(hostName);
+    hostName[5] = 'b';
+    std::string_view second = testPool.intern(hostName);
+    std::string_view third = testPool.intern("host-a");
+
+    EXPECT_EQ("host-a", first);
+    EXPECT_EQ("host-b", second);
+    EXPECT_EQ(first.data(), third.data());
+    EXPECT_EQ('\0', first.data()[first.size()]);
+    EXPECT_EQ(2U, testPool.size());
+
+    const argparser::stringPoolStats& stats = testPool.getStats();
+    EXPECT_EQ(3U, stats.internCount);
+    EXPECT_EQ(2U, stats.uniqueCount);
+    EXPECT_EQ(18U, stats.requestedBytes);
+    EXPECT_EQ(12U, stats.storedBytes);
+    EXPECT_EQ(6U, stats.bytesSaved());
+    EXPECT_DOUBLE_EQ(1.5, stats.dedupRatio());
+}
+
+TEST(string_pool, StableViews)
+{
+    argparser::string_pool testPool(32);
+
+    // Fill several blocks, including strings that need a dedicated block
+    std::string_view firstView = testPool.intern("first");
+    std::string longString(100, 'x');
+    std::string_view longView = testPool.intern(longString);
+    for (int index = 0; index < 100; index++)
+    {
+        testPool.intern(std::to_string(index));
+    }
+
+    EXPECT_EQ("first", firstView);
+    EXPECT_EQ(longString, longView);
+    EXPECT_EQ(firstView.data(), testPool.intern("first").data());
+    EXPECT_EQ(102U, testPool.size());
+
+    testPool.clear();
+    EXPECT_EQ(0U, testPool.size());
+    EXPECT_EQ(0U, testPool.getStats().internCount);
+    EXPECT_DOUBLE_EQ(0.0, testPool.getStats().dedupRatio());
+}
+
+/*
+* Interned string list varg test
+*/
+TEST(internlistvarg, SetValue)
+{
+    argparser::string_pool testPool;
+    argparser::internlistvarg testvar(testPool);
+    EXPECT_TRUE(testvar.isList());
+    EXPECT_TRUE(testvar.isEmpty());
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue());
+
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("tenant1"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("tenant2"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("tenant1"));
+    ASSERT_EQ(3U, testvar.value.size());
+    EXPECT_FALSE(testvar.isEmpty());
+    EXPECT_EQ("tenant1", testvar.value[0]);
+    EXPECT_EQ("tenant2", testvar.value[1]);
+    EXPECT_EQ(testvar.value[0].data(), testvar.value[2].data());
+    EXPECT_EQ(2U, testPool.size());
+}
+
+TEST(internlistvarg, SetValueBuffer)
+{
+    argparser::string_pool testPool;
+    argparser::internlistvarg firstvar(testPool);
+    argparser::internlistvarg secondvar(testPool);
+
+    const char* buffer = "cpp,h,cpp,,h";
+    size_t failedIndex = 0;
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, firstvar.setValueBuffer(buffer, strlen(buffer), ',', failedIndex));
+    ASSERT_EQ(5U, firstvar.value.size());
+    EXPECT_EQ("cpp", firstvar.value[0]);
+    EXPECT_EQ("h", firstvar.value[1]);
+    EXPECT_EQ("", firstvar.value[3]);
+    EXPECT_EQ(firstvar.value[0].data(), firstvar.value[2].data());
+
+    // Arguments sharing a pool share the stored strings
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, secondvar.setValue("h"));
+    EXPECT_EQ(firstvar.value[1].data(), secondvar.value[0].data());
+    EXPECT_EQ(3U, testPool.size());
+    EXPECT_EQ(6U, testPool.getStats().internCount);
+}
+
+TEST(string_pool, HeapUsage)
+{
+    argparser::string_pool testPool(64);
+    EXPECT_EQ(0U, testPool.getHeapUsage().bytes);
+
+    testPool.intern("first");
+    testPool.intern("first");
+    argparser::heapUsage usage = testPool.getHeapUsage();
+    EXPECT_GE(usage.bytes, 64U);
+    EXPECT_GE(usage.allocations, 3U);
+
+    // Large strings get a dedicated block
+    testPool.intern(std::string(100, 'x'));
+    EXPECT_GE(testPool.getHeapUsage().bytes, usage.bytes + 101);
+
+    // The storage blocks are released, the lookup set and block arrays keep their capacity
+    testPool.clear();
+    EXPECT_LT(testPool.getHeapUsage().allocations, usage.allocations);
+}
+
+/** @} */
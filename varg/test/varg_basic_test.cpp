@@ -674,4 +674,17 @@ TEST(varg_string, GetTypeString)
     EXPECT_STREQ("<string>", testvar.getTypeString());
 }
 
+TEST(varg_string, HeapUsage)
+{
+    argparser::varg<std::string> testvar("short", "flag");
+    EXPECT_EQ(0U, testvar.getHeapUsage().allocations);
+
+    // Strings past the short string capacity hold a heap block
+    std::string longValue(100, 'x');
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue(longValue.c_str()));
+    argparser::heapUsage usage = testvar.getHeapUsage();
+    EXPECT_EQ(1U, usage.allocations);
+    EXPECT_GT(usage.bytes, longValue.size());
+}
+
 /** @} */
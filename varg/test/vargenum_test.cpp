@@ -30,6 +30,7 @@
 // Includes
 #include "varg.h"
 #include "vargenum.h"
+#include <string>
 #include <gtest/gtest.h>
 
 /*
@@ -69,6 +70,67 @@ TEST(varg_enum, SetValue)
     EXPECT_EQ(test_enum_e::thirdVal_e, testvar.value);
 }
 
+TEST(varg_enum, SetValueUnknownName)
+{
+    argparser::vargenum<test_enum_e> testvar(test_enum_e::defaultValue_e, "test_enum_e");
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("first"));
+
+    testvar.setEnumValue("first", test_enum_e::firstVal_e);
+    testvar.setEnumValue("second", test_enum_e::secondVal_e);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("firs"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("firstt"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("First"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue(""));
+    EXPECT_EQ(test_enum_e::defaultValue_e, testvar.value);
+}
+
+TEST(varg_enum, SetValueDuplicateName)
+{
+    argparser::vargenum<test_enum_e> testvar(test_enum_e::defaultValue_e, "test_enum_e");
+    testvar.setEnumValue("first", test_enum_e::firstVal_e);
+    testvar.setEnumValue("first", test_enum_e::thirdVal_e);
+    testvar.buildLookupTable();
+
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("first"));
+    EXPECT_EQ(test_enum_e::firstVal_e, testvar.value);
+
+    // Registration after a lookup is picked up by the next lookup
+    testvar.setEnumValue("second", test_enum_e::secondVal_e);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("second"));
+    EXPECT_EQ(test_enum_e::secondVal_e, testvar.value);
+}
+
+TEST(varg_enum, SetValueCaseInsensitive)
+{
+    argparser::vargenum<test_enum_e> testvar(test_enum_e::defaultValue_e, "test_enum_e", true);
+    testvar.setEnumValue("First", test_enum_e::firstVal_e);
+    testvar.setEnumValue("SECOND", test_enum_e::secondVal_e);
+    testvar.setEnumValue("first", test_enum_e::thirdVal_e);
+
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("fIrSt"));
+    EXPECT_EQ(test_enum_e::firstVal_e, testvar.value);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("second"));
+    EXPECT_EQ(test_enum_e::secondVal_e, testvar.value);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("third"));
+}
+
+TEST(varg_enum, SetValueLargeTable)
+{
+    argparser::vargenum<int> testvar(-1, "region");
+    for (int index = 0; index < 2000; index++)
+    {
+        testvar.setEnumValue(("R" + std::to_string(index)).c_str(), index);
+    }
+
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("R0"));
+    EXPECT_EQ(0, testvar.value);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("R1999"));
+    EXPECT_EQ(1999, testvar.value);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("R1000"));
+    EXPECT_EQ(1000, testvar.value);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("R2000"));
+}
+
 TEST(varg_enum, IsListTest)
 {
     argparser::vargenum<test_enum_e> testvar(test_enum_e::defaultValue_e, "test_enum_e");
@@ -0,0 +1,99 @@
+/*
+ Copyright (c) 2023-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file vargenumset_test.cpp
+ * @ingroup libvarg_unittest
+ * @defgroup variable argument parsing utilities unit test
+ * @{
+ */
+
+// Includes
+#include <cstring>
+#include "vargenumset.h"
+#include <gtest/gtest.h>
+
+/*
+* Enum set varg test
+*/
+enum feature_e
+{
+    featureA_e = 0,
+    featureB_e,
+    featureC_e,
+    featureD_e = 63,
+};
+
+TEST(varg_enumset, ConstructorTest)
+{
+    argparser::vargenumset<feature_e> testvar("feature_e");
+    EXPECT_TRUE(testvar.value.none());
+    EXPECT_TRUE(testvar.isEmpty());
+    EXPECT_TRUE(testvar.isList());
+    EXPECT_STREQ("feature_e", testvar.getTypeString());
+    EXPECT_EQ(sizeof(uint64_t), sizeof(testvar.value));
+}
+
+TEST(varg_enumset, SetValue)
+{
+    argparser::vargenumset<feature_e> testvar("feature_e");
+    testvar.setEnumValue("a", feature_e::featureA_e);
+    testvar.setEnumValue("b", feature_e::featureB_e);
+    testvar.setEnumValue("c", feature_e::featureC_e);
+    testvar.setEnumValue("d", feature_e::featureD_e);
+
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("b"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("d"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("e"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue());
+    EXPECT_FALSE(testvar.isEmpty());
+    EXPECT_FALSE(testvar.isSet(feature_e::featureA_e));
+    EXPECT_TRUE(testvar.isSet(feature_e::featureB_e));
+    EXPECT_FALSE(testvar.isSet(feature_e::featureC_e));
+    EXPECT_TRUE(testvar.isSet(feature_e::featureD_e));
+    EXPECT_EQ(2U, testvar.value.count());
+}
+
+TEST(varg_enumset, SetValueBuffer)
+{
+    argparser::vargenumset<feature_e, 8> testvar("feature_e", true);
+    testvar.setEnumValue("alpha", feature_e::featureA_e);
+    testvar.setEnumValue("gamma", feature_e::featureC_e);
+    testvar.setEnumValue("delta", feature_e::featureD_e);
+
+    const char* buffer = "GAMMA,alpha";
+    size_t failedIndex = 0;
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValueBuffer(buffer, strlen(buffer), ',', failedIndex));
+    EXPECT_TRUE(testvar.isSet(feature_e::featureA_e));
+    EXPECT_TRUE(testvar.isSet(feature_e::featureC_e));
+
+    // Unknown name and a value that does not fit in the set
+    const char* badBuffer = "alpha,beta";
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValueBuffer(badBuffer, strlen(badBuffer), ',', failedIndex));
+    EXPECT_EQ(1U, failedIndex);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("delta"));
+    EXPECT_EQ(2U, testvar.value.count());
+    EXPECT_FALSE(testvar.isSet(feature_e::featureD_e));
+}
+
+/** @} */
@@ -0,0 +1,113 @@
+/*
+ Copyright (c) 2023-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file vargfile_test.cpp
+ * @ingroup libvarg_unittest
+ * @defgroup variable argument parsing utilities unit test
+ * @{
+ */
+
+// Includes
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+#include "vargfile.h"
+#include <gtest/gtest.h>
+
+/**
+ * @brief Write a temporary test file
+ *
+ * @param contents - File contents
+ *
+ * @return std::string - File path
+ */
+static std::string writeTestFile(const char* contents)
+{
+    char path[] = "/tmp/vargfile_testXXXXXX";
+    int fd = mkstemp(path);
+    EXPECT_GE(fd, 0);
+    EXPECT_EQ(static_cast<ssize_t>(strlen(contents)), write(fd, contents, strlen(contents)));
+    close(fd);
+    return path;
+}
+
+/*
+* File varg test
+*/
+TEST(vargfile, ConstructorTest)
+{
+    argparser::vargfile testvar("default.txt");
+    EXPECT_EQ("default.txt", testvar.value);
+    EXPECT_FALSE(testvar.isList());
+    EXPECT_FALSE(testvar.isEmpty());
+    EXPECT_FALSE(testvar.isMapped());
+    EXPECT_STREQ("<file>", testvar.getTypeString());
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue());
+}
+
+TEST(vargfile, SetValueChecks)
+{
+    argparser::vargfile testvar;
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("/nonexistent/vargfile_test"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("/tmp"));
+    EXPECT_EQ("", testvar.value);
+
+    std::string path = writeTestFile("contents");
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue(path.c_str()));
+    EXPECT_EQ(path, testvar.value);
+    remove(path.c_str());
+}
+
+TEST(vargfile, LazyMapping)
+{
+    std::string path = writeTestFile("mapped file data");
+    argparser::vargfile testvar("", argparser::fileAccessHint_e::FILE_ACCESS_SEQUENTIAL_e);
+    ASSERT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue(path.c_str()));
+    EXPECT_FALSE(testvar.isMapped());
+
+    ASSERT_NE(nullptr, testvar.data());
+    EXPECT_TRUE(testvar.isMapped());
+    EXPECT_EQ(16U, testvar.size());
+    EXPECT_EQ(0, memcmp("mapped file data", testvar.data(), testvar.size()));
+
+    // A copy maps its own view
+    argparser::vargfile copyvar(testvar);
+    EXPECT_FALSE(copyvar.isMapped());
+    EXPECT_EQ(16U, copyvar.size());
+    EXPECT_NE(testvar.data(), copyvar.data());
+    remove(path.c_str());
+}
+
+TEST(vargfile, EmptyFile)
+{
+    std::string path = writeTestFile("");
+    argparser::vargfile testvar;
+    ASSERT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue(path.c_str()));
+    EXPECT_EQ(nullptr, testvar.data());
+    EXPECT_EQ(0U, testvar.size());
+    remove(path.c_str());
+}
+
+/** @} */
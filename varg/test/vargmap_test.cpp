@@ -0,0 +1,137 @@
+/*
+ Copyright (c) 2023-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file vargmap_test.cpp
+ * @ingroup libvarg_unittest
+ * @defgroup variable argument parsing utilities unit test
+ * @{
+ */
+
+// Includes
+#include <cstring>
+#include <string>
+#include "vargmap.h"
+#include <gtest/gtest.h>
+
+/*
+* Flat string map test
+*/
+TEST(flat_string_map, InsertFind)
+{
+    argparser::flat_string_map<int> testMap;
+    EXPECT_TRUE(testMap.empty());
+    EXPECT_EQ(nullptr, testMap.find("missing"));
+
+    for (int index = 0; index < 1000; index++)
+    {
+        auto [value, inserted] = testMap.insert("key" + std::to_string(index), index);
+        EXPECT_TRUE(inserted);
+        EXPECT_EQ(index, *value);
+    }
+    EXPECT_EQ(1000U, testMap.size());
+
+    auto [value, inserted] = testMap.insert("key10", 99);
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(10, *value);
+
+    for (int index = 0; index < 1000; index++)
+    {
+        const int* foundValue = testMap.find("key" + std::to_string(index));
+        ASSERT_NE(nullptr, foundValue);
+        EXPECT_EQ(index, *foundValue);
+    }
+    EXPECT_EQ(nullptr, testMap.find("key1000"));
+
+    int total = 0;
+    testMap.forEach([&total](const std::string& key, const int& entryValue) {total += entryValue;});
+    EXPECT_EQ(499500, total);
+
+    testMap.clear();
+    EXPECT_TRUE(testMap.empty());
+    EXPECT_EQ(nullptr, testMap.find("key1"));
+}
+
+/*
+* Map varg test
+*/
+TEST(vargmap, ConstructorTest)
+{
+    argparser::vargmap<std::string> testvar;
+    EXPECT_TRUE(testvar.isList());
+    EXPECT_TRUE(testvar.isEmpty());
+    EXPECT_STREQ("<key=value>", testvar.getTypeString());
+    EXPECT_EQ(nullptr, testvar.find("k1"));
+}
+
+TEST(vargmap, SetValueString)
+{
+    argparser::vargmap<std::string> testvar;
+    const char* buffer = "k1=v1,k2=v2=x,k3=";
+    size_t failedIndex = 0;
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValueBuffer(buffer, strlen(buffer), ',', failedIndex));
+    EXPECT_FALSE(testvar.isEmpty());
+    EXPECT_EQ(3U, testvar.getMap().size());
+    EXPECT_EQ("v1", *testvar.find("k1"));
+    EXPECT_EQ("v2=x", *testvar.find("k2"));
+    EXPECT_EQ("", *testvar.find("k3"));
+
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("novalue"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("=v"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue());
+}
+
+TEST(vargmap, SetValueTyped)
+{
+    argparser::vargmap<int> testvar(0, 100, ':');
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("port:80"));
+    EXPECT_EQ(80, *testvar.find("port"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("port:abc"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_BOUNDARY_HIGH_e, testvar.setValue("port:101"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_BOUNDARY_LOW_e, testvar.setValue("port:-1"));
+    EXPECT_EQ(80, *testvar.find("port"));
+
+    argparser::vargmap<bool> boolvar;
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, boolvar.setValue("debug=true"));
+    EXPECT_TRUE(*boolvar.find("debug"));
+}
+
+TEST(vargmap, DuplicateKeyPolicy)
+{
+    argparser::vargmap<int> lastvar;
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, lastvar.setValue("k=1"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, lastvar.setValue("k=2"));
+    EXPECT_EQ(2, *lastvar.find("k"));
+
+    argparser::vargmap<int> firstvar('=', argparser::mapDuplicateKey_e::MAP_KEEP_FIRST_e);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, firstvar.setValue("k=1"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, firstvar.setValue("k=2"));
+    EXPECT_EQ(1, *firstvar.find("k"));
+
+    argparser::vargmap<int> rejectvar('=', argparser::mapDuplicateKey_e::MAP_REJECT_DUPLICATE_e);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, rejectvar.setValue("k=1"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, rejectvar.setValue("k=2"));
+    EXPECT_EQ(1, *rejectvar.find("k"));
+}
+
+/** @} */
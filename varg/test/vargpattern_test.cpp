@@ -0,0 +1,167 @@
+/*
+ Copyright (c) 2023-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/**
+ * @file vargpattern_test.cpp
+ * @ingroup libvarg_unittest
+ * @defgroup variable argument parsing utilities unit test
+ * @{
+ */
+
+// Includes
+#include <cstring>
+#include <string>
+#include "pattern_matcher.h"
+#include "vargpattern.h"
+#include <gtest/gtest.h>
+
+using namespace argparser;
+
+/*
+* Pattern matcher test
+*/
+TEST(pattern_matcher, RegexLiteralAndClasses)
+{
+    pattern_matcher identifier("[A-Za-z_]\\w*", patternSyntax_e::PATTERN_REGEX_e);
+    ASSERT_TRUE(identifier.isValid());
+    EXPECT_TRUE(identifier.match("value_1"));
+    EXPECT_TRUE(identifier.match("_"));
+    EXPECT_FALSE(identifier.match("1value"));
+    EXPECT_FALSE(identifier.match("val-ue"));
+    EXPECT_FALSE(identifier.match(""));
+
+    pattern_matcher version("v\\d+\\.\\d+(\\.\\d+)?", patternSyntax_e::PATTERN_REGEX_e);
+    ASSERT_TRUE(version.isValid());
+    EXPECT_TRUE(version.match("v1.2"));
+    EXPECT_TRUE(version.match("v10.20.3"));
+    EXPECT_FALSE(version.match("v1."));
+    EXPECT_FALSE(version.match("v1.2.3.4"));
+
+    pattern_matcher negated("[^,=]+", patternSyntax_e::PATTERN_REGEX_e);
+    EXPECT_TRUE(negated.match("abc"));
+    EXPECT_FALSE(negated.match("a=b"));
+}
+
+TEST(pattern_matcher, RegexAlternationAndAnchoring)
+{
+    pattern_matcher level("debug|info|warn(ing)?|error", patternSyntax_e::PATTERN_REGEX_e);
+    ASSERT_TRUE(level.isValid());
+    EXPECT_TRUE(level.match("debug"));
+    EXPECT_TRUE(level.match("warn"));
+    EXPECT_TRUE(level.match("warning"));
+    EXPECT_FALSE(level.match("warnings"));
+    EXPECT_FALSE(level.match("xdebug"));
+
+    pattern_matcher hostName("[a-z0-9]([a-z0-9-]*[a-z0-9])?(\\.[a-z0-9]([a-z0-9-]*[a-z0-9])?)*", patternSyntax_e::PATTERN_REGEX_e);
+    ASSERT_TRUE(hostName.isValid());
+    EXPECT_TRUE(hostName.match("host-1.example.com"));
+    EXPECT_TRUE(hostName.match("a"));
+    EXPECT_FALSE(hostName.match("-host"));
+    EXPECT_FALSE(hostName.match("host."));
+    EXPECT_FALSE(hostName.match("host..com"));
+
+    pattern_matcher optional("(ab)*", patternSyntax_e::PATTERN_REGEX_e);
+    EXPECT_TRUE(optional.match(""));
+    EXPECT_TRUE(optional.match("abab"));
+    EXPECT_FALSE(optional.match("aba"));
+}
+
+TEST(pattern_matcher, RegexErrors)
+{
+    EXPECT_EQ(1U, pattern_matcher("a)", patternSyntax_e::PATTERN_REGEX_e).getErrorIndex());
+    EXPECT_EQ(2U, pattern_matcher("(a", patternSyntax_e::PATTERN_REGEX_e).getErrorIndex());
+    EXPECT_EQ(0U, pattern_matcher("*a", patternSyntax_e::PATTERN_REGEX_e).getErrorIndex());
+    EXPECT_FALSE(pattern_matcher("[a-", patternSyntax_e::PATTERN_REGEX_e).isValid());
+    EXPECT_FALSE(pattern_matcher("[z-a]", patternSyntax_e::PATTERN_REGEX_e).isValid());
+    EXPECT_FALSE(pattern_matcher("a\\", patternSyntax_e::PATTERN_REGEX_e).isValid());
+
+    // Position limit
+    std::string longPattern(patternMaxPositions, 'a');
+    EXPECT_TRUE(pattern_matcher(longPattern, patternSyntax_e::PATTERN_REGEX_e).isValid());
+    longPattern += 'a';
+    pattern_matcher tooLong(longPattern, patternSyntax_e::PATTERN_REGEX_e);
+    EXPECT_FALSE(tooLong.isValid());
+    EXPECT_FALSE(tooLong.match("a"));
+}
+
+TEST(pattern_matcher, Glob)
+{
+    pattern_matcher sourceFile("*.[ch]pp", patternSyntax_e::PATTERN_GLOB_e);
+    ASSERT_TRUE(sourceFile.isValid());
+    EXPECT_TRUE(sourceFile.match("main.cpp"));
+    EXPECT_TRUE(sourceFile.match("a.b.hpp"));
+    EXPECT_TRUE(sourceFile.match(".cpp"));
+    EXPECT_FALSE(sourceFile.match("main.cc"));
+
+    pattern_matcher tag("v?-[!0-9]*", patternSyntax_e::PATTERN_GLOB_e);
+    EXPECT_TRUE(tag.match("v1-beta"));
+    EXPECT_FALSE(tag.match("v1-2"));
+    EXPECT_FALSE(tag.match("v-beta"));
+
+    pattern_matcher escaped("\\*", patternSyntax_e::PATTERN_GLOB_e);
+    EXPECT_TRUE(escaped.match("*"));
+    EXPECT_FALSE(escaped.match("a"));
+
+    pattern_matcher empty;
+    EXPECT_TRUE(empty.match(""));
+    EXPECT_FALSE(empty.match("a"));
+}
+
+/*
+* Pattern varg test
+*/
+TEST(vargpattern, SetValue)
+{
+    vargpattern testvar("[a-z]+", patternSyntax_e::PATTERN_REGEX_e, "default");
+    EXPECT_TRUE(testvar.isPatternValid());
+    EXPECT_FALSE(testvar.isList());
+    EXPECT_EQ("default", testvar.value);
+    EXPECT_STREQ("<string>", testvar.getTypeString());
+
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("abc"));
+    EXPECT_EQ("abc", testvar.value);
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("ABC"));
+    EXPECT_EQ("abc", testvar.value);
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue());
+
+    vargpattern badvar("(", patternSyntax_e::PATTERN_REGEX_e);
+    EXPECT_FALSE(badvar.isPatternValid());
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, badvar.setValue(""));
+}
+
+TEST(listvargpattern, SetValueBuffer)
+{
+    listvargpattern testvar("*.log", patternSyntax_e::PATTERN_GLOB_e);
+    EXPECT_TRUE(testvar.isList());
+
+    const char* buffer = "a.log,b.log,c.txt,d.log";
+    size_t failedIndex = 0;
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValueBuffer(buffer, strlen(buffer), ',', failedIndex));
+    EXPECT_EQ(2U, failedIndex);
+    ASSERT_EQ(2U, testvar.value.size());
+    EXPECT_EQ("b.log", testvar.value[1]);
+
+    EXPECT_EQ(valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("e.log"));
+    EXPECT_EQ(valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("e.txt"));
+    EXPECT_EQ(3U, testvar.value.size());
+}
+
+/** @} */
@@ -0,0 +1,190 @@
+/*
+ Copyright (c) 2023-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file vargrange_test.cpp
+ * @ingroup libvarg_unittest
+ * @defgroup variable argument parsing utilities unit test
+ * @{
+ */
+
+// Includes
+#include <cstring>
+#include "vargrange.h"
+#include <gtest/gtest.h>
+
+/*
+* Range list varg test
+*/
+TEST(vargrange, ConstructorTest)
+{
+    argparser::vargrange<int> testvar;
+    EXPECT_TRUE(testvar.isList());
+    EXPECT_TRUE(testvar.isEmpty());
+    EXPECT_FALSE(testvar.contains(0));
+    EXPECT_STREQ("<-2147483648:[+]2147483647>", testvar.getTypeString());
+}
+
+TEST(vargrange, SetValueMergeRanges)
+{
+    argparser::vargrange<unsigned> testvar;
+    const char* buffer = "32-47,0-15,64,16-20,46-50";
+    size_t failedIndex = 0;
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValueBuffer(buffer, strlen(buffer), ',', failedIndex));
+    EXPECT_FALSE(testvar.isEmpty());
+
+    auto const& intervals = testvar.getIntervals();
+    ASSERT_EQ(3U, intervals.size());
+    EXPECT_EQ(0U, intervals[0].first);
+    EXPECT_EQ(20U, intervals[0].last);
+    EXPECT_EQ(32U, intervals[1].first);
+    EXPECT_EQ(50U, intervals[1].last);
+    EXPECT_EQ(64U, intervals[2].first);
+    EXPECT_EQ(64U, intervals[2].last);
+
+    EXPECT_TRUE(testvar.contains(0));
+    EXPECT_TRUE(testvar.contains(20));
+    EXPECT_FALSE(testvar.contains(21));
+    EXPECT_FALSE(testvar.contains(31));
+    EXPECT_TRUE(testvar.contains(50));
+    EXPECT_TRUE(testvar.contains(64));
+    EXPECT_FALSE(testvar.contains(65));
+
+    // Bridge the gap between the first two intervals
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("21-31"));
+    ASSERT_EQ(2U, intervals.size());
+    EXPECT_EQ(50U, intervals[0].last);
+}
+
+TEST(vargrange, SetValueStep)
+{
+    argparser::vargrange<int> testvar;
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("0-9:4"));
+    EXPECT_TRUE(testvar.getIntervals().empty());
+    ASSERT_EQ(1U, testvar.getSteppedIntervals().size());
+    EXPECT_EQ(0, testvar.getSteppedIntervals()[0].first);
+    EXPECT_EQ(8, testvar.getSteppedIntervals()[0].last);
+    EXPECT_EQ(4U, testvar.getSteppedIntervals()[0].step);
+    EXPECT_FALSE(testvar.isEmpty());
+    EXPECT_TRUE(testvar.contains(4));
+    EXPECT_FALSE(testvar.contains(5));
+    EXPECT_TRUE(testvar.contains(8));
+    EXPECT_FALSE(testvar.contains(9));
+
+    // Single member stepped range is a plain value
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("20-22:5"));
+    ASSERT_EQ(1U, testvar.getIntervals().size());
+    EXPECT_EQ(20, testvar.getIntervals()[0].last);
+
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("-5--3"));
+    EXPECT_TRUE(testvar.contains(-4));
+    EXPECT_FALSE(testvar.contains(-2));
+}
+
+TEST(vargrange, SetValueLargeStep)
+{
+    argparser::vargrange<unsigned> testvar;
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("0-4294967295:2"));
+    EXPECT_EQ(1U, testvar.getSteppedIntervals().size());
+    EXPECT_EQ(4294967294U, testvar.getSteppedIntervals()[0].last);
+    EXPECT_TRUE(testvar.contains(4294967294U));
+    EXPECT_FALSE(testvar.contains(4294967295U));
+    EXPECT_FALSE(testvar.contains(7));
+    EXPECT_EQ("01010101", testvar.toBitset<8>().to_string());
+}
+
+TEST(vargrange, SetValueStepMerge)
+{
+    argparser::vargrange<int> testvar;
+    const char* buffer = "0-20:4,24-40:4,2-10:4,1-100:7,0-8:4";
+    size_t failedIndex = 0;
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValueBuffer(buffer, strlen(buffer), ',', failedIndex));
+
+    // Same step and phase ranges merge, the others stay separate and sorted
+    auto const& stepped = testvar.getSteppedIntervals();
+    ASSERT_EQ(3U, stepped.size());
+    EXPECT_EQ(0, stepped[0].first);
+    EXPECT_EQ(40, stepped[0].last);
+    EXPECT_EQ(1, stepped[1].first);
+    EXPECT_EQ(99, stepped[1].last);
+    EXPECT_EQ(2, stepped[2].first);
+    EXPECT_EQ(10, stepped[2].last);
+
+    EXPECT_TRUE(testvar.contains(36));
+    EXPECT_TRUE(testvar.contains(6));
+    EXPECT_TRUE(testvar.contains(99));
+    EXPECT_TRUE(testvar.contains(8));
+    EXPECT_FALSE(testvar.contains(14));
+    EXPECT_FALSE(testvar.contains(44));
+    EXPECT_FALSE(testvar.contains(-1));
+}
+
+TEST(vargrange, SetValueTypeLimits)
+{
+    argparser::vargrange<int> testvar;
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("-2147483648"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("2147483647"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("-2147483647--2147483640"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("-2147483648"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("2147483640-2147483646"));
+
+    auto const& intervals = testvar.getIntervals();
+    ASSERT_EQ(2U, intervals.size());
+    EXPECT_EQ(INT_MIN, intervals[0].first);
+    EXPECT_EQ(-2147483640, intervals[0].last);
+    EXPECT_EQ(2147483640, intervals[1].first);
+    EXPECT_EQ(INT_MAX, intervals[1].last);
+    EXPECT_TRUE(testvar.contains(INT_MIN));
+    EXPECT_TRUE(testvar.contains(INT_MAX));
+    EXPECT_FALSE(testvar.contains(0));
+}
+
+TEST(vargrange, SetValueErrors)
+{
+    argparser::vargrange<int> testvar(0, 100);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("10-5"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("1-5:0"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("a-5"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue("1-"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_BOUNDARY_HIGH_e, testvar.setValue("90-101"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_BOUNDARY_LOW_e, testvar.setValue("-1-5"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue());
+    EXPECT_TRUE(testvar.isEmpty());
+}
+
+TEST(vargrange, ToBitset)
+{
+    argparser::vargrange<int> testvar;
+    const char* buffer = "-4-2,6,8-100";
+    size_t failedIndex = 0;
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValueBuffer(buffer, strlen(buffer), ',', failedIndex));
+
+    std::bitset<12> mask = testvar.toBitset<12>();
+    EXPECT_EQ("111101000111", mask.to_string());
+
+    argparser::vargrange<int> steppedvar;
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, steppedvar.setValue("-7-20:3"));
+    EXPECT_EQ("100100100100", steppedvar.toBitset<12>().to_string());
+}
+
+/** @} */
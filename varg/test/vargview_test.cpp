@@ -0,0 +1,127 @@
+/*
+ Copyright (c) 2023-2024 Randal Eike
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file vargview_test.cpp
+ * @ingroup libvarg_unittest
+ * @defgroup variable argument parsing utilities unit test
+ * @{
+ */
+
+// Includes
+#include <cstring>
+#include <string>
+#include "vargview.h"
+#include <gtest/gtest.h>
+
+/*
+* Borrowed string varg test
+*/
+TEST(vargview, ConstructorTest)
+{
+    argparser::vargview testvar("default");
+    EXPECT_EQ("default", testvar.value);
+    EXPECT_FALSE(testvar.isList());
+    EXPECT_FALSE(testvar.isEmpty());
+    EXPECT_STREQ("<string>", testvar.getTypeString());
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.validate());
+}
+
+TEST(vargview, SetValueBorrowsBuffer)
+{
+    argparser::vargview testvar;
+    std::string argValue = "borrowed";
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue(argValue.c_str()));
+    EXPECT_EQ("borrowed", testvar.value);
+    EXPECT_EQ(argValue.data(), testvar.value.data());
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.setValue());
+
+    const char* buffer = "first,second";
+    size_t failedIndex = 0;
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValueBuffer(buffer, strlen(buffer), ',', failedIndex));
+    EXPECT_EQ("first", testvar.value);
+    EXPECT_EQ(buffer, testvar.value.data());
+}
+
+/*
+* Lazy numeric varg test
+*/
+TEST(varglazy, DefaultValue)
+{
+    argparser::varglazy<int> testvar(7);
+    EXPECT_EQ(7, testvar.getValue());
+    EXPECT_TRUE(testvar.getRawValue().empty());
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.validate());
+    EXPECT_FALSE(testvar.isList());
+    EXPECT_FALSE(testvar.isEmpty());
+}
+
+TEST(varglazy, DeferredConversion)
+{
+    argparser::varglazy<int> testvar(0);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("abc"));
+    EXPECT_EQ("abc", testvar.getRawValue());
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, testvar.validate());
+    EXPECT_EQ(0, testvar.getValue());
+
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("-42"));
+    EXPECT_EQ(-42, testvar.getValue());
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.validate());
+
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("2147483648"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_BOUNDARY_HIGH_e, testvar.validate());
+    EXPECT_EQ(-42, testvar.getValue());
+}
+
+TEST(varglazy, BoundedValue)
+{
+    argparser::varglazy<unsigned> testvar(5, 2, 10);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("11"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_BOUNDARY_HIGH_e, testvar.validate());
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("1"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_BOUNDARY_LOW_e, testvar.validate());
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, testvar.setValue("10"));
+    EXPECT_EQ(10U, testvar.getValue());
+
+    argparser::varglazy<double> doublevar(1.0);
+    const char* buffer = "2.5,3.5";
+    size_t failedIndex = 0;
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, doublevar.setValueBuffer(buffer, strlen(buffer), ',', failedIndex));
+    EXPECT_EQ("2.5", doublevar.getRawValue());
+    EXPECT_DOUBLE_EQ(2.5, doublevar.getValue());
+}
+
+TEST(varglazy, BoolCharValue)
+{
+    argparser::varglazy<bool> boolvar(false);
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, boolvar.setValue("true"));
+    EXPECT_TRUE(boolvar.getValue());
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, boolvar.setValue());
+
+    argparser::varglazy<char> charvar('a');
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_SUCCESS_e, charvar.setValue("zz"));
+    EXPECT_EQ(argparser::valueParseStatus_e::PARSE_INVALID_INPUT_e, charvar.validate());
+    EXPECT_EQ('a', charvar.getValue());
+}
+
+/** @} */